@@ -0,0 +1,133 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Benchmark.h"
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+namespace Benchmarks {
+
+    namespace {
+
+        constexpr int NameWidth = 48;
+        constexpr int ColumnWidth = 12;
+
+        // Prints a per-element count, or "n/a" if the event was not measured
+        void PrintPerElement(const BenchmarkResult& result, PerfEvent event) {
+            if (!result.counters.Has(event)) {
+                std::cout << std::setw(ColumnWidth) << "n/a";
+                return;
+            }
+            std::cout << std::setw(ColumnWidth)
+                      << static_cast<double>(result.counters.Get(event)) / result.TotalElements();
+        }
+
+    } // namespace
+
+    BenchmarkOptions BenchmarkOptions::Parse(int argc, char** argv) {
+        BenchmarkOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument == "--counters") {
+                options.collectCounters = true;
+            } else if (argument.starts_with("--filter=")) {
+                options.filter = std::string(argument.substr(9));
+            } else if (argument.starts_with("--min-time=")) {
+                options.minSeconds = std::stod(std::string(argument.substr(11)));
+            } else if (argument == "--sweep") {
+                options.sweep = true;
+            } else if (argument.starts_with("--threads=")) {
+                options.maxThreads = std::stoul(std::string(argument.substr(10)));
+            } else if (argument.starts_with("--csv=")) {
+                options.csvPath = std::string(argument.substr(6));
+            } else if (argument.starts_with("--trace=")) {
+                options.tracePath = std::string(argument.substr(8));
+            } else if (argument.starts_with("--chrome-trace=")) {
+                options.chromeTracePath = std::string(argument.substr(15));
+            } else {
+                throw std::invalid_argument("Unknown option: " + std::string(argument) +
+                                            " (expected --counters, --filter=text, --min-time=seconds, "
+                                            "--sweep, --threads=count, --csv=path, --trace=path or --chrome-trace=path)");
+            }
+        }
+        return options;
+    }
+
+    BenchmarkRunner::BenchmarkRunner(BenchmarkOptions options)
+        : m_Options(std::move(options)) {
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__OPTIMIZE__)
+        std::cout << "Warning: benchmarks were built without optimizations; "
+                     "configure with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.\n";
+#endif
+
+        if (m_Options.collectCounters) {
+            m_Counters = std::make_unique<PerfCounters>();
+            if (!m_Counters->IsAvailable()) {
+                std::cout << "Hardware counters unavailable (" << m_Counters->GetUnavailableReason()
+                          << "); reporting timings only.\n";
+            }
+        }
+
+        std::cout << "\n" << std::left << std::setw(NameWidth) << "Benchmark" << std::right
+                  << std::setw(ColumnWidth) << "ns/elem";
+        if (m_Counters) {
+            std::cout << std::setw(ColumnWidth) << "cycles/elem"
+                      << std::setw(ColumnWidth) << "instr/elem"
+                      << std::setw(ColumnWidth) << "IPC"
+                      << std::setw(ColumnWidth) << "cmiss/elem"
+                      << std::setw(ColumnWidth) << "bmiss/elem";
+        }
+        std::cout << "\n";
+    }
+
+    bool BenchmarkRunner::ShouldRun(std::string_view name) const {
+        return m_Options.filter.empty() || name.find(m_Options.filter) != std::string_view::npos;
+    }
+
+    void BenchmarkRunner::StartCounters() {
+        if (m_Counters) {
+            m_Counters->Start();
+        }
+    }
+
+    void BenchmarkRunner::Finish(BenchmarkResult result) {
+        if (m_Counters) {
+            result.counters = m_Counters->Stop();
+        }
+
+        std::cout << std::left << std::setw(NameWidth) << result.name << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(ColumnWidth) << result.NanosecondsPerElement();
+
+        if (m_Counters) {
+            PrintPerElement(result, PerfEvent::Cycles);
+            PrintPerElement(result, PerfEvent::Instructions);
+
+            if (result.counters.Has(PerfEvent::Cycles) && result.counters.Has(PerfEvent::Instructions) &&
+                result.counters.Get(PerfEvent::Cycles) > 0) {
+                std::cout << std::setw(ColumnWidth)
+                          << static_cast<double>(result.counters.Get(PerfEvent::Instructions)) /
+                             static_cast<double>(result.counters.Get(PerfEvent::Cycles));
+            } else {
+                std::cout << std::setw(ColumnWidth) << "n/a";
+            }
+
+            PrintPerElement(result, PerfEvent::CacheMisses);
+            PrintPerElement(result, PerfEvent::BranchMisses);
+        }
+        std::cout << std::endl;
+
+        m_Results.push_back(std::move(result));
+    }
+
+    const std::vector<BenchmarkResult>& BenchmarkRunner::GetResults() const {
+        return m_Results;
+    }
+
+    const BenchmarkOptions& BenchmarkRunner::GetOptions() const {
+        return m_Options;
+    }
+
+} // namespace Benchmarks
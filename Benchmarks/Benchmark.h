@@ -0,0 +1,204 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "PerfCounters.h"
+
+namespace Benchmarks {
+
+    /**
+     * @brief Prevents the compiler from optimizing away the computation of a value.
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+        (void)*sink;
+#endif
+    }
+
+    /**
+     * @brief Command line options of the benchmark runner.
+     */
+    struct BenchmarkOptions {
+        /** Collect hardware counters (--counters) */
+        bool collectCounters = false;
+
+        /** Only run benchmarks whose name contains this text (--filter=text) */
+        std::string filter;
+
+        /** Minimum measured time per benchmark in seconds (--min-time=seconds) */
+        double minSeconds = 0.25;
+
+        /** Also run the working-set and thread-count sweeps (--sweep) */
+        bool sweep = false;
+
+        /** Maximum thread count of the sweeps, 0 for the hardware concurrency (--threads=count) */
+        std::size_t maxThreads = 0;
+
+        /** File the sweep points are written to as CSV, empty for none (--csv=path) */
+        std::string csvPath;
+
+        /** Workload trace to replay, empty to replay a recording of the built-in scene (--trace=path) */
+        std::string tracePath;
+
+        /** Chrome trace JSON written from the library's trace markers, empty for none (--chrome-trace=path) */
+        std::string chromeTracePath;
+
+        /**
+         * @brief Parses options from the command line.
+         * @throws std::invalid_argument on unknown options
+         */
+        static BenchmarkOptions Parse(int argc, char** argv);
+    };
+
+    /**
+     * @brief Measurements of one benchmark.
+     */
+    struct BenchmarkResult {
+        std::string name;
+
+        /** Elements processed by one call of the benchmark function */
+        std::size_t elementsPerCall = 0;
+
+        /** Number of measured calls */
+        std::uint64_t calls = 0;
+
+        /** Wall time of all measured calls in nanoseconds */
+        double totalNanoseconds = 0.0;
+
+        /** Hardware counters over all measured calls, if collected */
+        PerfCounterValues counters;
+
+        /**
+         * @brief Gets the number of elements processed during the measurement.
+         */
+        [[nodiscard]] double TotalElements() const {
+            return static_cast<double>(calls) * static_cast<double>(elementsPerCall);
+        }
+
+        /**
+         * @brief Gets the average wall time per element in nanoseconds.
+         */
+        [[nodiscard]] double NanosecondsPerElement() const {
+            return totalNanoseconds / TotalElements();
+        }
+    };
+
+    /**
+     * @class BenchmarkRunner
+     * @brief Times benchmark functions and prints one result row per benchmark.
+     *
+     * Each function processes a fixed number of elements per call. The runner calibrates the
+     * number of calls to reach the minimum measurement time, then reports the time per
+     * element. With hardware counters enabled it also reports cycles, instructions, IPC,
+     * cache misses and branch misses per element; a kernel with an IPC well below 1 and
+     * many cache misses per element is memory-bound, one with a high IPC is compute-bound.
+     */
+    class BenchmarkRunner {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        BenchmarkOptions m_Options;
+
+        /** Counters for the running thread, only created when requested */
+        std::unique_ptr<PerfCounters> m_Counters;
+
+        std::vector<BenchmarkResult> m_Results;
+
+        /**
+         * @brief Calls a function a number of times and returns the elapsed nanoseconds.
+         */
+        template <typename Function>
+        static double TimeCalls(Function& function, std::uint64_t calls) {
+            const Clock::time_point start = Clock::now();
+            for (std::uint64_t i = 0; i < calls; ++i) {
+                function();
+            }
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        }
+
+        /**
+         * @brief Starts the hardware counters, if collected.
+         */
+        void StartCounters();
+
+        /**
+         * @brief Stores the counters of a finished measurement and prints its row.
+         */
+        void Finish(BenchmarkResult result);
+
+    public:
+        /**
+         * @brief Creates a runner and prints the column headers.
+         * @param options Options parsed from the command line
+         */
+        explicit BenchmarkRunner(BenchmarkOptions options);
+
+        /**
+         * @brief Checks whether a benchmark passes the name filter.
+         */
+        [[nodiscard]] bool ShouldRun(std::string_view name) const;
+
+        /**
+         * @brief Runs a benchmark unless it is excluded by the filter.
+         *
+         * @param name Name shown in the report
+         * @param elementsPerCall Number of elements one call of function processes
+         * @param function Callable invoked repeatedly; its results should be passed to DoNotOptimize
+         */
+        template <typename Function>
+        void Run(std::string_view name, std::size_t elementsPerCall, Function&& function) {
+            if (!ShouldRun(name)) {
+                return;
+            }
+
+            // Warm up caches, then double the call count until a batch takes a tenth of the target
+            function();
+            const double targetNanoseconds = m_Options.minSeconds * 1e9;
+            std::uint64_t calls = 1;
+            double elapsed = TimeCalls(function, calls);
+            while (elapsed < targetNanoseconds / 10.0) {
+                calls *= 2;
+                elapsed = TimeCalls(function, calls);
+            }
+            calls = static_cast<std::uint64_t>(static_cast<double>(calls) * targetNanoseconds / elapsed) + 1;
+
+            BenchmarkResult result;
+            result.name = std::string(name);
+            result.elementsPerCall = elementsPerCall;
+            result.calls = calls;
+
+            StartCounters();
+            result.totalNanoseconds = TimeCalls(function, calls);
+            Finish(std::move(result));
+        }
+
+        /**
+         * @brief Gets the results of all benchmarks run so far.
+         */
+        [[nodiscard]] const std::vector<BenchmarkResult>& GetResults() const;
+
+        /**
+         * @brief Gets the options the runner was created with.
+         */
+        [[nodiscard]] const BenchmarkOptions& GetOptions() const;
+    };
+
+} // namespace Benchmarks
+
+#endif // BENCHMARK_H
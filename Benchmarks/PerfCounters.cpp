@@ -0,0 +1,143 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Benchmarks {
+
+#if defined(__linux__)
+
+    namespace {
+
+        constexpr std::uint64_t EventConfigs[PerfEventCount] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES
+        };
+
+        int OpenEvent(std::uint64_t config, int groupLeader) {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = config;
+            attributes.disabled = groupLeader == -1 ? 1 : 0;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // Calling thread, any CPU
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+        }
+
+    } // namespace
+
+    PerfCounters::PerfCounters() {
+        m_Descriptors.fill(-1);
+
+        for (std::size_t i = 0; i < PerfEventCount; ++i) {
+            const int descriptor = OpenEvent(EventConfigs[i], m_Leader);
+            if (descriptor == -1) {
+                if (m_UnavailableReason.empty()) {
+                    m_UnavailableReason = std::string("perf_event_open failed: ") + std::strerror(errno);
+                }
+                continue;
+            }
+
+            m_Descriptors[i] = descriptor;
+            m_ReadOrder[m_OpenCount++] = static_cast<PerfEvent>(i);
+            if (m_Leader == -1) {
+                m_Leader = descriptor;
+            }
+        }
+
+        if (m_Leader != -1) {
+            m_UnavailableReason.clear();
+        }
+    }
+
+    PerfCounters::~PerfCounters() {
+        for (int descriptor : m_Descriptors) {
+            if (descriptor != -1) {
+                close(descriptor);
+            }
+        }
+    }
+
+    void PerfCounters::Start() {
+        if (m_Leader == -1) {
+            return;
+        }
+        ioctl(m_Leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_Leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    PerfCounterValues PerfCounters::Stop() {
+        PerfCounterValues result;
+        if (m_Leader == -1) {
+            return result;
+        }
+        ioctl(m_Leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        // Group read layout: count, time enabled, time running, then one value per event
+        std::uint64_t buffer[3 + PerfEventCount] = {};
+        const ssize_t bytes = read(m_Leader, buffer, sizeof(buffer));
+        if (bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t))) {
+            return result;
+        }
+
+        const std::uint64_t count = buffer[0] < m_OpenCount ? buffer[0] : m_OpenCount;
+        const std::uint64_t timeEnabled = buffer[1];
+        const std::uint64_t timeRunning = buffer[2];
+        if (timeRunning == 0) {
+            return result;
+        }
+
+        // Extrapolate if the PMU was shared with other groups for part of the interval
+        const double scale = static_cast<double>(timeEnabled) / static_cast<double>(timeRunning);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            const std::size_t event = static_cast<std::size_t>(m_ReadOrder[i]);
+            result.values[event] = static_cast<std::uint64_t>(static_cast<double>(buffer[3 + i]) * scale);
+            result.available[event] = true;
+        }
+        return result;
+    }
+
+#else
+
+    PerfCounters::PerfCounters() {
+        m_Descriptors.fill(-1);
+        m_UnavailableReason = "hardware counters are only supported on Linux";
+    }
+
+    PerfCounters::~PerfCounters() = default;
+
+    void PerfCounters::Start() {
+    }
+
+    PerfCounterValues PerfCounters::Stop() {
+        return {};
+    }
+
+#endif
+
+    bool PerfCounters::IsAvailable() const {
+        return m_Leader != -1;
+    }
+
+    const std::string& PerfCounters::GetUnavailableReason() const {
+        return m_UnavailableReason;
+    }
+
+} // namespace Benchmarks
@@ -0,0 +1,124 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Benchmarks {
+
+    /**
+     * @brief Hardware events that PerfCounters can collect.
+     */
+    enum class PerfEvent : std::uint8_t {
+        Cycles,
+        Instructions,
+        CacheMisses,
+        BranchMisses,
+        Count
+    };
+
+    /** Number of events in PerfEvent */
+    inline constexpr std::size_t PerfEventCount = static_cast<std::size_t>(PerfEvent::Count);
+
+    /**
+     * @brief Counter values read from a PerfCounters measurement.
+     *
+     * Events the hardware or kernel does not provide are marked unavailable.
+     */
+    struct PerfCounterValues {
+        /** Raw event counts, scaled up if the kernel had to multiplex counters */
+        std::array<std::uint64_t, PerfEventCount> values{};
+
+        /** Whether each event was measured */
+        std::array<bool, PerfEventCount> available{};
+
+        /**
+         * @brief Checks whether an event was measured.
+         */
+        [[nodiscard]] bool Has(PerfEvent event) const {
+            return available[static_cast<std::size_t>(event)];
+        }
+
+        /**
+         * @brief Gets the count of an event (0 if it was not measured).
+         */
+        [[nodiscard]] std::uint64_t Get(PerfEvent event) const {
+            return values[static_cast<std::size_t>(event)];
+        }
+    };
+
+    /**
+     * @class PerfCounters
+     * @brief Reads CPU cycles, instructions, cache misses and branch misses for the calling thread.
+     *
+     * Uses Linux perf_event_open with all events in one group, so they are scheduled onto the
+     * PMU together and describe the same interval. Only user-space events are counted, which
+     * works with the default perf_event_paranoid setting.
+     *
+     * On other platforms, or when the kernel or virtual machine does not expose hardware
+     * counters, IsAvailable returns false and Stop reports every event as unavailable. The
+     * harness keeps working and only reports timings.
+     */
+    class PerfCounters {
+    private:
+        /** File descriptor of each event, or -1 if it could not be opened */
+        std::array<int, PerfEventCount> m_Descriptors;
+
+        /** Descriptor of the group leader, or -1 if no event could be opened */
+        int m_Leader = -1;
+
+        /** Events in the order the kernel reports them in a group read */
+        std::array<PerfEvent, PerfEventCount> m_ReadOrder{};
+
+        /** Number of opened events */
+        std::size_t m_OpenCount = 0;
+
+        /** Why counters are unavailable, empty if at least one event was opened */
+        std::string m_UnavailableReason;
+
+    public:
+        /**
+         * @brief Opens the counters for the calling thread. They start disabled.
+         */
+        PerfCounters();
+
+        /**
+         * @brief Closes the counters.
+         */
+        ~PerfCounters();
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        /**
+         * @brief Checks whether at least one hardware event can be measured.
+         */
+        [[nodiscard]] bool IsAvailable() const;
+
+        /**
+         * @brief Gets a human-readable reason why counters are unavailable.
+         * @return The reason, or an empty string if counters are available
+         */
+        [[nodiscard]] const std::string& GetUnavailableReason() const;
+
+        /**
+         * @brief Resets and enables all counters.
+         */
+        void Start();
+
+        /**
+         * @brief Disables all counters and reads their values.
+         * @return Counts accumulated since the last Start
+         */
+        PerfCounterValues Stop();
+    };
+
+} // namespace Benchmarks
+
+#endif // PERF_COUNTERS_H
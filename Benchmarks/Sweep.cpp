@@ -0,0 +1,108 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Sweep.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+namespace Benchmarks {
+
+    namespace {
+
+        // L1, L2, last-level cache and DRAM sized working sets on typical server cores
+        constexpr std::size_t DefaultWorkingSets[] = {
+            16 * 1024,
+            256 * 1024,
+            4 * 1024 * 1024,
+            64 * 1024 * 1024
+        };
+
+        std::string SizeLabel(std::size_t bytes) {
+            if (bytes >= 1024 * 1024) {
+                return std::to_string(bytes / (1024 * 1024)) + " MiB";
+            }
+            return std::to_string(bytes / 1024) + " KiB";
+        }
+
+    } // namespace
+
+    ScalingSweep::ScalingSweep(BenchmarkRunner& runner, Math::WorkerPool& pool, const std::string& csvPath)
+        : m_Runner(runner), m_Pool(pool),
+          m_WorkingSetBytes(std::begin(DefaultWorkingSets), std::end(DefaultWorkingSets)) {
+        const std::size_t maxThreads = pool.GetThreadCount();
+        for (std::size_t threads = 1; threads < maxThreads; threads *= 2) {
+            m_ThreadCounts.push_back(threads);
+        }
+        m_ThreadCounts.push_back(maxThreads);
+
+        if (!csvPath.empty()) {
+            m_Csv.open(csvPath);
+            if (!m_Csv) {
+                throw std::runtime_error("Cannot open CSV file: " + csvPath);
+            }
+            m_Csv << "kernel,working_set_bytes,elements,threads,ns_per_element,melements_per_second\n";
+        }
+    }
+
+    const std::vector<std::size_t>& ScalingSweep::GetWorkingSetBytes() const {
+        return m_WorkingSetBytes;
+    }
+
+    const std::vector<std::size_t>& ScalingSweep::GetThreadCounts() const {
+        return m_ThreadCounts;
+    }
+
+    void ScalingSweep::Run(std::string_view name, std::size_t bytesPerElement,
+                           const std::function<SweepKernel(std::size_t)>& setup) {
+        if (!m_Runner.ShouldRun(name)) {
+            return;
+        }
+
+        // throughput[size][threads] in millions of elements per second
+        std::vector<std::vector<double>> throughput(m_WorkingSetBytes.size(),
+                                                    std::vector<double>(m_ThreadCounts.size(), 0.0));
+
+        for (std::size_t s = 0; s < m_WorkingSetBytes.size(); ++s) {
+            const SweepKernel kernel = setup(std::max<std::size_t>(1, m_WorkingSetBytes[s] / bytesPerElement));
+
+            for (std::size_t t = 0; t < m_ThreadCounts.size(); ++t) {
+                const std::size_t threads = m_ThreadCounts[t];
+                const std::string pointName = std::string(name) + " " + SizeLabel(m_WorkingSetBytes[s]) +
+                                              " x" + std::to_string(threads);
+
+                m_Runner.Run(pointName, kernel.elementCount, [&]() {
+                    m_Pool.ParallelFor(kernel.itemCount, threads, kernel.process);
+                });
+
+                const BenchmarkResult& result = m_Runner.GetResults().back();
+                throughput[s][t] = 1e3 / result.NanosecondsPerElement();
+
+                if (m_Csv.is_open()) {
+                    m_Csv << name << ',' << m_WorkingSetBytes[s] << ',' << kernel.elementCount << ',' << threads << ','
+                          << result.NanosecondsPerElement() << ',' << throughput[s][t] << '\n';
+                }
+            }
+        }
+
+        std::cout << "\n" << name << " throughput (M elements/s)\n"
+                  << std::left << std::setw(12) << "working set" << std::right;
+        for (std::size_t threads : m_ThreadCounts) {
+            std::cout << std::setw(12) << (std::to_string(threads) + " thr");
+        }
+        std::cout << "\n";
+        for (std::size_t s = 0; s < m_WorkingSetBytes.size(); ++s) {
+            std::cout << std::left << std::setw(12) << SizeLabel(m_WorkingSetBytes[s]) << std::right
+                      << std::fixed << std::setprecision(1);
+            for (double value : throughput[s]) {
+                std::cout << std::setw(12) << value;
+            }
+            std::cout << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+} // namespace Benchmarks
@@ -0,0 +1,92 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Math/WorkerPool.h"
+
+namespace Benchmarks {
+
+    /**
+     * @brief A batch kernel prepared for one working-set size.
+     *
+     * The kernel is split into itemCount independent items; process handles the items in
+     * [begin, end) and may be called concurrently for disjoint ranges. An item may cover
+     * several elements (e.g. a whole hierarchy), so elementCount is the number of elements
+     * one pass over all items processes.
+     */
+    struct SweepKernel {
+        std::size_t itemCount = 0;
+        std::size_t elementCount = 0;
+        std::function<void(std::size_t, std::size_t)> process;
+    };
+
+    /**
+     * @class ScalingSweep
+     * @brief Measures batch kernels over a range of working-set sizes and thread counts.
+     *
+     * Working sets go from a size that fits in L1 to one that only fits in DRAM. For every
+     * kernel the sweep prints a throughput table (millions of elements per second, one row
+     * per working set, one column per thread count), and optionally appends each point to
+     * a CSV file for plotting.
+     *
+     * Hardware counters, when enabled, only cover the calling thread.
+     */
+    class ScalingSweep {
+    private:
+        BenchmarkRunner& m_Runner;
+        Math::WorkerPool& m_Pool;
+
+        std::vector<std::size_t> m_WorkingSetBytes;
+        std::vector<std::size_t> m_ThreadCounts;
+
+        /** CSV output, only open when a path was given */
+        std::ofstream m_Csv;
+
+    public:
+        /**
+         * @brief Prepares a sweep over the default working sets and all thread counts of the pool.
+         *
+         * Thread counts are the powers of two below the pool size, plus the pool size itself.
+         *
+         * @param runner Runner that measures and reports every point
+         * @param pool Threads used by the kernels
+         * @param csvPath File the points are written to, or empty for no CSV output
+         * @throws std::runtime_error if the CSV file cannot be opened
+         */
+        ScalingSweep(BenchmarkRunner& runner, Math::WorkerPool& pool, const std::string& csvPath);
+
+        /**
+         * @brief Gets the working-set sizes in bytes.
+         */
+        [[nodiscard]] const std::vector<std::size_t>& GetWorkingSetBytes() const;
+
+        /**
+         * @brief Gets the measured thread counts.
+         */
+        [[nodiscard]] const std::vector<std::size_t>& GetThreadCounts() const;
+
+        /**
+         * @brief Measures a kernel at every working-set size and thread count.
+         *
+         * @param name Kernel name, matched against the runner's filter
+         * @param bytesPerElement Bytes of input and output touched per element
+         * @param setup Allocates the data for about the given number of elements and returns the kernel
+         */
+        void Run(std::string_view name, std::size_t bytesPerElement,
+                 const std::function<SweepKernel(std::size_t)>& setup);
+    };
+
+} // namespace Benchmarks
+
+#endif // SWEEP_H
@@ -0,0 +1,632 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Sweep.h"
+#include "Math/ClothSolver.h"
+#include "Math/CrowdSteering.h"
+#include "Math/FlowField.h"
+#include "Math/Matrix2DSimd.h"
+#include "Math/Matrix3D.h"
+#include "Math/Matrix4D.h"
+#include "Math/NavMesh.h"
+#include "Math/ParticleSystem.h"
+#include "Math/SphFluid.h"
+#include "Math/Trace.h"
+#include "Math/Transform2D.h"
+#include "Math/TransformHierarchy2D.h"
+#include "Math/WorkerPool.h"
+#include "Math/WorkloadTrace.h"
+
+using namespace Benchmarks;
+using namespace Math;
+
+namespace {
+
+    // Working sets sized to stay in L1 (12 KB of input) or spill well past the last-level cache (24 MB)
+    constexpr std::size_t L1Points = 1024;
+    constexpr std::size_t DramPoints = 2 * 1024 * 1024;
+
+    // Deterministic values in [-1, 1) so every run measures the same data
+    float NextValue(unsigned int& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1u << 23) - 1.0f;
+    }
+
+    std::vector<Vector3D> MakePoints3D(std::size_t count) {
+        unsigned int state = 1;
+        std::vector<Vector3D> points(count);
+        for (Vector3D& point : points) {
+            point = Vector3D(NextValue(state), NextValue(state), NextValue(state));
+        }
+        return points;
+    }
+
+    std::vector<Vector2D> MakePoints2D(std::size_t count) {
+        unsigned int state = 2;
+        std::vector<Vector2D> points(count);
+        for (Vector2D& point : points) {
+            point = Vector2D(NextValue(state), NextValue(state));
+        }
+        return points;
+    }
+
+    void RunMatrix4DBenchmarks(BenchmarkRunner& runner) {
+        const Matrix4D affine = Matrix4D::CreateTransformation(
+            Vector3D(1.0f, 2.0f, 3.0f), Vector3D(0.0f, 1.0f, 0.0f), 0.5f, Vector3D(2.0f, 2.0f, 2.0f));
+        const Matrix4D projective = Matrix4D::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) * affine;
+
+        // Matrix products over an array, one element per product
+        std::vector<Matrix4D> matrices(256, affine);
+        runner.Run("Matrix4D multiply (256)", matrices.size(), [&]() {
+            Matrix4D accumulated = Matrix4D::Identity();
+            for (const Matrix4D& matrix : matrices) {
+                accumulated = accumulated * matrix;
+            }
+            DoNotOptimize(accumulated);
+        });
+
+        const std::vector<Vector3D> l1Points = MakePoints3D(L1Points);
+        std::vector<Vector3D> l1Output(L1Points);
+        runner.Run("Matrix4D TransformPoints affine (L1)", L1Points, [&]() {
+            affine.TransformPoints(l1Points, l1Output);
+            DoNotOptimize(l1Output.data());
+        });
+        runner.Run("Matrix4D TransformPoints projective (L1)", L1Points, [&]() {
+            projective.TransformPoints(l1Points, l1Output);
+            DoNotOptimize(l1Output.data());
+        });
+        runner.Run("Matrix4D TransformVectors (L1)", L1Points, [&]() {
+            affine.TransformVectors(l1Points, l1Output);
+            DoNotOptimize(l1Output.data());
+        });
+
+        const std::vector<Vector3D> dramPoints = MakePoints3D(DramPoints);
+        std::vector<Vector3D> dramOutput(DramPoints);
+        runner.Run("Matrix4D TransformPoints affine (DRAM)", DramPoints, [&]() {
+            affine.TransformPoints(dramPoints, dramOutput);
+            DoNotOptimize(dramOutput.data());
+        });
+        runner.Run("Matrix4D TransformPoints projective (DRAM)", DramPoints, [&]() {
+            projective.TransformPoints(dramPoints, dramOutput);
+            DoNotOptimize(dramOutput.data());
+        });
+    }
+
+    void RunTransform2DBenchmarks(BenchmarkRunner& runner) {
+        const std::vector<Vector2D> points = MakePoints2D(2048);
+        std::vector<Vector2D> output(points.size());
+
+        const Matrix2D matrix(0.8f, -0.6f, 0.6f, 0.8f);
+        runner.Run("Simd::TransformVectors Matrix2D (2K)", points.size(), [&]() {
+            Simd::TransformVectors(matrix, points, output);
+            DoNotOptimize(output.data());
+        });
+
+        const Transform2D transform(Vector2D(3.0f, -2.0f), 0.75f, Vector2D(2.0f, 0.5f));
+        runner.Run("Transform2D TransformPoints (2K)", points.size(), [&]() {
+            transform.TransformPoints(points, output);
+            DoNotOptimize(output.data());
+        });
+    }
+
+    // Groups of sprites spread over a large world, all moving every frame. The scheduled update
+    // resolves distant groups every 2, 4 or 8 frames instead.
+    void RunHierarchyBenchmarks(BenchmarkRunner& runner) {
+        constexpr int GroupCount = 1024;
+        constexpr int SpritesPerGroup = 16;
+
+        TransformHierarchy2D hierarchy;
+        std::vector<Transform2DHandle> groups;
+        hierarchy.Reserve(GroupCount * (SpritesPerGroup + 1));
+        unsigned int state = 4;
+        for (int g = 0; g < GroupCount; ++g) {
+            groups.push_back(hierarchy.Create(Vector2D(NextValue(state) * 1000.0f, NextValue(state) * 1000.0f)));
+            for (int s = 0; s < SpritesPerGroup; ++s) {
+                hierarchy.Create(Vector2D(NextValue(state) * 5.0f, NextValue(state) * 5.0f), NextValue(state),
+                                 Vector2D(1.0f, 1.0f), groups.back());
+            }
+        }
+        hierarchy.UpdateWorldMatrices();
+
+        const Vector2D step(0.5f, 0.25f);
+        runner.Run("TransformHierarchy2D update (16K nodes)", hierarchy.Size(), [&]() {
+            for (Transform2DHandle group : groups) {
+                hierarchy.Translate(group, step);
+            }
+            hierarchy.UpdateWorldMatrices();
+        });
+
+        const float bands[] = {250.0f, 500.0f, 750.0f};
+        hierarchy.SetUpdatePeriodsByDistance(Vector2D(0.0f, 0.0f), bands);
+        std::uint64_t frame = 0;
+        runner.Run("TransformHierarchy2D scheduled update (16K nodes)", hierarchy.Size(), [&]() {
+            for (Transform2DHandle group : groups) {
+                hierarchy.Translate(group, step);
+            }
+            DoNotOptimize(hierarchy.UpdateWorldMatrices(frame++));
+        });
+
+        // Sprites spawned before the groups they attach to, so every link points forward in
+        // storage and needs a reorder: once per link with SetParent, once per batch with SetParents
+        constexpr int SpawnCount = 1024;
+        constexpr int SpawnGroupSize = 64;
+        auto spawnAndAttach = [](bool batched) {
+            TransformHierarchy2D scene;
+            scene.Reserve(SpawnCount + SpawnCount / SpawnGroupSize);
+            std::vector<Transform2DReparent> operations(SpawnCount);
+            for (int s = 0; s < SpawnCount; ++s) {
+                operations[s].child = scene.Create(Vector2D(static_cast<float>(s), 0.0f));
+            }
+            for (int s = 0; s < SpawnCount; ++s) {
+                operations[s].parent = s % SpawnGroupSize == 0 ? scene.Create() : operations[s - 1].parent;
+            }
+            if (batched) {
+                scene.SetParents(operations);
+            } else {
+                for (const Transform2DReparent& operation : operations) {
+                    scene.SetParent(operation.child, operation.parent);
+                }
+            }
+            DoNotOptimize(scene.GetIndex(operations[0].child));
+        };
+        runner.Run("TransformHierarchy2D spawn + SetParent (1K)", SpawnCount, [&]() { spawnAndAttach(false); });
+        runner.Run("TransformHierarchy2D spawn + SetParents (1K)", SpawnCount, [&]() { spawnAndAttach(true); });
+    }
+
+    // Runs a benchmark body on the calling thread alone, then on a pool of every allowed
+    // thread if there is more than one; the body gets the pool (nullptr for one thread) and
+    // the thread label for the benchmark's name
+    template <typename Body>
+    void RunWithAndWithoutPool(BenchmarkRunner& runner, Body&& body) {
+        const std::size_t threadCount = std::max<std::size_t>(
+            1, runner.GetOptions().maxThreads != 0 ? runner.GetOptions().maxThreads : std::thread::hardware_concurrency());
+        body(static_cast<WorkerPool*>(nullptr), std::string("1 thread"));
+        if (threadCount > 1) {
+            WorkerPool pool(threadCount);
+            body(&pool, std::to_string(threadCount) + " threads");
+        }
+    }
+
+    // A fountain of one million particles under gravity and two attractors; the emitter
+    // replaces expired particles, so the count stays near the capacity
+    void RunParticleBenchmarks(BenchmarkRunner& runner) {
+        constexpr std::size_t ParticleCount = 1 << 20;
+        RunWithAndWithoutPool(runner, [&](WorkerPool* updatePool, const std::string& threads) {
+            ParticleSystem system(ParticleCount);
+            ParticleEmitter emitter;
+            emitter.extent = Vector3D(1.0f, 0.0f, 1.0f);
+            emitter.velocity = Vector3D(0.0f, 8.0f, 0.0f);
+            emitter.velocitySpread = Vector3D(2.0f, 2.0f, 2.0f);
+            emitter.minLifetime = 1.0f;
+            emitter.maxLifetime = 3.0f;
+            emitter.rate = static_cast<float>(ParticleCount) / 2.0f;
+            system.Emit(system.AddEmitter(emitter), ParticleCount);
+            system.SetGravity(Vector3D(0.0f, -9.81f, 0.0f));
+            system.SetDrag(0.05f);
+            system.AddAttractor({Vector3D(5.0f, 4.0f, 0.0f), 20.0f, 1.0f});
+            system.AddAttractor({Vector3D(-5.0f, 4.0f, 0.0f), 20.0f, 1.0f});
+
+            runner.Run("ParticleSystem update (1M, " + threads + ")", ParticleCount, [&]() {
+                system.Update(1.0f / 60.0f, updatePool);
+                DoNotOptimize(system.GetCount());
+            });
+        });
+    }
+
+    // Steering forces of 20K agents spread at roughly one agent per 4 square units, a dense
+    // crowd where each agent sees a handful of neighbors
+    void RunCrowdSteeringBenchmarks(BenchmarkRunner& runner) {
+        constexpr std::size_t AgentCount = 20000;
+        const float extent = 140.0f;
+        std::vector<float> x(AgentCount), y(AgentCount), vx(AgentCount), vy(AgentCount);
+        std::vector<float> tx(AgentCount, 0.0f), ty(AgentCount, 0.0f);
+        unsigned int state = 11;
+        for (std::size_t i = 0; i < AgentCount; ++i) {
+            x[i] = NextValue(state) * extent;
+            y[i] = NextValue(state) * extent;
+            vx[i] = NextValue(state) * 3.0f;
+            vy[i] = NextValue(state) * 3.0f;
+        }
+        std::vector<float> fx(AgentCount), fy(AgentCount);
+        CrowdSteering steering;
+
+        RunWithAndWithoutPool(runner, [&](WorkerPool* steeringPool, const std::string& threads) {
+            runner.Run("CrowdSteering forces (20K, " + threads + ")", AgentCount, [&]() {
+                steering.ComputeForces({x, y, vx, vy, tx, ty}, fx, fy, steeringPool);
+                DoNotOptimize(fx.data());
+            });
+        });
+    }
+
+    // A 512x512 map with scattered walls and rough terrain: a full rebuild after the goal
+    // moves, and the incremental update after a small building is placed and removed
+    void RunFlowFieldBenchmarks(BenchmarkRunner& runner) {
+        constexpr std::uint32_t Size = 512;
+        constexpr std::size_t CellCount = static_cast<std::size_t>(Size) * Size;
+
+        FlowField field(Size, Size);
+        unsigned int state = 13;
+        for (std::size_t i = 0; i < CellCount / 8; ++i) {
+            const auto x = static_cast<std::uint32_t>((NextValue(state) + 1.0f) * 0.5f * (Size - 1));
+            const auto y = static_cast<std::uint32_t>((NextValue(state) + 1.0f) * 0.5f * (Size - 1));
+            field.SetCost(x, y, NextValue(state) < -0.5f ? FlowField::Impassable : 4);
+        }
+        field.SetCost(Size / 2, Size / 2, 1);
+
+        RunWithAndWithoutPool(runner, [&](WorkerPool* fieldPool, const std::string& threads) {
+            runner.Run("FlowField rebuild (512x512, " + threads + ")", CellCount, [&]() {
+                field.ClearGoals();
+                field.AddGoal(Size / 2, Size / 2);
+                DoNotOptimize(field.Update(fieldPool));
+            });
+            bool placed = false;
+            runner.Run("FlowField building toggle (512x512, " + threads + ")", CellCount, [&]() {
+                placed = !placed;
+                for (std::uint32_t y = 300; y < 304; ++y) {
+                    for (std::uint32_t x = 400; x < 404; ++x) {
+                        field.SetCost(x, y, placed ? FlowField::Impassable : 1);
+                    }
+                }
+                DoNotOptimize(field.Update(fieldPool));
+            });
+        });
+    }
+
+    // 1024 random path requests over a 128x128 mesh of unit squares with a fifth of the
+    // squares removed as obstacles
+    void RunNavMeshBenchmarks(BenchmarkRunner& runner) {
+        constexpr std::uint32_t Size = 128;
+        constexpr std::size_t RequestCount = 1024;
+
+        unsigned int state = 17;
+        std::vector<Vector2D> vertices;
+        for (std::uint32_t y = 0; y <= Size; ++y) {
+            for (std::uint32_t x = 0; x <= Size; ++x) {
+                vertices.emplace_back(static_cast<float>(x), static_cast<float>(y));
+            }
+        }
+        std::vector<std::uint32_t> sizes, indices;
+        for (std::uint32_t y = 0; y < Size; ++y) {
+            for (std::uint32_t x = 0; x < Size; ++x) {
+                if (NextValue(state) < -0.6f) {
+                    continue;
+                }
+                const std::uint32_t corner = y * (Size + 1) + x;
+                sizes.push_back(4);
+                indices.insert(indices.end(), {corner, corner + 1, corner + Size + 2, corner + Size + 1});
+            }
+        }
+        const NavMesh mesh(vertices, sizes, indices);
+
+        std::vector<NavPathRequest> requests(RequestCount);
+        for (NavPathRequest& request : requests) {
+            request.start = Vector2D((NextValue(state) + 1.0f) * 0.5f * Size, (NextValue(state) + 1.0f) * 0.5f * Size);
+            request.end = Vector2D((NextValue(state) + 1.0f) * 0.5f * Size, (NextValue(state) + 1.0f) * 0.5f * Size);
+        }
+        std::vector<std::vector<Vector2D>> paths(RequestCount);
+
+        RunWithAndWithoutPool(runner, [&](WorkerPool* pathPool, const std::string& threads) {
+            runner.Run("NavMesh FindPaths (1K requests, " + threads + ")", RequestCount, [&]() {
+                DoNotOptimize(mesh.FindPaths(requests, paths, pathPool));
+            });
+        });
+    }
+
+    // 16 cloths of 64x64 particles, pinned at two corners and draped over spheres: 65K
+    // particles and about 260K distance constraints at 8 iterations per step
+    void RunClothBenchmarks(BenchmarkRunner& runner) {
+        constexpr std::uint32_t ClothCount = 16;
+        constexpr std::uint32_t Resolution = 64;
+        constexpr std::size_t ParticleCount = static_cast<std::size_t>(ClothCount) * Resolution * Resolution;
+
+        RunWithAndWithoutPool(runner, [&](WorkerPool* clothPool, const std::string& threads) {
+            ClothSolver solver;
+            for (std::uint32_t cloth = 0; cloth < ClothCount; ++cloth) {
+                const Vector3D origin(static_cast<float>(cloth % 4) * 3.0f, 2.0f, static_cast<float>(cloth / 4) * 3.0f);
+                const std::uint32_t first = solver.AddCloth(origin, Vector3D(2.0f, 0.0f, 0.0f), Vector3D(0.0f, 0.0f, 2.0f),
+                                                            Resolution, Resolution);
+                solver.SetInverseMass(first, 0.0f);
+                solver.SetInverseMass(first + Resolution - 1, 0.0f);
+                solver.AddSphereCollider({origin + Vector3D(1.0f, -0.5f, 1.0f), 0.6f});
+            }
+            solver.AddPlaneCollider({Vector3D(0.0f, 1.0f, 0.0f), 0.0f});
+
+            runner.Run("ClothSolver step (16 x 64x64, " + threads + ")", ParticleCount, [&]() {
+                solver.Step(1.0f / 60.0f, clothPool);
+                DoNotOptimize(solver.GetPositionsY().data());
+            });
+        });
+    }
+
+    // A dam break of 99K particles at the default spacing, 0.3 seconds into the flow
+    void RunSphFluidBenchmarks(BenchmarkRunner& runner) {
+        RunWithAndWithoutPool(runner, [&](WorkerPool* fluidPool, const std::string& threads) {
+            SphFluid fluid(Vector3D(0.0f, 0.0f, 0.0f), Vector3D(5.0f, 2.0f, 3.0f));
+            const std::size_t particleCount =
+                fluid.AddBlock(Vector3D(0.0f, 0.0f, 0.0f), Vector3D(2.45f, 1.6f, 2.95f), 0.05f);
+            for (int step = 0; step < 100; ++step) {
+                fluid.Step(0.003f, fluidPool);
+            }
+
+            runner.Run("SphFluid step (99K, " + threads + ")", particleCount, [&]() {
+                fluid.Step(0.003f, fluidPool);
+                DoNotOptimize(fluid.GetPositionsY().data());
+            });
+        });
+    }
+
+    // Records a small game-like workload: sprites attached to moving groups, edited and queried
+    // every frame, plus the camera matrices of a 3D overlay
+    WorkloadTrace RecordBuiltInScene() {
+        constexpr int GroupCount = 32;
+        constexpr int SpritesPerGroup = 16;
+        constexpr int FrameCount = 60;
+
+        WorkloadRecorder recorder;
+        std::vector<Transform2D> groups(GroupCount);
+        std::vector<Transform2D> sprites(GroupCount * SpritesPerGroup);
+
+        unsigned int state = 3;
+        for (int g = 0; g < GroupCount; ++g) {
+            groups[g] = Transform2D(Vector2D(NextValue(state) * 100.0f, NextValue(state) * 100.0f));
+            recorder.RegisterTransform(groups[g]);
+        }
+        for (int s = 0; s < GroupCount * SpritesPerGroup; ++s) {
+            sprites[s] = Transform2D(Vector2D(NextValue(state) * 5.0f, NextValue(state) * 5.0f), NextValue(state));
+            recorder.RegisterTransform(sprites[s]);
+            recorder.SetParent(sprites[s], &groups[s / SpritesPerGroup]);
+        }
+
+        const Matrix4D projection = Matrix4D::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        for (int frame = 0; frame < FrameCount; ++frame) {
+            for (Transform2D& group : groups) {
+                recorder.Translate(group, Vector2D(0.5f, NextValue(state) * 0.1f));
+            }
+            for (int s = 0; s < GroupCount * SpritesPerGroup; ++s) {
+                if (s % 4 == frame % 4) {
+                    recorder.RotateRad(sprites[s], 0.02f);
+                }
+                recorder.GetWorldMatrix(sprites[s]);
+            }
+
+            // A few picking queries per frame
+            for (int query = 0; query < 8; ++query) {
+                const Transform2D& sprite = sprites[(frame * 8 + query) % sprites.size()];
+                recorder.InverseTransformPoint(sprite, Vector2D(NextValue(state) * 50.0f, NextValue(state) * 50.0f));
+            }
+
+            const Matrix4D view = Matrix4D::CreateLookAt(
+                Vector3D(0.1f * frame, 2.0f, 10.0f), Vector3D(0.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f));
+            const Matrix4D viewProjection = recorder.Multiply(projection, view);
+            recorder.Inverse(viewProjection);
+            for (int marker = 0; marker < 16; ++marker) {
+                recorder.TransformPoint(viewProjection, Vector3D(NextValue(state), NextValue(state), NextValue(state)));
+            }
+        }
+
+        return WorkloadTrace(recorder.GetData());
+    }
+
+    void RunReplayBenchmark(BenchmarkRunner& runner) {
+        const std::string& path = runner.GetOptions().tracePath;
+        const WorkloadTrace trace = path.empty() ? RecordBuiltInScene() : WorkloadTrace::Load(path);
+        const std::string name = path.empty() ? std::string("Replay built-in scene") : "Replay " + path;
+
+        // One element per replayed operation
+        runner.Run(name, trace.GetOperationCount(), [&]() {
+            DoNotOptimize(trace.Replay());
+        });
+    }
+
+    // Sweep kernels. Each setup allocates its data once per working-set size and returns a
+    // kernel that processes any sub-range of items independently.
+
+    SweepKernel MakePointTransformKernel(std::size_t elementCount) {
+        struct Data {
+            Matrix4D matrix;
+            std::vector<Vector3D> input;
+            std::vector<Vector3D> output;
+        };
+        auto data = std::make_shared<Data>();
+        data->matrix = Matrix4D::CreateTransformation(
+            Vector3D(1.0f, 2.0f, 3.0f), Vector3D(0.0f, 1.0f, 0.0f), 0.5f, Vector3D(2.0f, 2.0f, 2.0f));
+        data->input = MakePoints3D(elementCount);
+        data->output.resize(elementCount);
+
+        return {elementCount, elementCount, [data](std::size_t begin, std::size_t end) {
+            data->matrix.TransformPoints(std::span<const Vector3D>(data->input).subspan(begin, end - begin),
+                                         std::span<Vector3D>(data->output).subspan(begin, end - begin));
+        }};
+    }
+
+    SweepKernel MakeTransform2DKernel(std::size_t elementCount) {
+        struct Data {
+            Transform2D transform;
+            std::vector<Vector2D> input;
+            std::vector<Vector2D> output;
+        };
+        auto data = std::make_shared<Data>();
+        data->transform = Transform2D(Vector2D(3.0f, -2.0f), 0.75f, Vector2D(2.0f, 0.5f));
+        data->input = MakePoints2D(elementCount);
+        data->output.resize(elementCount);
+
+        return {elementCount, elementCount, [data](std::size_t begin, std::size_t end) {
+            data->transform.TransformPoints(std::span<const Vector2D>(data->input).subspan(begin, end - begin),
+                                            std::span<Vector2D>(data->output).subspan(begin, end - begin));
+        }};
+    }
+
+    // Independent scenes of TransformHierarchy2D: one root with a four-level tree below it.
+    // Every call rotates the roots, so the whole tree is dirty and gets recomputed.
+    SweepKernel MakeHierarchyUpdateKernel(std::size_t elementCount) {
+        constexpr std::size_t NodesPerScene = 1 + 4 + 16 + 64 + 256;
+        const std::size_t sceneCount = std::max<std::size_t>(1, elementCount / NodesPerScene);
+
+        struct Scene {
+            TransformHierarchy2D hierarchy;
+            Transform2DHandle root;
+            float angle = 0.0f;
+        };
+        auto scenes = std::make_shared<std::vector<Scene>>(sceneCount);
+        for (Scene& scene : *scenes) {
+            scene.hierarchy.Reserve(NodesPerScene);
+            scene.root = scene.hierarchy.Create();
+            std::vector<Transform2DHandle> level = {scene.root};
+            while (scene.hierarchy.Size() + level.size() * 4 <= NodesPerScene) {
+                std::vector<Transform2DHandle> next;
+                for (Transform2DHandle parent : level) {
+                    for (int child = 0; child < 4; ++child) {
+                        next.push_back(scene.hierarchy.Create(Vector2D(1.0f, 0.5f * child), 0.1f * child,
+                                                              Vector2D(1.0f, 1.0f), parent));
+                    }
+                }
+                level = std::move(next);
+            }
+            scene.hierarchy.UpdateWorldMatrices();
+        }
+
+        return {sceneCount, sceneCount * (*scenes)[0].hierarchy.Size(), [scenes](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                Scene& scene = (*scenes)[i];
+                scene.angle += 0.01f;
+                scene.hierarchy.SetRotationRad(scene.root, scene.angle);
+                scene.hierarchy.UpdateWorldMatrices();
+            }
+        }};
+    }
+
+    // Bounding spheres tested against the six planes of a view-projection frustum
+    SweepKernel MakeCullingKernel(std::size_t elementCount) {
+        struct Sphere {
+            Vector3D center;
+            float radius;
+        };
+        struct Plane {
+            Vector3D normal;
+            float distance;
+        };
+        struct Data {
+            Plane planes[6];
+            std::vector<Sphere> spheres;
+            std::vector<std::uint8_t> visible;
+        };
+
+        auto data = std::make_shared<Data>();
+        const Matrix4D viewProjection = Matrix4D::CreatePerspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) *
+            Matrix4D::CreateLookAt(Vector3D(0.0f, 0.0f, 5.0f), Vector3D(0.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f));
+
+        // Row 3 plus or minus rows 0, 1 and 2 of the matrix (Gribb-Hartmann)
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int side = 0; side < 2; ++side) {
+                const float sign = side == 0 ? 1.0f : -1.0f;
+                Plane& plane = data->planes[axis * 2 + side];
+                plane.normal = Vector3D(viewProjection.GetElement(3, 0) + sign * viewProjection.GetElement(axis, 0),
+                                        viewProjection.GetElement(3, 1) + sign * viewProjection.GetElement(axis, 1),
+                                        viewProjection.GetElement(3, 2) + sign * viewProjection.GetElement(axis, 2));
+                plane.distance = viewProjection.GetElement(3, 3) + sign * viewProjection.GetElement(axis, 3);
+                const float length = plane.normal.Length();
+                plane.normal = plane.normal * (1.0f / length);
+                plane.distance /= length;
+            }
+        }
+
+        const std::vector<Vector3D> centers = MakePoints3D(elementCount);
+        data->spheres.resize(elementCount);
+        for (std::size_t i = 0; i < elementCount; ++i) {
+            data->spheres[i] = {centers[i] * 10.0f, 0.5f};
+        }
+        data->visible.resize(elementCount);
+
+        return {elementCount, elementCount, [data](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const Sphere& sphere = data->spheres[i];
+                bool inside = true;
+                for (const Plane& plane : data->planes) {
+                    inside &= plane.normal.Dot(sphere.center) + plane.distance > -sphere.radius;
+                }
+                data->visible[i] = inside ? 1 : 0;
+            }
+        }};
+    }
+
+    // In-place normalization; after the first pass the vectors are unit length, which costs the same
+    SweepKernel MakeNormalizationKernel(std::size_t elementCount) {
+        auto vectors = std::make_shared<std::vector<Vector3D>>(MakePoints3D(elementCount));
+
+        return {elementCount, elementCount, [vectors](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                (*vectors)[i].Normalize();
+            }
+        }};
+    }
+
+    void RunSweeps(BenchmarkRunner& runner) {
+        const BenchmarkOptions& options = runner.GetOptions();
+        std::size_t threadCount = options.maxThreads;
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        WorkerPool pool(threadCount);
+        ScalingSweep sweep(runner, pool, options.csvPath);
+
+        sweep.Run("Sweep Matrix4D TransformPoints", 2 * sizeof(Vector3D), MakePointTransformKernel);
+        sweep.Run("Sweep Transform2D TransformPoints", 2 * sizeof(Vector2D), MakeTransform2DKernel);
+        sweep.Run("Sweep TransformHierarchy2D update",
+                  2 * sizeof(Vector2D) + sizeof(float) + 2 * sizeof(Matrix3D) + 3 * sizeof(std::uint32_t),
+                  MakeHierarchyUpdateKernel);
+        sweep.Run("Sweep Frustum culling", sizeof(Vector3D) + sizeof(float) + 1, MakeCullingKernel);
+        sweep.Run("Sweep Vector3D Normalize", sizeof(Vector3D), MakeNormalizationKernel);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        BenchmarkRunner runner(BenchmarkOptions::Parse(argc, argv));
+        const std::string& chromeTracePath = runner.GetOptions().chromeTracePath;
+        if (!chromeTracePath.empty()) {
+#if !defined(MATHENGINE_ENABLE_TRACING)
+            std::cout << "Library built without MATHENGINE_ENABLE_TRACING; the trace will be empty.\n";
+#endif
+            Trace::SetEnabled(true);
+        }
+
+        RunMatrix4DBenchmarks(runner);
+        RunTransform2DBenchmarks(runner);
+        RunHierarchyBenchmarks(runner);
+        RunParticleBenchmarks(runner);
+        RunCrowdSteeringBenchmarks(runner);
+        RunFlowFieldBenchmarks(runner);
+        RunNavMeshBenchmarks(runner);
+        RunClothBenchmarks(runner);
+        RunSphFluidBenchmarks(runner);
+        RunReplayBenchmark(runner);
+        if (runner.GetOptions().sweep) {
+            RunSweeps(runner);
+        }
+
+        if (!chromeTracePath.empty()) {
+            Trace::SetEnabled(false);
+            Trace::SaveChromeJson(chromeTracePath);
+            std::cout << "Wrote " << chromeTracePath << " (" << Trace::GetDroppedEventCount()
+                      << " events dropped after the per-thread buffers filled)\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,648 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "ClothSolver.h"
+#include "SimdConfig.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        // Work is handed out in blocks of four so the SSE2 loops see the same groups of
+        // four whatever the thread count, which keeps results identical across thread counts
+        constexpr std::size_t BlockSize = 4;
+
+        // Blocks per thread below which another thread does not pay off
+        constexpr std::size_t MinParticleBlocksPerThread = 1024;
+        constexpr std::size_t MinConstraintBlocksPerThread = 512;
+
+        template <typename Process>
+        void RunBlocks(WorkerPool* pool, std::size_t first, std::size_t last, std::size_t minBlocksPerThread,
+                       Process&& process) {
+            const std::size_t blockCount = (last - first + BlockSize - 1) / BlockSize;
+            if (pool != nullptr && blockCount > minBlocksPerThread) {
+                pool->ParallelForChunks(blockCount, minBlocksPerThread, [&](std::size_t begin, std::size_t end) {
+                    process(first + begin * BlockSize, std::min(first + end * BlockSize, last));
+                });
+            } else {
+                process(first, last);
+            }
+        }
+
+        // Greedy coloring: each constraint takes the lowest color that none of its particles
+        // is in yet. Each particle's colors are a bit set of the same number of 64-bit words,
+        // widened for every particle when a constraint finds all words full. The constraint streams
+        // are then reordered by color, keeping the order of the constraints within a color.
+        template <std::size_t ParticleStreams, std::size_t ValueStreams>
+        void SortByColor(const std::array<std::vector<std::uint32_t>*, ParticleStreams>& particles,
+                         const std::array<std::vector<float>*, ValueStreams>& values, std::size_t particleCount,
+                         std::vector<std::uint32_t>& colorStart) {
+            const std::size_t count = particles[0]->size();
+            std::size_t words = 1;
+            std::vector<std::uint64_t> usedColors(particleCount * words, 0);
+            std::vector<std::uint32_t> colors(count);
+            std::uint32_t colorCount = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                std::size_t word = 0;
+                std::uint64_t used = 0;
+                for (; word < words; ++word) {
+                    used = 0;
+                    for (const std::vector<std::uint32_t>* stream : particles) {
+                        used |= usedColors[(*stream)[i] * words + word];
+                    }
+                    if (used != ~std::uint64_t{0}) {
+                        break;
+                    }
+                }
+                if (word == words) {
+                    std::vector<std::uint64_t> wider(particleCount * words * 2, 0);
+                    for (std::size_t particle = 0; particle < particleCount; ++particle) {
+                        std::copy_n(usedColors.begin() + particle * words, words, wider.begin() + particle * words * 2);
+                    }
+                    usedColors.swap(wider);
+                    words *= 2;
+                    used = 0;
+                }
+                const auto color = static_cast<std::uint32_t>(word * 64 + std::countr_one(used));
+                for (const std::vector<std::uint32_t>* stream : particles) {
+                    usedColors[(*stream)[i] * words + word] |= std::uint64_t{1} << (color % 64);
+                }
+                colors[i] = color;
+                colorCount = std::max(colorCount, color + 1);
+            }
+
+            // Counting sort by color
+            colorStart.assign(colorCount + 1, 0);
+            for (const std::uint32_t color : colors) {
+                ++colorStart[color + 1];
+            }
+            for (std::uint32_t color = 0; color < colorCount; ++color) {
+                colorStart[color + 1] += colorStart[color];
+            }
+            std::vector<std::uint32_t> order(count);
+            std::vector<std::uint32_t> cursor(colorStart.begin(), colorStart.end() - 1);
+            for (std::size_t i = 0; i < count; ++i) {
+                order[cursor[colors[i]]++] = static_cast<std::uint32_t>(i);
+            }
+
+            auto permute = [&order](auto& stream) {
+                auto sorted = stream;
+                for (std::size_t i = 0; i < order.size(); ++i) {
+                    sorted[i] = stream[order[i]];
+                }
+                stream.swap(sorted);
+            };
+            for (std::vector<std::uint32_t>* stream : particles) {
+                permute(*stream);
+            }
+            for (std::vector<float>* stream : values) {
+                permute(*stream);
+            }
+        }
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        __m128 Gather(const float* data, const std::uint32_t* indices) {
+            return _mm_setr_ps(data[indices[0]], data[indices[1]], data[indices[2]], data[indices[3]]);
+        }
+
+        void Scatter(float* data, const std::uint32_t* indices, __m128 values) {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, values);
+            data[indices[0]] = lanes[0];
+            data[indices[1]] = lanes[1];
+            data[indices[2]] = lanes[2];
+            data[indices[3]] = lanes[3];
+        }
+#endif
+
+    } // namespace
+
+    // Particles
+
+    std::uint32_t ClothSolver::AddParticle(const Vector3D& position, float inverseMass) {
+        if (!(inverseMass >= 0.0f)) {
+            throw std::invalid_argument("Inverse mass must not be negative");
+        }
+        m_PositionX.push_back(position.x);
+        m_PositionY.push_back(position.y);
+        m_PositionZ.push_back(position.z);
+        m_PreviousX.push_back(position.x);
+        m_PreviousY.push_back(position.y);
+        m_PreviousZ.push_back(position.z);
+        m_InverseMass.push_back(inverseMass);
+        return static_cast<std::uint32_t>(m_InverseMass.size() - 1);
+    }
+
+    std::size_t ClothSolver::GetParticleCount() const {
+        return m_InverseMass.size();
+    }
+
+    void ClothSolver::CheckParticle(std::uint32_t particle) const {
+        if (particle >= m_InverseMass.size()) {
+            throw std::out_of_range("Particle index out of range");
+        }
+    }
+
+    void ClothSolver::CheckStiffness(float stiffness) {
+        if (!(stiffness >= 0.0f && stiffness <= 1.0f)) {
+            throw std::invalid_argument("Stiffness must be in [0, 1]");
+        }
+    }
+
+    Vector3D ClothSolver::PositionOf(std::uint32_t particle) const {
+        return Vector3D(m_PositionX[particle], m_PositionY[particle], m_PositionZ[particle]);
+    }
+
+    Vector3D ClothSolver::GetPosition(std::uint32_t particle) const {
+        CheckParticle(particle);
+        return PositionOf(particle);
+    }
+
+    void ClothSolver::SetPosition(std::uint32_t particle, const Vector3D& position) {
+        CheckParticle(particle);
+        m_PositionX[particle] = m_PreviousX[particle] = position.x;
+        m_PositionY[particle] = m_PreviousY[particle] = position.y;
+        m_PositionZ[particle] = m_PreviousZ[particle] = position.z;
+    }
+
+    void ClothSolver::SetInverseMass(std::uint32_t particle, float inverseMass) {
+        CheckParticle(particle);
+        if (!(inverseMass >= 0.0f)) {
+            throw std::invalid_argument("Inverse mass must not be negative");
+        }
+        m_InverseMass[particle] = inverseMass;
+    }
+
+    std::span<const float> ClothSolver::GetPositionsX() const {
+        return m_PositionX;
+    }
+
+    std::span<const float> ClothSolver::GetPositionsY() const {
+        return m_PositionY;
+    }
+
+    std::span<const float> ClothSolver::GetPositionsZ() const {
+        return m_PositionZ;
+    }
+
+    // Constraints
+
+    void ClothSolver::AddDistanceConstraint(std::uint32_t a, std::uint32_t b, float stiffness) {
+        CheckParticle(a);
+        CheckParticle(b);
+        CheckStiffness(stiffness);
+        if (a == b) {
+            throw std::invalid_argument("A constraint needs distinct particles");
+        }
+        m_DistanceA.push_back(a);
+        m_DistanceB.push_back(b);
+        m_DistanceRest.push_back((PositionOf(b) - PositionOf(a)).Length());
+        m_DistanceStiffness.push_back(stiffness);
+        m_ColorsDirty = true;
+    }
+
+    void ClothSolver::AddBendingConstraint(std::uint32_t b0, std::uint32_t v, std::uint32_t b1, float stiffness) {
+        CheckParticle(b0);
+        CheckParticle(v);
+        CheckParticle(b1);
+        CheckStiffness(stiffness);
+        if (b0 == v || b0 == b1 || v == b1) {
+            throw std::invalid_argument("A constraint needs distinct particles");
+        }
+        const Vector3D centroid = (PositionOf(b0) + PositionOf(b1) + PositionOf(v)) * (1.0f / 3.0f);
+        m_BendingB0.push_back(b0);
+        m_BendingV.push_back(v);
+        m_BendingB1.push_back(b1);
+        m_BendingRest.push_back((PositionOf(v) - centroid).Length());
+        m_BendingStiffness.push_back(stiffness);
+        m_ColorsDirty = true;
+    }
+
+    std::uint32_t ClothSolver::AddRope(const Vector3D& start, const Vector3D& end, std::uint32_t segments,
+                                       float stiffness, float bendingStiffness) {
+        if (segments == 0) {
+            throw std::invalid_argument("A rope needs at least one segment");
+        }
+        CheckStiffness(stiffness);
+        CheckStiffness(bendingStiffness);
+        const auto first = static_cast<std::uint32_t>(GetParticleCount());
+        for (std::uint32_t i = 0; i <= segments; ++i) {
+            AddParticle(start + (end - start) * (static_cast<float>(i) / static_cast<float>(segments)));
+        }
+        for (std::uint32_t i = 0; i < segments; ++i) {
+            AddDistanceConstraint(first + i, first + i + 1, stiffness);
+        }
+        if (bendingStiffness > 0.0f) {
+            for (std::uint32_t i = 1; i < segments; ++i) {
+                AddBendingConstraint(first + i - 1, first + i, first + i + 1, bendingStiffness);
+            }
+        }
+        return first;
+    }
+
+    std::uint32_t ClothSolver::AddCloth(const Vector3D& origin, const Vector3D& axisU, const Vector3D& axisV,
+                                        std::uint32_t columns, std::uint32_t rows, float stiffness,
+                                        float bendingStiffness) {
+        if (columns < 2 || rows < 2) {
+            throw std::invalid_argument("A cloth needs at least 2 x 2 particles");
+        }
+        CheckStiffness(stiffness);
+        CheckStiffness(bendingStiffness);
+        const auto first = static_cast<std::uint32_t>(GetParticleCount());
+        for (std::uint32_t row = 0; row < rows; ++row) {
+            for (std::uint32_t column = 0; column < columns; ++column) {
+                AddParticle(origin + axisU * (static_cast<float>(column) / static_cast<float>(columns - 1)) +
+                            axisV * (static_cast<float>(row) / static_cast<float>(rows - 1)));
+            }
+        }
+
+        auto at = [first, columns](std::uint32_t column, std::uint32_t row) { return first + row * columns + column; };
+        for (std::uint32_t row = 0; row < rows; ++row) {
+            for (std::uint32_t column = 0; column < columns; ++column) {
+                if (column + 1 < columns) {
+                    AddDistanceConstraint(at(column, row), at(column + 1, row), stiffness);
+                }
+                if (row + 1 < rows) {
+                    AddDistanceConstraint(at(column, row), at(column, row + 1), stiffness);
+                }
+                if (column + 1 < columns && row + 1 < rows) {
+                    AddDistanceConstraint(at(column, row), at(column + 1, row + 1), stiffness);
+                    AddDistanceConstraint(at(column + 1, row), at(column, row + 1), stiffness);
+                }
+            }
+        }
+        if (bendingStiffness > 0.0f) {
+            for (std::uint32_t row = 0; row < rows; ++row) {
+                for (std::uint32_t column = 0; column < columns; ++column) {
+                    if (column > 0 && column + 1 < columns) {
+                        AddBendingConstraint(at(column - 1, row), at(column, row), at(column + 1, row), bendingStiffness);
+                    }
+                    if (row > 0 && row + 1 < rows) {
+                        AddBendingConstraint(at(column, row - 1), at(column, row), at(column, row + 1), bendingStiffness);
+                    }
+                }
+            }
+        }
+        return first;
+    }
+
+    std::size_t ClothSolver::GetDistanceConstraintCount() const {
+        return m_DistanceA.size();
+    }
+
+    std::size_t ClothSolver::GetBendingConstraintCount() const {
+        return m_BendingV.size();
+    }
+
+    ClothDistanceConstraint ClothSolver::GetDistanceConstraint(std::size_t index) {
+        if (index >= m_DistanceA.size()) {
+            throw std::out_of_range("Constraint index out of range");
+        }
+        if (m_ColorsDirty) {
+            ColorConstraints();
+        }
+        const auto color = static_cast<std::uint32_t>(
+            std::upper_bound(m_DistanceColorStart.begin(), m_DistanceColorStart.end(), index) - m_DistanceColorStart.begin() - 1);
+        return {m_DistanceA[index], m_DistanceB[index], m_DistanceRest[index], m_DistanceStiffness[index], color};
+    }
+
+    std::size_t ClothSolver::GetColorCount() {
+        if (m_ColorsDirty) {
+            ColorConstraints();
+        }
+        return (m_DistanceColorStart.empty() ? 0 : m_DistanceColorStart.size() - 1) +
+               (m_BendingColorStart.empty() ? 0 : m_BendingColorStart.size() - 1);
+    }
+
+    void ClothSolver::ColorConstraints() {
+        SortByColor<2, 2>({&m_DistanceA, &m_DistanceB}, {&m_DistanceRest, &m_DistanceStiffness}, GetParticleCount(),
+                          m_DistanceColorStart);
+        SortByColor<3, 2>({&m_BendingB0, &m_BendingV, &m_BendingB1}, {&m_BendingRest, &m_BendingStiffness},
+                          GetParticleCount(), m_BendingColorStart);
+        m_ColorsDirty = false;
+    }
+
+    // Colliders and settings
+
+    void ClothSolver::AddSphereCollider(const ClothSphereCollider& sphere) {
+        m_Spheres.push_back(sphere);
+    }
+
+    void ClothSolver::AddPlaneCollider(const ClothPlaneCollider& plane) {
+        m_Planes.push_back(plane);
+    }
+
+    void ClothSolver::ClearColliders() {
+        m_Spheres.clear();
+        m_Planes.clear();
+    }
+
+    void ClothSolver::SetGravity(const Vector3D& gravity) {
+        m_Gravity = gravity;
+    }
+
+    void ClothSolver::SetDamping(float damping) {
+        if (!(damping >= 0.0f && damping <= 1.0f)) {
+            throw std::invalid_argument("Damping must be in [0, 1]");
+        }
+        m_Damping = damping;
+    }
+
+    void ClothSolver::SetCollisionMargin(float margin) {
+        m_CollisionMargin = margin;
+    }
+
+    void ClothSolver::SetIterations(std::uint32_t iterations) {
+        if (iterations == 0) {
+            throw std::invalid_argument("At least one iteration is needed");
+        }
+        m_Iterations = iterations;
+    }
+
+    // Simulation
+
+    void ClothSolver::Integrate(float deltaTime, std::size_t begin, std::size_t end) {
+        float* px = m_PositionX.data();
+        float* py = m_PositionY.data();
+        float* pz = m_PositionZ.data();
+        float* qx = m_PreviousX.data();
+        float* qy = m_PreviousY.data();
+        float* qz = m_PreviousZ.data();
+        const float* w = m_InverseMass.data();
+        const float keep = 1.0f - m_Damping;
+        const Vector3D step = m_Gravity * (deltaTime * deltaTime);
+        std::size_t i = begin;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        const __m128 keep4 = _mm_set1_ps(keep);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 step4[3] = {_mm_set1_ps(step.x), _mm_set1_ps(step.y), _mm_set1_ps(step.z)};
+        float* const positions[3] = {px, py, pz};
+        float* const previous[3] = {qx, qy, qz};
+        for (; i + 4 <= end; i += 4) {
+            // Pinned particles keep their position
+            const __m128 moving = _mm_cmpgt_ps(_mm_loadu_ps(w + i), zero);
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                const __m128 x = _mm_loadu_ps(positions[axis] + i);
+                const __m128 velocity = _mm_mul_ps(_mm_sub_ps(x, _mm_loadu_ps(previous[axis] + i)), keep4);
+                const __m128 moved = _mm_add_ps(_mm_add_ps(x, velocity), step4[axis]);
+                _mm_storeu_ps(previous[axis] + i, x);
+                _mm_storeu_ps(positions[axis] + i, _mm_or_ps(_mm_and_ps(moving, moved), _mm_andnot_ps(moving, x)));
+            }
+        }
+#endif
+
+        for (; i < end; ++i) {
+            const float x = px[i], y = py[i], z = pz[i];
+            if (w[i] > 0.0f) {
+                px[i] = (x + (x - qx[i]) * keep) + step.x;
+                py[i] = (y + (y - qy[i]) * keep) + step.y;
+                pz[i] = (z + (z - qz[i]) * keep) + step.z;
+            }
+            qx[i] = x;
+            qy[i] = y;
+            qz[i] = z;
+        }
+    }
+
+    void ClothSolver::SolveDistance(std::size_t begin, std::size_t end) {
+        float* px = m_PositionX.data();
+        float* py = m_PositionY.data();
+        float* pz = m_PositionZ.data();
+        const float* w = m_InverseMass.data();
+        const std::uint32_t* ia = m_DistanceA.data();
+        const std::uint32_t* ib = m_DistanceB.data();
+        std::size_t i = begin;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= end; i += 4) {
+            const __m128 ax = Gather(px, ia + i), ay = Gather(py, ia + i), az = Gather(pz, ia + i);
+            const __m128 bx = Gather(px, ib + i), by = Gather(py, ib + i), bz = Gather(pz, ib + i);
+            const __m128 wa = Gather(w, ia + i), wb = Gather(w, ib + i);
+            const __m128 dx = _mm_sub_ps(bx, ax), dy = _mm_sub_ps(by, ay), dz = _mm_sub_ps(bz, az);
+            const __m128 length = _mm_sqrt_ps(
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+            const __m128 weight = _mm_add_ps(wa, wb);
+
+            // Lanes with coincident or pinned particles are masked to no correction
+            const __m128 valid = _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_cmpgt_ps(weight, zero));
+            const __m128 scale = _mm_and_ps(valid, _mm_div_ps(
+                _mm_mul_ps(_mm_loadu_ps(m_DistanceStiffness.data() + i), _mm_sub_ps(length, _mm_loadu_ps(m_DistanceRest.data() + i))),
+                _mm_mul_ps(length, weight)));
+            const __m128 sa = _mm_mul_ps(wa, scale);
+            const __m128 sb = _mm_mul_ps(wb, scale);
+            Scatter(px, ia + i, _mm_add_ps(ax, _mm_mul_ps(sa, dx)));
+            Scatter(py, ia + i, _mm_add_ps(ay, _mm_mul_ps(sa, dy)));
+            Scatter(pz, ia + i, _mm_add_ps(az, _mm_mul_ps(sa, dz)));
+            Scatter(px, ib + i, _mm_sub_ps(bx, _mm_mul_ps(sb, dx)));
+            Scatter(py, ib + i, _mm_sub_ps(by, _mm_mul_ps(sb, dy)));
+            Scatter(pz, ib + i, _mm_sub_ps(bz, _mm_mul_ps(sb, dz)));
+        }
+#endif
+
+        for (; i < end; ++i) {
+            const std::uint32_t a = ia[i], b = ib[i];
+            const float dx = px[b] - px[a], dy = py[b] - py[a], dz = pz[b] - pz[a];
+            const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+            const float weight = w[a] + w[b];
+            if (!(length > 0.0f && weight > 0.0f)) {
+                continue;
+            }
+            const float scale = (m_DistanceStiffness[i] * (length - m_DistanceRest[i])) / (length * weight);
+            const float sa = w[a] * scale, sb = w[b] * scale;
+            px[a] += sa * dx;
+            py[a] += sa * dy;
+            pz[a] += sa * dz;
+            px[b] -= sb * dx;
+            py[b] -= sb * dy;
+            pz[b] -= sb * dz;
+        }
+    }
+
+    void ClothSolver::SolveBending(std::size_t begin, std::size_t end) {
+        float* px = m_PositionX.data();
+        float* py = m_PositionY.data();
+        float* pz = m_PositionZ.data();
+        const float* w = m_InverseMass.data();
+        const std::uint32_t* i0 = m_BendingB0.data();
+        const std::uint32_t* iv = m_BendingV.data();
+        const std::uint32_t* i1 = m_BendingB1.data();
+        constexpr float Third = 1.0f / 3.0f;
+        std::size_t i = begin;
+
+        // v moves towards the centroid of the triangle and b0 and b1 away from it, weighted
+        // so the centroid stays put
+#if defined(MATHENGINE_SIMD_SSE2)
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 four = _mm_set1_ps(4.0f);
+        const __m128 third = _mm_set1_ps(Third);
+        for (; i + 4 <= end; i += 4) {
+            const __m128 x0 = Gather(px, i0 + i), y0 = Gather(py, i0 + i), z0 = Gather(pz, i0 + i);
+            const __m128 xv = Gather(px, iv + i), yv = Gather(py, iv + i), zv = Gather(pz, iv + i);
+            const __m128 x1 = Gather(px, i1 + i), y1 = Gather(py, i1 + i), z1 = Gather(pz, i1 + i);
+            const __m128 w0 = Gather(w, i0 + i), wv = Gather(w, iv + i), w1 = Gather(w, i1 + i);
+            const __m128 hx = _mm_sub_ps(xv, _mm_mul_ps(_mm_add_ps(_mm_add_ps(x0, x1), xv), third));
+            const __m128 hy = _mm_sub_ps(yv, _mm_mul_ps(_mm_add_ps(_mm_add_ps(y0, y1), yv), third));
+            const __m128 hz = _mm_sub_ps(zv, _mm_mul_ps(_mm_add_ps(_mm_add_ps(z0, z1), zv), third));
+            const __m128 length = _mm_sqrt_ps(
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(hx, hx), _mm_mul_ps(hy, hy)), _mm_mul_ps(hz, hz)));
+            const __m128 weight = _mm_add_ps(_mm_add_ps(w0, w1), _mm_add_ps(wv, wv));
+
+            const __m128 valid = _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_cmpgt_ps(weight, zero));
+            const __m128 scale = _mm_and_ps(valid, _mm_div_ps(
+                _mm_mul_ps(_mm_loadu_ps(m_BendingStiffness.data() + i),
+                           _mm_sub_ps(one, _mm_div_ps(_mm_loadu_ps(m_BendingRest.data() + i), length))),
+                weight));
+            const __m128 s0 = _mm_mul_ps(_mm_mul_ps(two, w0), scale);
+            const __m128 s1 = _mm_mul_ps(_mm_mul_ps(two, w1), scale);
+            const __m128 sv = _mm_mul_ps(_mm_mul_ps(four, wv), scale);
+            Scatter(px, i0 + i, _mm_add_ps(x0, _mm_mul_ps(s0, hx)));
+            Scatter(py, i0 + i, _mm_add_ps(y0, _mm_mul_ps(s0, hy)));
+            Scatter(pz, i0 + i, _mm_add_ps(z0, _mm_mul_ps(s0, hz)));
+            Scatter(px, i1 + i, _mm_add_ps(x1, _mm_mul_ps(s1, hx)));
+            Scatter(py, i1 + i, _mm_add_ps(y1, _mm_mul_ps(s1, hy)));
+            Scatter(pz, i1 + i, _mm_add_ps(z1, _mm_mul_ps(s1, hz)));
+            Scatter(px, iv + i, _mm_sub_ps(xv, _mm_mul_ps(sv, hx)));
+            Scatter(py, iv + i, _mm_sub_ps(yv, _mm_mul_ps(sv, hy)));
+            Scatter(pz, iv + i, _mm_sub_ps(zv, _mm_mul_ps(sv, hz)));
+        }
+#endif
+
+        for (; i < end; ++i) {
+            const std::uint32_t b0 = i0[i], v = iv[i], b1 = i1[i];
+            const float hx = px[v] - ((px[b0] + px[b1]) + px[v]) * Third;
+            const float hy = py[v] - ((py[b0] + py[b1]) + py[v]) * Third;
+            const float hz = pz[v] - ((pz[b0] + pz[b1]) + pz[v]) * Third;
+            const float length = std::sqrt(hx * hx + hy * hy + hz * hz);
+            const float weight = (w[b0] + w[b1]) + (w[v] + w[v]);
+            if (!(length > 0.0f && weight > 0.0f)) {
+                continue;
+            }
+            const float scale = (m_BendingStiffness[i] * (1.0f - m_BendingRest[i] / length)) / weight;
+            const float s0 = (2.0f * w[b0]) * scale, s1 = (2.0f * w[b1]) * scale, sv = (4.0f * w[v]) * scale;
+            px[b0] += s0 * hx;
+            py[b0] += s0 * hy;
+            pz[b0] += s0 * hz;
+            px[b1] += s1 * hx;
+            py[b1] += s1 * hy;
+            pz[b1] += s1 * hz;
+            px[v] -= sv * hx;
+            py[v] -= sv * hy;
+            pz[v] -= sv * hz;
+        }
+    }
+
+    void ClothSolver::SolveCollisions(std::size_t begin, std::size_t end) {
+        float* px = m_PositionX.data();
+        float* py = m_PositionY.data();
+        float* pz = m_PositionZ.data();
+        const float* w = m_InverseMass.data();
+        std::size_t i = begin;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= end; i += 4) {
+            __m128 x = _mm_loadu_ps(px + i), y = _mm_loadu_ps(py + i), z = _mm_loadu_ps(pz + i);
+            const __m128 moving = _mm_cmpgt_ps(_mm_loadu_ps(w + i), zero);
+            for (const ClothPlaneCollider& plane : m_Planes) {
+                const __m128 nx = _mm_set1_ps(plane.normal.x), ny = _mm_set1_ps(plane.normal.y), nz = _mm_set1_ps(plane.normal.z);
+                const __m128 depth = _mm_sub_ps(
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, x), _mm_mul_ps(ny, y)), _mm_mul_ps(nz, z)),
+                    _mm_set1_ps(plane.offset + m_CollisionMargin));
+                const __m128 push = _mm_and_ps(_mm_and_ps(moving, _mm_cmplt_ps(depth, zero)), depth);
+                x = _mm_sub_ps(x, _mm_mul_ps(nx, push));
+                y = _mm_sub_ps(y, _mm_mul_ps(ny, push));
+                z = _mm_sub_ps(z, _mm_mul_ps(nz, push));
+            }
+            for (const ClothSphereCollider& sphere : m_Spheres) {
+                const __m128 cx = _mm_set1_ps(sphere.center.x), cy = _mm_set1_ps(sphere.center.y), cz = _mm_set1_ps(sphere.center.z);
+                const __m128 dx = _mm_sub_ps(x, cx), dy = _mm_sub_ps(y, cy), dz = _mm_sub_ps(z, cz);
+                const __m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                const float radius = sphere.radius + m_CollisionMargin;
+                const __m128 inside = _mm_and_ps(
+                    moving, _mm_and_ps(_mm_cmplt_ps(distance2, _mm_set1_ps(radius * radius)), _mm_cmpgt_ps(distance2, zero)));
+                if (_mm_movemask_ps(inside) == 0) {
+                    continue;
+                }
+                const __m128 scale = _mm_div_ps(_mm_set1_ps(radius), _mm_sqrt_ps(distance2));
+                x = _mm_or_ps(_mm_and_ps(inside, _mm_add_ps(cx, _mm_mul_ps(dx, scale))), _mm_andnot_ps(inside, x));
+                y = _mm_or_ps(_mm_and_ps(inside, _mm_add_ps(cy, _mm_mul_ps(dy, scale))), _mm_andnot_ps(inside, y));
+                z = _mm_or_ps(_mm_and_ps(inside, _mm_add_ps(cz, _mm_mul_ps(dz, scale))), _mm_andnot_ps(inside, z));
+            }
+            _mm_storeu_ps(px + i, x);
+            _mm_storeu_ps(py + i, y);
+            _mm_storeu_ps(pz + i, z);
+        }
+#endif
+
+        for (; i < end; ++i) {
+            if (!(w[i] > 0.0f)) {
+                continue;
+            }
+            float x = px[i], y = py[i], z = pz[i];
+            for (const ClothPlaneCollider& plane : m_Planes) {
+                const float depth = (plane.normal.x * x + plane.normal.y * y + plane.normal.z * z) -
+                                    (plane.offset + m_CollisionMargin);
+                if (depth < 0.0f) {
+                    x -= plane.normal.x * depth;
+                    y -= plane.normal.y * depth;
+                    z -= plane.normal.z * depth;
+                }
+            }
+            for (const ClothSphereCollider& sphere : m_Spheres) {
+                const float dx = x - sphere.center.x, dy = y - sphere.center.y, dz = z - sphere.center.z;
+                const float distance2 = dx * dx + dy * dy + dz * dz;
+                const float radius = sphere.radius + m_CollisionMargin;
+                if (distance2 < radius * radius && distance2 > 0.0f) {
+                    const float scale = radius / std::sqrt(distance2);
+                    x = sphere.center.x + dx * scale;
+                    y = sphere.center.y + dy * scale;
+                    z = sphere.center.z + dz * scale;
+                }
+            }
+            px[i] = x;
+            py[i] = y;
+            pz[i] = z;
+        }
+    }
+
+    void ClothSolver::Step(float deltaTime, WorkerPool* pool) {
+        MATH_TRACE_SCOPE("ClothSolver::Step");
+        if (m_ColorsDirty) {
+            ColorConstraints();
+        }
+
+        const std::size_t particleCount = GetParticleCount();
+        RunBlocks(pool, 0, particleCount, MinParticleBlocksPerThread, [&](std::size_t begin, std::size_t end) {
+            Integrate(deltaTime, begin, end);
+        });
+
+        const bool colliders = !m_Spheres.empty() || !m_Planes.empty();
+        for (std::uint32_t iteration = 0; iteration < m_Iterations; ++iteration) {
+            for (std::size_t color = 0; color + 1 < m_DistanceColorStart.size(); ++color) {
+                RunBlocks(pool, m_DistanceColorStart[color], m_DistanceColorStart[color + 1], MinConstraintBlocksPerThread,
+                          [this](std::size_t begin, std::size_t end) { SolveDistance(begin, end); });
+            }
+            for (std::size_t color = 0; color + 1 < m_BendingColorStart.size(); ++color) {
+                RunBlocks(pool, m_BendingColorStart[color], m_BendingColorStart[color + 1], MinConstraintBlocksPerThread,
+                          [this](std::size_t begin, std::size_t end) { SolveBending(begin, end); });
+            }
+            if (colliders) {
+                RunBlocks(pool, 0, particleCount, MinParticleBlocksPerThread,
+                          [this](std::size_t begin, std::size_t end) { SolveCollisions(begin, end); });
+            }
+        }
+    }
+
+} // namespace Math
@@ -0,0 +1,250 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef CLOTH_SOLVER_H
+#define CLOTH_SOLVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "MathFwd.h"
+#include "Vector3D.h"
+
+namespace Math {
+
+    /**
+     * @brief Sphere that particles are pushed out of.
+     */
+    struct ClothSphereCollider {
+        Vector3D center = Vector3D(0.0f, 0.0f, 0.0f);
+        float radius = 1.0f;
+    };
+
+    /**
+     * @brief Half-space boundary; particles are kept where dot(normal, p) >= offset.
+     */
+    struct ClothPlaneCollider {
+        /** Unit normal pointing to the allowed side */
+        Vector3D normal = Vector3D(0.0f, 1.0f, 0.0f);
+        float offset = 0.0f;
+    };
+
+    /**
+     * @brief A distance constraint as stored by the solver, for inspection and debug drawing.
+     */
+    struct ClothDistanceConstraint {
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        float restLength = 0.0f;
+        float stiffness = 1.0f;
+
+        /** Color group; constraints of one color share no particle */
+        std::uint32_t color = 0;
+    };
+
+    /**
+     * @class ClothSolver
+     * @brief Position-based dynamics for cloth and ropes: Verlet integration with distance, bending and collision constraints.
+     *
+     * Particles are stored as separate position, previous position and inverse mass streams;
+     * a particle with inverse mass 0 is pinned. Each Step integrates the particles, then
+     * projects the constraints for a number of iterations:
+     * - Distance constraints keep two particles at their rest length.
+     * - Bending constraints keep a particle at its rest distance from the centroid of itself
+     *   and two neighbors (Kelager's triangle bending), which resists folding without the
+     *   cost of dihedral angles.
+     * - Collisions push particles out of spheres and behind planes, plus a margin.
+     *
+     * Constraints are sorted into colors so that no two constraints of a color share a
+     * particle. Constraints of a color are then independent: they are projected four at a
+     * time with SSE2 and split between the threads of an optional WorkerPool, while the
+     * colors run one after the other (Gauss-Seidel). The result does not depend on the
+     * thread count. A particle in n constraints of one kind needs n colors of that kind, so
+     * many ropes hanging from one anchor cost colors (and passes) but are not limited.
+     *
+     * Stiffness is the fraction of the error corrected per iteration, so the effective
+     * stiffness also grows with the iteration count.
+     */
+    class ClothSolver {
+    private:
+        // Particles
+        std::vector<float> m_PositionX, m_PositionY, m_PositionZ;
+        std::vector<float> m_PreviousX, m_PreviousY, m_PreviousZ;
+        std::vector<float> m_InverseMass;
+
+        // Distance constraints, sorted by color once colored
+        std::vector<std::uint32_t> m_DistanceA, m_DistanceB;
+        std::vector<float> m_DistanceRest, m_DistanceStiffness;
+        std::vector<std::uint32_t> m_DistanceColorStart;
+
+        // Bending constraints (b0, v, b1), sorted by color once colored
+        std::vector<std::uint32_t> m_BendingB0, m_BendingV, m_BendingB1;
+        std::vector<float> m_BendingRest, m_BendingStiffness;
+        std::vector<std::uint32_t> m_BendingColorStart;
+
+        bool m_ColorsDirty = false;
+
+        std::vector<ClothSphereCollider> m_Spheres;
+        std::vector<ClothPlaneCollider> m_Planes;
+        Vector3D m_Gravity = Vector3D(0.0f, -9.81f, 0.0f);
+        float m_Damping = 0.01f;
+        float m_CollisionMargin = 0.01f;
+        std::uint32_t m_Iterations = 8;
+
+        [[nodiscard]] Vector3D PositionOf(std::uint32_t particle) const;
+        void CheckParticle(std::uint32_t particle) const;
+        static void CheckStiffness(float stiffness);
+
+        /**
+         * @brief Sorts the constraints of both kinds by color.
+         */
+        void ColorConstraints();
+
+        void Integrate(float deltaTime, std::size_t begin, std::size_t end);
+        void SolveDistance(std::size_t begin, std::size_t end);
+        void SolveBending(std::size_t begin, std::size_t end);
+        void SolveCollisions(std::size_t begin, std::size_t end);
+
+    public:
+        ClothSolver() = default;
+
+        // Particles
+
+        /**
+         * @brief Adds a particle at rest.
+         * @param position Initial position
+         * @param inverseMass 1 / mass; 0 pins the particle in place
+         * @return The index of the particle
+         * @throws std::invalid_argument if inverseMass is negative
+         */
+        std::uint32_t AddParticle(const Vector3D& position, float inverseMass = 1.0f);
+
+        [[nodiscard]] std::size_t GetParticleCount() const;
+
+        /**
+         * @brief Gets a particle's position.
+         * @throws std::out_of_range if the particle does not exist
+         */
+        [[nodiscard]] Vector3D GetPosition(std::uint32_t particle) const;
+
+        /**
+         * @brief Moves a particle without giving it velocity, e.g. to drag a pinned corner.
+         * @throws std::out_of_range if the particle does not exist
+         */
+        void SetPosition(std::uint32_t particle, const Vector3D& position);
+
+        /**
+         * @brief Sets a particle's inverse mass; 0 pins it.
+         * @throws std::out_of_range if the particle does not exist
+         * @throws std::invalid_argument if inverseMass is negative
+         */
+        void SetInverseMass(std::uint32_t particle, float inverseMass);
+
+        [[nodiscard]] std::span<const float> GetPositionsX() const;
+        [[nodiscard]] std::span<const float> GetPositionsY() const;
+        [[nodiscard]] std::span<const float> GetPositionsZ() const;
+
+        // Constraints
+
+        /**
+         * @brief Keeps two particles at their current distance.
+         * @param stiffness Fraction of the error corrected per iteration, in [0, 1]
+         * @throws std::out_of_range if a particle does not exist
+         * @throws std::invalid_argument if a and b are the same particle or stiffness is outside [0, 1]
+         */
+        void AddDistanceConstraint(std::uint32_t a, std::uint32_t b, float stiffness = 1.0f);
+
+        /**
+         * @brief Keeps v at its current distance from the centroid of b0, v and b1.
+         * @param stiffness Fraction of the error corrected per iteration, in [0, 1]
+         * @throws std::out_of_range if a particle does not exist
+         * @throws std::invalid_argument if two particles are the same or stiffness is outside [0, 1]
+         */
+        void AddBendingConstraint(std::uint32_t b0, std::uint32_t v, std::uint32_t b1, float stiffness = 0.5f);
+
+        /**
+         * @brief Adds a rope of particles from start to end, linked by distance and bending constraints.
+         * @param segments Number of links; the rope has segments + 1 particles
+         * @param stiffness Stiffness of the links
+         * @param bendingStiffness Stiffness of the bending constraints, 0 for none
+         * @return The index of the first particle (at start)
+         * @throws std::invalid_argument if segments is 0 or a stiffness is outside [0, 1]
+         */
+        std::uint32_t AddRope(const Vector3D& start, const Vector3D& end, std::uint32_t segments,
+                              float stiffness = 1.0f, float bendingStiffness = 0.0f);
+
+        /**
+         * @brief Adds a rectangular cloth of columns x rows particles.
+         *
+         * Particle (column, row) starts at origin + axisU * column / (columns - 1) +
+         * axisV * row / (rows - 1) and has index first + row * columns + column. Neighbors
+         * along rows and columns and across each quad's diagonals are linked by distance
+         * constraints, and runs of three along rows and columns by bending constraints.
+         *
+         * @param origin Position of particle (0, 0)
+         * @param axisU Edge from particle (0, 0) to particle (columns - 1, 0)
+         * @param axisV Edge from particle (0, 0) to particle (0, rows - 1)
+         * @param stiffness Stiffness of the distance constraints
+         * @param bendingStiffness Stiffness of the bending constraints, 0 for none
+         * @return The index of the first particle
+         * @throws std::invalid_argument if columns or rows is below 2 or a stiffness is outside [0, 1]
+         */
+        std::uint32_t AddCloth(const Vector3D& origin, const Vector3D& axisU, const Vector3D& axisV,
+                               std::uint32_t columns, std::uint32_t rows, float stiffness = 1.0f,
+                               float bendingStiffness = 0.1f);
+
+        [[nodiscard]] std::size_t GetDistanceConstraintCount() const;
+        [[nodiscard]] std::size_t GetBendingConstraintCount() const;
+
+        /**
+         * @brief Gets a distance constraint in solving order.
+         * @throws std::out_of_range if the constraint does not exist
+         */
+        [[nodiscard]] ClothDistanceConstraint GetDistanceConstraint(std::size_t index);
+
+        /**
+         * @brief Gets the number of colors of the distance and bending constraints together.
+         */
+        [[nodiscard]] std::size_t GetColorCount();
+
+        // Colliders and settings
+
+        void AddSphereCollider(const ClothSphereCollider& sphere);
+        void AddPlaneCollider(const ClothPlaneCollider& plane);
+        void ClearColliders();
+
+        void SetGravity(const Vector3D& gravity);
+
+        /**
+         * @brief Sets the fraction of velocity removed per step, in [0, 1].
+         * @throws std::invalid_argument if damping is outside [0, 1]
+         */
+        void SetDamping(float damping);
+
+        /**
+         * @brief Sets the distance particles are kept from colliders.
+         */
+        void SetCollisionMargin(float margin);
+
+        /**
+         * @brief Sets the number of constraint iterations per step.
+         * @throws std::invalid_argument if iterations is 0
+         */
+        void SetIterations(std::uint32_t iterations);
+
+        // Simulation
+
+        /**
+         * @brief Advances the simulation.
+         * @param deltaTime Step length in seconds; a fixed step keeps Verlet integration stable
+         * @param pool Optional worker pool to split particles and each color's constraints between threads
+         */
+        void Step(float deltaTime, WorkerPool* pool = nullptr);
+    };
+
+} // namespace Math
+
+#endif // CLOTH_SOLVER_H
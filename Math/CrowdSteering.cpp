@@ -0,0 +1,383 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "CrowdSteering.h"
+#include "SimdConfig.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        // Cells allowed per point before the grid enlarges its cells
+        constexpr std::size_t MaxCellsPerPoint = 4;
+
+        // Agents per thread below which another thread does not pay off
+        constexpr std::size_t MinAgentsPerThread = 1024;
+
+        // Neighbor sums of one agent
+        struct NeighborSums {
+            float count = 0.0f;
+            float positionX = 0.0f;
+            float positionY = 0.0f;
+            float velocityX = 0.0f;
+            float velocityY = 0.0f;
+            float separationX = 0.0f;
+            float separationY = 0.0f;
+        };
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        float HorizontalSum(__m128 value) {
+            const __m128 pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+            return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+        }
+#endif
+
+        // Adds the agents at sorted indices [begin, end) that lie within the radii
+        void AccumulateNeighbors(float x, float y, const float* sortedX, const float* sortedY,
+                                 const float* sortedVx, const float* sortedVy, std::size_t begin, std::size_t end,
+                                 float neighborRadius2, float separationRadius2, NeighborSums& sums) {
+            std::size_t j = begin;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 px = _mm_set1_ps(x);
+            const __m128 py = _mm_set1_ps(y);
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 radius2 = _mm_set1_ps(neighborRadius2);
+            const __m128 separation2 = _mm_set1_ps(separationRadius2);
+            const __m128 tiny = _mm_set1_ps(std::numeric_limits<float>::min());
+            __m128 count = zero, sumX = zero, sumY = zero, sumVx = zero, sumVy = zero, sepX = zero, sepY = zero;
+
+            for (; j + 4 <= end; j += 4) {
+                const __m128 nx = _mm_loadu_ps(sortedX + j);
+                const __m128 ny = _mm_loadu_ps(sortedY + j);
+                const __m128 dx = _mm_sub_ps(px, nx);
+                const __m128 dy = _mm_sub_ps(py, ny);
+                const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+                // Coincident agents (including the agent itself) are skipped
+                const __m128 valid = _mm_cmpgt_ps(d2, zero);
+                const __m128 inRange = _mm_and_ps(_mm_cmplt_ps(d2, radius2), valid);
+                const __m128 inSeparation = _mm_and_ps(_mm_cmplt_ps(d2, separation2), valid);
+
+                count = _mm_add_ps(count, _mm_and_ps(inRange, one));
+                sumX = _mm_add_ps(sumX, _mm_and_ps(inRange, nx));
+                sumY = _mm_add_ps(sumY, _mm_and_ps(inRange, ny));
+                sumVx = _mm_add_ps(sumVx, _mm_and_ps(inRange, _mm_loadu_ps(sortedVx + j)));
+                sumVy = _mm_add_ps(sumVy, _mm_and_ps(inRange, _mm_loadu_ps(sortedVy + j)));
+
+                const __m128 inverse = _mm_div_ps(one, _mm_max_ps(d2, tiny));
+                sepX = _mm_add_ps(sepX, _mm_and_ps(inSeparation, _mm_mul_ps(dx, inverse)));
+                sepY = _mm_add_ps(sepY, _mm_and_ps(inSeparation, _mm_mul_ps(dy, inverse)));
+            }
+
+            sums.count += HorizontalSum(count);
+            sums.positionX += HorizontalSum(sumX);
+            sums.positionY += HorizontalSum(sumY);
+            sums.velocityX += HorizontalSum(sumVx);
+            sums.velocityY += HorizontalSum(sumVy);
+            sums.separationX += HorizontalSum(sepX);
+            sums.separationY += HorizontalSum(sepY);
+#endif
+
+            for (; j < end; ++j) {
+                const float dx = x - sortedX[j];
+                const float dy = y - sortedY[j];
+                const float d2 = dx * dx + dy * dy;
+                if (d2 <= 0.0f) {
+                    continue;
+                }
+                if (d2 < neighborRadius2) {
+                    sums.count += 1.0f;
+                    sums.positionX += sortedX[j];
+                    sums.positionY += sortedY[j];
+                    sums.velocityX += sortedVx[j];
+                    sums.velocityY += sortedVy[j];
+                }
+                if (d2 < separationRadius2) {
+                    sums.separationX += dx / d2;
+                    sums.separationY += dy / d2;
+                }
+            }
+        }
+
+        // Force that turns the velocity towards a direction at full speed, clamped to maxForce
+        Vector2D SteerTowards(float directionX, float directionY, float velocityX, float velocityY,
+                              float maxSpeed, float maxForce) {
+            const float length = std::sqrt(directionX * directionX + directionY * directionY);
+            if (length <= 0.0f) {
+                return Vector2D(0.0f, 0.0f);
+            }
+            const float scale = maxSpeed / length;
+            float forceX = directionX * scale - velocityX;
+            float forceY = directionY * scale - velocityY;
+            const float force = std::sqrt(forceX * forceX + forceY * forceY);
+            if (force > maxForce) {
+                forceX *= maxForce / force;
+                forceY *= maxForce / force;
+            }
+            return Vector2D(forceX, forceY);
+        }
+
+    } // namespace
+
+    // NeighborGrid2D
+
+    void NeighborGrid2D::Build(std::span<const float> xs, std::span<const float> ys, float cellSize) {
+        if (xs.size() != ys.size()) {
+            throw std::invalid_argument("Coordinate spans must have the same size");
+        }
+        if (!(cellSize > 0.0f) || !std::isfinite(cellSize)) {
+            throw std::invalid_argument("Cell size must be positive and finite");
+        }
+
+        const std::size_t count = xs.size();
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+        if (count > 0) {
+            minX = maxX = xs[0];
+            minY = maxY = ys[0];
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+                    throw std::invalid_argument("Point coordinates must be finite");
+                }
+                minX = std::min(minX, xs[i]);
+                maxX = std::max(maxX, xs[i]);
+                minY = std::min(minY, ys[i]);
+                maxY = std::max(maxY, ys[i]);
+            }
+        }
+
+        // Enlarge the cells until the grid has at most MaxCellsPerPoint cells per point
+        // In double precision, so extents near the float range cannot overflow
+        const std::size_t maxCells = MaxCellsPerPoint * count + 16;
+        const double width = static_cast<double>(maxX) - minX;
+        const double height = static_cast<double>(maxY) - minY;
+        double size = cellSize;
+        while (true) {
+            const double columns = std::floor(width / size) + 1.0;
+            const double rows = std::floor(height / size) + 1.0;
+            if (columns * rows <= static_cast<double>(maxCells)) {
+                m_Columns = static_cast<std::uint32_t>(columns);
+                m_Rows = static_cast<std::uint32_t>(rows);
+                break;
+            }
+            size *= 2.0f;
+        }
+        m_CellSize = static_cast<float>(size);
+        m_MinX = minX;
+        m_MinY = minY;
+
+        // Counting sort by cell
+        const std::size_t cellCount = static_cast<std::size_t>(m_Columns) * m_Rows;
+        m_CellStart.assign(cellCount + 1, 0);
+        m_PointCells.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint32_t cell = RowOf(ys[i]) * m_Columns + ColumnOf(xs[i]);
+            m_PointCells[i] = cell;
+            ++m_CellStart[cell + 1];
+        }
+        for (std::size_t cell = 0; cell < cellCount; ++cell) {
+            m_CellStart[cell + 1] += m_CellStart[cell];
+        }
+
+        m_Order.resize(count);
+        m_SortedX.resize(count);
+        m_SortedY.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            // m_CellStart[cell] is used as the insertion cursor and ends at the next cell's start
+            const std::uint32_t slot = m_CellStart[m_PointCells[i]]++;
+            m_Order[slot] = static_cast<std::uint32_t>(i);
+            m_SortedX[slot] = xs[i];
+            m_SortedY[slot] = ys[i];
+        }
+        for (std::size_t cell = cellCount; cell > 0; --cell) {
+            m_CellStart[cell] = m_CellStart[cell - 1];
+        }
+        m_CellStart[0] = 0;
+    }
+
+    float NeighborGrid2D::GetCellSize() const {
+        return m_CellSize;
+    }
+
+    std::uint32_t NeighborGrid2D::GetColumns() const {
+        return m_Columns;
+    }
+
+    std::uint32_t NeighborGrid2D::GetRows() const {
+        return m_Rows;
+    }
+
+    std::uint32_t NeighborGrid2D::ColumnOf(float x) const {
+        // Clamped before the conversion; NaN lands in the first column
+        const float column = std::floor((x - m_MinX) / m_CellSize);
+        return column > 0.0f ? static_cast<std::uint32_t>(std::min(column, static_cast<float>(m_Columns - 1))) : 0u;
+    }
+
+    std::uint32_t NeighborGrid2D::RowOf(float y) const {
+        const float row = std::floor((y - m_MinY) / m_CellSize);
+        return row > 0.0f ? static_cast<std::uint32_t>(std::min(row, static_cast<float>(m_Rows - 1))) : 0u;
+    }
+
+    std::uint32_t NeighborGrid2D::GetCellStart(std::uint32_t column, std::uint32_t row) const {
+        return m_CellStart[static_cast<std::size_t>(row) * m_Columns + column];
+    }
+
+    std::uint32_t NeighborGrid2D::GetCellEnd(std::uint32_t column, std::uint32_t row) const {
+        return m_CellStart[static_cast<std::size_t>(row) * m_Columns + column + 1];
+    }
+
+    std::span<const std::uint32_t> NeighborGrid2D::GetOrder() const {
+        return m_Order;
+    }
+
+    std::span<const float> NeighborGrid2D::GetSortedX() const {
+        return m_SortedX;
+    }
+
+    std::span<const float> NeighborGrid2D::GetSortedY() const {
+        return m_SortedY;
+    }
+
+    void NeighborGrid2D::FindNeighbors(const Vector2D& center, float radius, std::vector<std::uint32_t>& outIndices) const {
+        outIndices.clear();
+        if (m_Order.empty()) {
+            return;
+        }
+        const float radius2 = radius * radius;
+        const std::uint32_t firstColumn = ColumnOf(center.x - radius);
+        const std::uint32_t lastColumn = ColumnOf(center.x + radius);
+        const std::uint32_t firstRow = RowOf(center.y - radius);
+        const std::uint32_t lastRow = RowOf(center.y + radius);
+        for (std::uint32_t row = firstRow; row <= lastRow; ++row) {
+            // Cells of one row are adjacent in sorted order
+            const std::uint32_t end = GetCellEnd(lastColumn, row);
+            for (std::uint32_t j = GetCellStart(firstColumn, row); j < end; ++j) {
+                const float dx = m_SortedX[j] - center.x;
+                const float dy = m_SortedY[j] - center.y;
+                if (dx * dx + dy * dy <= radius2) {
+                    outIndices.push_back(m_Order[j]);
+                }
+            }
+        }
+    }
+
+    // CrowdSteering
+
+    CrowdSteering::CrowdSteering(const SteeringSettings& settings) {
+        SetSettings(settings);
+    }
+
+    void CrowdSteering::SetSettings(const SteeringSettings& settings) {
+        if (!(settings.neighborRadius > 0.0f) || !(settings.separationRadius > 0.0f) ||
+            !(settings.maxSpeed > 0.0f) || !(settings.maxForce > 0.0f)) {
+            throw std::invalid_argument("Steering radii, speed and force must be positive");
+        }
+        if (settings.separationRadius > settings.neighborRadius) {
+            throw std::invalid_argument("Separation radius must not exceed the neighbor radius");
+        }
+        m_Settings = settings;
+    }
+
+    const SteeringSettings& CrowdSteering::GetSettings() const {
+        return m_Settings;
+    }
+
+    const NeighborGrid2D& CrowdSteering::GetGrid() const {
+        return m_Grid;
+    }
+
+    void CrowdSteering::ComputeRange(const SteeringAgents& agents, std::span<float> forcesX, std::span<float> forcesY,
+                                     std::size_t begin, std::size_t end) const {
+        const std::span<const std::uint32_t> order = m_Grid.GetOrder();
+        const float* sortedX = m_Grid.GetSortedX().data();
+        const float* sortedY = m_Grid.GetSortedY().data();
+        const float neighborRadius2 = m_Settings.neighborRadius * m_Settings.neighborRadius;
+        const float separationRadius2 = m_Settings.separationRadius * m_Settings.separationRadius;
+        const bool seek = !agents.targetsX.empty();
+        const std::uint32_t lastColumn = m_Grid.GetColumns() - 1;
+        const std::uint32_t lastRow = m_Grid.GetRows() - 1;
+
+        for (std::size_t s = begin; s < end; ++s) {
+            const float x = sortedX[s];
+            const float y = sortedY[s];
+            const float velocityX = m_SortedVelocityX[s];
+            const float velocityY = m_SortedVelocityY[s];
+
+            // Cells are at least neighborRadius wide, so the 3x3 block holds every neighbor
+            const std::uint32_t column = m_Grid.ColumnOf(x);
+            const std::uint32_t row = m_Grid.RowOf(y);
+            const std::uint32_t firstColumn = column > 0 ? column - 1 : 0;
+            const std::uint32_t endColumn = std::min(column + 1, lastColumn);
+            NeighborSums sums;
+            for (std::uint32_t r = row > 0 ? row - 1 : 0; r <= std::min(row + 1, lastRow); ++r) {
+                AccumulateNeighbors(x, y, sortedX, sortedY, m_SortedVelocityX.data(), m_SortedVelocityY.data(),
+                                    m_Grid.GetCellStart(firstColumn, r), m_Grid.GetCellEnd(endColumn, r),
+                                    neighborRadius2, separationRadius2, sums);
+            }
+
+            const float maxSpeed = m_Settings.maxSpeed;
+            const float maxForce = m_Settings.maxForce;
+            Vector2D force(0.0f, 0.0f);
+            force += SteerTowards(sums.separationX, sums.separationY, velocityX, velocityY, maxSpeed, maxForce)
+                     * m_Settings.separationWeight;
+            if (sums.count > 0.0f) {
+                const float inverseCount = 1.0f / sums.count;
+                force += SteerTowards(sums.velocityX * inverseCount, sums.velocityY * inverseCount,
+                                      velocityX, velocityY, maxSpeed, maxForce) * m_Settings.alignmentWeight;
+                force += SteerTowards(sums.positionX * inverseCount - x, sums.positionY * inverseCount - y,
+                                      velocityX, velocityY, maxSpeed, maxForce) * m_Settings.cohesionWeight;
+            }
+
+            const std::uint32_t agent = order[s];
+            if (seek) {
+                force += SteerTowards(agents.targetsX[agent] - x, agents.targetsY[agent] - y,
+                                      velocityX, velocityY, maxSpeed, maxForce) * m_Settings.seekWeight;
+            }
+
+            const float length = force.Length();
+            if (length > maxForce) {
+                force = force * (maxForce / length);
+            }
+            forcesX[agent] = force.x;
+            forcesY[agent] = force.y;
+        }
+    }
+
+    void CrowdSteering::ComputeForces(const SteeringAgents& agents, std::span<float> forcesX, std::span<float> forcesY,
+                                      WorkerPool* pool) {
+        MATH_TRACE_SCOPE("CrowdSteering::ComputeForces");
+        const std::size_t count = agents.positionsX.size();
+        const bool targetsMatch = agents.targetsX.size() == agents.targetsY.size() &&
+                                  (agents.targetsX.empty() || agents.targetsX.size() == count);
+        if (agents.positionsY.size() != count || agents.velocitiesX.size() != count ||
+            agents.velocitiesY.size() != count || forcesX.size() != count || forcesY.size() != count || !targetsMatch) {
+            throw std::invalid_argument("Input and output spans must have the same size");
+        }
+
+        m_Grid.Build(agents.positionsX, agents.positionsY, m_Settings.neighborRadius);
+        const std::span<const std::uint32_t> order = m_Grid.GetOrder();
+        m_SortedVelocityX.resize(count);
+        m_SortedVelocityY.resize(count);
+        for (std::size_t s = 0; s < count; ++s) {
+            m_SortedVelocityX[s] = agents.velocitiesX[order[s]];
+            m_SortedVelocityY[s] = agents.velocitiesY[order[s]];
+        }
+
+        if (pool != nullptr) {
+            pool->ParallelForChunks(count, MinAgentsPerThread, [&](std::size_t begin, std::size_t end) {
+                ComputeRange(agents, forcesX, forcesY, begin, end);
+            });
+        } else {
+            ComputeRange(agents, forcesX, forcesY, 0, count);
+        }
+    }
+
+} // namespace Math
@@ -0,0 +1,206 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef CROWD_STEERING_H
+#define CROWD_STEERING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "MathFwd.h"
+#include "Vector2D.h"
+
+namespace Math {
+
+    /**
+     * @class NeighborGrid2D
+     * @brief Uniform grid that buckets 2D points by cell for neighbor queries.
+     *
+     * Build sorts the points by cell with a counting sort and keeps sorted copies of their
+     * coordinates, so the points of a cell are contiguous in memory. Rebuilding every frame
+     * reuses the previous storage and does not allocate once the grid has seen its largest
+     * point count.
+     *
+     * The grid spans the bounding box of the points. If that box would need many more cells
+     * than there are points, the cells are enlarged, which keeps queries correct but makes
+     * them visit more points.
+     */
+    class NeighborGrid2D {
+    private:
+        float m_CellSize = 1.0f;
+        float m_MinX = 0.0f;
+        float m_MinY = 0.0f;
+        std::uint32_t m_Columns = 0;
+        std::uint32_t m_Rows = 0;
+
+        /** First sorted index of each cell; one extra entry marks the end */
+        std::vector<std::uint32_t> m_CellStart;
+
+        /** Original index of each sorted point */
+        std::vector<std::uint32_t> m_Order;
+
+        std::vector<float> m_SortedX;
+        std::vector<float> m_SortedY;
+
+        /** Scratch cell of each point during Build */
+        std::vector<std::uint32_t> m_PointCells;
+
+    public:
+        /**
+         * @brief Buckets points into cells.
+         * @param xs X coordinates of the points
+         * @param ys Y coordinates of the points
+         * @param cellSize Minimum cell size; a query with radius up to cellSize visits 3x3 cells
+         * @throws std::invalid_argument if the spans differ in size, a coordinate is not finite,
+         *         or cellSize is not positive and finite
+         */
+        void Build(std::span<const float> xs, std::span<const float> ys, float cellSize);
+
+        /**
+         * @brief Gets the cell size in use, which may exceed the requested one.
+         */
+        [[nodiscard]] float GetCellSize() const;
+
+        [[nodiscard]] std::uint32_t GetColumns() const;
+        [[nodiscard]] std::uint32_t GetRows() const;
+
+        /**
+         * @brief Gets the column of an x coordinate, clamped to the grid.
+         */
+        [[nodiscard]] std::uint32_t ColumnOf(float x) const;
+
+        /**
+         * @brief Gets the row of a y coordinate, clamped to the grid.
+         */
+        [[nodiscard]] std::uint32_t RowOf(float y) const;
+
+        /**
+         * @brief Gets the first sorted index of a cell; the cell ends where the next one starts.
+         */
+        [[nodiscard]] std::uint32_t GetCellStart(std::uint32_t column, std::uint32_t row) const;
+        [[nodiscard]] std::uint32_t GetCellEnd(std::uint32_t column, std::uint32_t row) const;
+
+        /**
+         * @brief Gets the original index of every point in sorted order.
+         */
+        [[nodiscard]] std::span<const std::uint32_t> GetOrder() const;
+
+        /**
+         * @brief Gets the point coordinates in sorted order.
+         */
+        [[nodiscard]] std::span<const float> GetSortedX() const;
+        [[nodiscard]] std::span<const float> GetSortedY() const;
+
+        /**
+         * @brief Collects the original indices of all points within a radius.
+         * @param center Query center
+         * @param radius Query radius
+         * @param outIndices Cleared, then filled with the indices (in no particular order)
+         */
+        void FindNeighbors(const Vector2D& center, float radius, std::vector<std::uint32_t>& outIndices) const;
+    };
+
+    /**
+     * @brief Radii, speeds and weights of the steering behaviors.
+     */
+    struct SteeringSettings {
+        /** Agents within this distance count for alignment and cohesion */
+        float neighborRadius = 2.0f;
+
+        /** Agents within this distance push each other apart; at most neighborRadius */
+        float separationRadius = 1.0f;
+
+        /** Speed of the desired velocities each behavior steers towards */
+        float maxSpeed = 5.0f;
+
+        /** Largest force of each behavior and of the total */
+        float maxForce = 10.0f;
+
+        float separationWeight = 1.5f;
+        float alignmentWeight = 1.0f;
+        float cohesionWeight = 1.0f;
+        float seekWeight = 1.0f;
+    };
+
+    /**
+     * @brief Agent state as separate component arrays, all of the same length.
+     *
+     * The target spans may be empty, in which case agents do not seek.
+     */
+    struct SteeringAgents {
+        std::span<const float> positionsX;
+        std::span<const float> positionsY;
+        std::span<const float> velocitiesX;
+        std::span<const float> velocitiesY;
+        std::span<const float> targetsX;
+        std::span<const float> targetsY;
+    };
+
+    /**
+     * @class CrowdSteering
+     * @brief Computes separation, alignment, cohesion and seek forces for a whole crowd at once.
+     *
+     * Each call rebuilds a NeighborGrid2D with cells of neighborRadius, gathers the velocities
+     * in the grid's order, and then evaluates every agent against the agents of the 3x3
+     * surrounding cells. The neighbor loop processes four neighbors per SSE2 instruction. The
+     * agents are split into chunks over the threads of an optional WorkerPool.
+     *
+     * Each behavior steers towards a desired velocity of length maxSpeed and is clamped to
+     * maxForce (Reynolds' steering):
+     * - Separation: away from close agents, weighted by 1 / distance
+     * - Alignment: along the average velocity of the neighbors
+     * - Cohesion: towards the average position of the neighbors
+     * - Seek: towards the agent's target
+     */
+    class CrowdSteering {
+    private:
+        SteeringSettings m_Settings;
+        NeighborGrid2D m_Grid;
+        std::vector<float> m_SortedVelocityX;
+        std::vector<float> m_SortedVelocityY;
+
+        /**
+         * @brief Computes the forces of the agents at sorted indices [begin, end).
+         */
+        void ComputeRange(const SteeringAgents& agents, std::span<float> forcesX, std::span<float> forcesY,
+                          std::size_t begin, std::size_t end) const;
+
+    public:
+        /**
+         * @brief Creates a steering solver.
+         * @throws std::invalid_argument if the settings are invalid
+         */
+        explicit CrowdSteering(const SteeringSettings& settings = SteeringSettings());
+
+        /**
+         * @brief Replaces the settings.
+         * @throws std::invalid_argument if a radius, speed or force is not positive, or
+         *         separationRadius exceeds neighborRadius
+         */
+        void SetSettings(const SteeringSettings& settings);
+
+        [[nodiscard]] const SteeringSettings& GetSettings() const;
+
+        /**
+         * @brief Computes the combined steering force of every agent.
+         * @param agents Agent state
+         * @param forcesX Receives the x component of each agent's force
+         * @param forcesY Receives the y component of each agent's force
+         * @param pool Optional worker pool to split the agents between threads
+         * @throws std::invalid_argument if the spans differ in size or a position is not finite
+         */
+        void ComputeForces(const SteeringAgents& agents, std::span<float> forcesX, std::span<float> forcesY,
+                           WorkerPool* pool = nullptr);
+
+        /**
+         * @brief Gets the neighbor grid built by the last ComputeForces call.
+         */
+        [[nodiscard]] const NeighborGrid2D& GetGrid() const;
+    };
+
+} // namespace Math
+
+#endif // CROWD_STEERING_H
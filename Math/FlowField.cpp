@@ -0,0 +1,566 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "FlowField.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        constexpr float Infinity = std::numeric_limits<float>::infinity();
+        constexpr float DiagonalLength = 1.41421356f;
+        constexpr float DiagonalDirection = 0.70710678f;
+
+        // Tiles per thread below which another thread does not pay off
+        constexpr std::size_t MinTilesPerThread = 4;
+
+        // Each round solves the active tiles whose lowest incoming value is within this much
+        // of the lowest one; tiles further out wait until their inputs are closer to final
+        constexpr float RoundSpan = static_cast<float>(FlowField::TileSize);
+
+        // A tile's cells plus a ring of its neighbors' border cells
+        constexpr std::uint32_t LocalStride = FlowField::TileSize + 2;
+        constexpr std::size_t LocalSize = static_cast<std::size_t>(LocalStride) * LocalStride;
+
+        // Neighbor offsets, orthogonal ones first
+        constexpr int NeighborX[8] = {1, -1, 0, 0, 1, -1, 1, -1};
+        constexpr int NeighborY[8] = {0, 0, 1, -1, 1, 1, -1, -1};
+
+    } // namespace
+
+    FlowField::FlowField(std::uint32_t width, std::uint32_t height, float cellSize, const Vector2D& origin)
+        : m_Width(width), m_Height(height), m_CellSize(cellSize), m_Origin(origin) {
+        if (width == 0 || height == 0) {
+            throw std::invalid_argument("Flow field must have at least one cell");
+        }
+        if (!(cellSize > 0.0f)) {
+            throw std::invalid_argument("Cell size must be positive");
+        }
+        m_TilesX = (width + TileSize - 1) / TileSize;
+        m_TilesY = (height + TileSize - 1) / TileSize;
+
+        const std::size_t cellCount = static_cast<std::size_t>(width) * height;
+        m_Costs.assign(cellCount, 1);
+        m_GoalMask.assign(cellCount, 0);
+        m_Integration.assign(cellCount, Infinity);
+        m_Directions.assign(cellCount, Vector2D(0.0f, 0.0f));
+        m_TileActive.assign(static_cast<std::size_t>(m_TilesX) * m_TilesY, 0);
+        m_TileKeys.assign(m_TileActive.size(), 0.0f);
+        m_TileDirectionsDirty.assign(m_TileActive.size(), 0);
+    }
+
+    std::uint32_t FlowField::GetWidth() const {
+        return m_Width;
+    }
+
+    std::uint32_t FlowField::GetHeight() const {
+        return m_Height;
+    }
+
+    float FlowField::GetCellSize() const {
+        return m_CellSize;
+    }
+
+    const Vector2D& FlowField::GetOrigin() const {
+        return m_Origin;
+    }
+
+    std::uint32_t FlowField::CellIndex(std::uint32_t x, std::uint32_t y) const {
+        if (x >= m_Width || y >= m_Height) {
+            throw std::out_of_range("Cell out of range");
+        }
+        return y * m_Width + x;
+    }
+
+    void FlowField::SetCost(std::uint32_t x, std::uint32_t y, std::uint8_t cost) {
+        const std::uint32_t cell = CellIndex(x, y);
+        if (cost == 0) {
+            throw std::invalid_argument("Cell cost must be at least 1");
+        }
+        if (m_Costs[cell] == cost) {
+            return;
+        }
+        if (m_GoalMask[cell] != 0 && (cost == Impassable || m_Costs[cell] == Impassable)) {
+            // A goal appears or disappears
+            m_NeedsRebuild = true;
+        }
+        m_ChangedCells.push_back(cell);
+        m_ChangedOldCosts.push_back(m_Costs[cell]);
+        m_Costs[cell] = cost;
+    }
+
+    std::uint8_t FlowField::GetCost(std::uint32_t x, std::uint32_t y) const {
+        return m_Costs[CellIndex(x, y)];
+    }
+
+    void FlowField::AddGoal(std::uint32_t x, std::uint32_t y) {
+        const std::uint32_t cell = CellIndex(x, y);
+        if (m_GoalMask[cell] == 0) {
+            m_GoalMask[cell] = 1;
+            m_Goals.push_back(cell);
+            m_NeedsRebuild = true;
+        }
+    }
+
+    void FlowField::ClearGoals() {
+        for (const std::uint32_t cell : m_Goals) {
+            m_GoalMask[cell] = 0;
+        }
+        m_Goals.clear();
+        m_NeedsRebuild = true;
+    }
+
+    bool FlowField::CanStep(std::uint32_t x, std::uint32_t y, int dx, int dy) const {
+        const std::int64_t nx = static_cast<std::int64_t>(x) + dx;
+        const std::int64_t ny = static_cast<std::int64_t>(y) + dy;
+        if (nx < 0 || ny < 0 || nx >= m_Width || ny >= m_Height) {
+            return false;
+        }
+        if (m_Costs[ny * m_Width + nx] == Impassable) {
+            return false;
+        }
+        // Diagonal moves may not cut the corner of an impassable cell
+        return dx == 0 || dy == 0 ||
+               (m_Costs[static_cast<std::size_t>(y) * m_Width + nx] != Impassable &&
+                m_Costs[ny * m_Width + x] != Impassable);
+    }
+
+    std::uint32_t FlowField::TileOf(std::uint32_t cell) const {
+        return (cell / m_Width / TileSize) * m_TilesX + (cell % m_Width) / TileSize;
+    }
+
+    void FlowField::ActivateTile(std::uint32_t tileX, std::uint32_t tileY, float key) {
+        const std::uint32_t tile = tileY * m_TilesX + tileX;
+        if (m_TileActive[tile] == 0) {
+            m_TileActive[tile] = 1;
+            m_TileKeys[tile] = key;
+            m_ActiveTiles.push_back(tile);
+        } else {
+            m_TileKeys[tile] = std::min(m_TileKeys[tile], key);
+        }
+    }
+
+    void FlowField::ActivateTilesAround(std::uint32_t x, std::uint32_t y) {
+        const std::uint32_t firstX = (x > 0 ? x - 1 : 0) / TileSize;
+        const std::uint32_t lastX = std::min(x + 1, m_Width - 1) / TileSize;
+        const std::uint32_t firstY = (y > 0 ? y - 1 : 0) / TileSize;
+        const std::uint32_t lastY = std::min(y + 1, m_Height - 1) / TileSize;
+        for (std::uint32_t tileY = firstY; tileY <= lastY; ++tileY) {
+            for (std::uint32_t tileX = firstX; tileX <= lastX; ++tileX) {
+                ActivateTile(tileX, tileY, 0.0f);
+            }
+        }
+    }
+
+    void FlowField::ActivateImprovedNeighbors(std::uint32_t tile) {
+        const std::uint32_t x0 = (tile % m_TilesX) * TileSize;
+        const std::uint32_t y0 = (tile / m_TilesX) * TileSize;
+        const std::uint32_t x1 = std::min(x0 + TileSize, m_Width);
+        const std::uint32_t y1 = std::min(y0 + TileSize, m_Height);
+        for (std::uint32_t y = y0; y < y1; ++y) {
+            // Interior rows only have border cells in the first and last column
+            const std::uint32_t stride = y == y0 || y == y1 - 1 ? 1 : std::max(x1 - x0 - 1, 1u);
+            for (std::uint32_t x = x0; x < x1; x += stride) {
+                const float value = m_Integration[static_cast<std::size_t>(y) * m_Width + x];
+                if (value == Infinity) {
+                    continue;
+                }
+                for (int k = 0; k < 8; ++k) {
+                    const std::int64_t nx = static_cast<std::int64_t>(x) + NeighborX[k];
+                    const std::int64_t ny = static_cast<std::int64_t>(y) + NeighborY[k];
+                    if (nx >= x0 && nx < x1 && ny >= y0 && ny < y1) {
+                        continue;
+                    }
+                    if (nx < 0 || ny < 0 || nx >= m_Width || ny >= m_Height) {
+                        continue;
+                    }
+                    const auto neighborX = static_cast<std::uint32_t>(nx);
+                    const auto neighborY = static_cast<std::uint32_t>(ny);
+                    const std::size_t neighbor = static_cast<std::size_t>(neighborY) * m_Width + neighborX;
+                    if (m_Costs[neighbor] == Impassable || !CanStep(neighborX, neighborY, -NeighborX[k], -NeighborY[k])) {
+                        continue;
+                    }
+                    const float candidate = value + static_cast<float>(m_Costs[neighbor]) * (k < 4 ? 1.0f : DiagonalLength);
+                    if (candidate < m_Integration[neighbor]) {
+                        ActivateTile(neighborX / TileSize, neighborY / TileSize, value);
+                    }
+                }
+            }
+        }
+    }
+
+    void FlowField::MarkDirectionsDirtyAround(std::uint32_t tile) {
+        // Directions read the neighboring cells, so the surrounding tiles see the change too
+        const std::uint32_t tileX = tile % m_TilesX;
+        const std::uint32_t tileY = tile / m_TilesX;
+        for (std::uint32_t y = tileY > 0 ? tileY - 1 : 0; y <= std::min(tileY + 1, m_TilesY - 1); ++y) {
+            for (std::uint32_t x = tileX > 0 ? tileX - 1 : 0; x <= std::min(tileX + 1, m_TilesX - 1); ++x) {
+                m_TileDirectionsDirty[y * m_TilesX + x] = 1;
+            }
+        }
+    }
+
+    void FlowField::Invalidate(std::uint32_t cell) {
+        // Invalidated values are kept negated until the search ends, so the old values stay
+        // available to the tightness checks
+        const auto greater = [](const HeapEntry& a, const HeapEntry& b) { return a.value > b.value; };
+        const std::size_t first = m_Invalidated.size();
+        m_Candidates.clear();
+        auto invalidate = [&](std::uint32_t index) {
+            const float value = m_Integration[index];
+            if (value <= 0.0f || value == Infinity) {
+                return;
+            }
+            m_Integration[index] = -value;
+            m_Invalidated.push_back(index);
+
+            // Neighbors whose value was reached through this cell may have to follow
+            const std::uint32_t x = index % m_Width;
+            const std::uint32_t y = index / m_Width;
+            for (int k = 0; k < 8; ++k) {
+                const std::int64_t nx = static_cast<std::int64_t>(x) + NeighborX[k];
+                const std::int64_t ny = static_cast<std::int64_t>(y) + NeighborY[k];
+                if (nx < 0 || ny < 0 || nx >= m_Width || ny >= m_Height) {
+                    continue;
+                }
+                const auto neighbor = static_cast<std::uint32_t>(ny * m_Width + nx);
+                const float neighborValue = m_Integration[neighbor];
+                if (neighborValue > 0.0f && neighborValue != Infinity &&
+                    neighborValue == value + static_cast<float>(m_Costs[neighbor]) * (k < 4 ? 1.0f : DiagonalLength)) {
+                    m_Candidates.push_back({neighborValue, neighbor});
+                    std::push_heap(m_Candidates.begin(), m_Candidates.end(), greater);
+                }
+            }
+        };
+
+        // The cell itself and its neighbors, which may lose a diagonal move past it
+        invalidate(cell);
+        const std::uint32_t cellX = cell % m_Width;
+        const std::uint32_t cellY = cell / m_Width;
+        for (int k = 0; k < 8; ++k) {
+            const std::int64_t nx = static_cast<std::int64_t>(cellX) + NeighborX[k];
+            const std::int64_t ny = static_cast<std::int64_t>(cellY) + NeighborY[k];
+            if (nx >= 0 && ny >= 0 && nx < m_Width && ny < m_Height) {
+                invalidate(static_cast<std::uint32_t>(ny * m_Width + nx));
+            }
+        }
+
+        // Candidates are decided in order of their old value, so every neighbor they could
+        // have been reached through is decided first. A candidate with another neighbor that
+        // still explains its value keeps it.
+        while (!m_Candidates.empty()) {
+            std::pop_heap(m_Candidates.begin(), m_Candidates.end(), greater);
+            const HeapEntry candidate = m_Candidates.back();
+            m_Candidates.pop_back();
+            if (m_Integration[candidate.index] != candidate.value) {
+                continue;
+            }
+
+            const std::uint32_t x = candidate.index % m_Width;
+            const std::uint32_t y = candidate.index / m_Width;
+            const float cost = static_cast<float>(m_Costs[candidate.index]);
+            bool supported = false;
+            for (int k = 0; k < 8 && !supported; ++k) {
+                if (!CanStep(x, y, NeighborX[k], NeighborY[k])) {
+                    continue;
+                }
+                const float value = m_Integration[(y + NeighborY[k]) * m_Width + x + NeighborX[k]];
+                supported = value >= 0.0f && value + cost * (k < 4 ? 1.0f : DiagonalLength) == candidate.value;
+            }
+            if (!supported) {
+                invalidate(candidate.index);
+            }
+        }
+
+        for (std::size_t i = first; i < m_Invalidated.size(); ++i) {
+            const std::uint32_t index = m_Invalidated[i];
+            m_Integration[index] = Infinity;
+            ActivateTile((index % m_Width) / TileSize, (index / m_Width) / TileSize, 0.0f);
+        }
+    }
+
+    void FlowField::GatherTile(std::uint32_t tile, float* localValues, std::uint8_t* localCosts) const {
+        const std::int64_t x0 = static_cast<std::int64_t>(tile % m_TilesX) * TileSize - 1;
+        const std::int64_t y0 = static_cast<std::int64_t>(tile / m_TilesX) * TileSize - 1;
+        for (std::uint32_t ly = 0; ly < LocalStride; ++ly) {
+            const std::int64_t y = y0 + ly;
+            for (std::uint32_t lx = 0; lx < LocalStride; ++lx) {
+                const std::int64_t x = x0 + lx;
+                const bool inside = x >= 0 && y >= 0 && x < m_Width && y < m_Height;
+                localValues[ly * LocalStride + lx] = inside ? m_Integration[y * m_Width + x] : Infinity;
+                localCosts[ly * LocalStride + lx] = inside ? m_Costs[y * m_Width + x] : Impassable;
+            }
+        }
+    }
+
+    std::uint8_t FlowField::SolveTile(std::uint32_t tile, float* local, const std::uint8_t* localCosts,
+                                      std::vector<HeapEntry>& heap) {
+        const std::uint32_t x0 = (tile % m_TilesX) * TileSize;
+        const std::uint32_t y0 = (tile / m_TilesX) * TileSize;
+        const std::uint32_t tileWidth = std::min(TileSize, m_Width - x0);
+        const std::uint32_t tileHeight = std::min(TileSize, m_Height - y0);
+
+        // Known values, inside the tile or on the ring around it, seed the search if they
+        // improve a cell of the tile
+        const auto greater = [](const HeapEntry& a, const HeapEntry& b) { return a.value > b.value; };
+        const auto relax = [&](std::uint32_t lx, std::uint32_t ly, float from, auto&& improve) {
+            for (int k = 0; k < 8; ++k) {
+                // Only cells inside the tile are written
+                const std::uint32_t nx = lx + NeighborX[k];
+                const std::uint32_t ny = ly + NeighborY[k];
+                if (nx < 1 || ny < 1 || nx > tileWidth || ny > tileHeight) {
+                    continue;
+                }
+                const std::uint32_t index = ny * LocalStride + nx;
+                const std::uint8_t cost = localCosts[index];
+                // Diagonal moves may not cut the corner of an impassable cell
+                if (cost == Impassable ||
+                    (k >= 4 && (localCosts[ly * LocalStride + nx] == Impassable ||
+                                localCosts[ny * LocalStride + lx] == Impassable))) {
+                    continue;
+                }
+                const float value = from + static_cast<float>(cost) * (k < 4 ? 1.0f : DiagonalLength);
+                if (value < local[index] && improve(index, value)) {
+                    return;
+                }
+            }
+        };
+        heap.clear();
+        for (std::uint32_t i = 0; i < LocalSize; ++i) {
+            if (local[i] != Infinity) {
+                relax(i % LocalStride, i / LocalStride, local[i], [&](std::uint32_t, float) {
+                    heap.push_back({local[i], i});
+                    return true;
+                });
+            }
+        }
+        std::make_heap(heap.begin(), heap.end(), greater);
+
+        std::uint8_t changed = 0;
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            const HeapEntry entry = heap.back();
+            heap.pop_back();
+            if (entry.value != local[entry.index]) {
+                continue;
+            }
+
+            relax(entry.index % LocalStride, entry.index / LocalStride, entry.value, [&](std::uint32_t index, float value) {
+                local[index] = value;
+                heap.push_back({value, index});
+                std::push_heap(heap.begin(), heap.end(), greater);
+                return false;
+            });
+        }
+
+        for (std::uint32_t ly = 1; ly <= tileHeight; ++ly) {
+            for (std::uint32_t lx = 1; lx <= tileWidth; ++lx) {
+                const float value = local[ly * LocalStride + lx];
+                float& stored = m_Integration[static_cast<std::size_t>(y0 + ly - 1) * m_Width + x0 + lx - 1];
+                if (value != stored) {
+                    stored = value;
+                    const bool border = lx == 1 || ly == 1 || lx == tileWidth || ly == tileHeight;
+                    changed = std::max<std::uint8_t>(changed, border ? 2 : 1);
+                }
+            }
+        }
+        return changed;
+    }
+
+    void FlowField::ComputeTileDirections(std::uint32_t tile) {
+        const std::uint32_t x0 = (tile % m_TilesX) * TileSize;
+        const std::uint32_t y0 = (tile / m_TilesX) * TileSize;
+        const std::uint32_t x1 = std::min(x0 + TileSize, m_Width);
+        const std::uint32_t y1 = std::min(y0 + TileSize, m_Height);
+        for (std::uint32_t y = y0; y < y1; ++y) {
+            for (std::uint32_t x = x0; x < x1; ++x) {
+                const std::size_t cell = static_cast<std::size_t>(y) * m_Width + x;
+                Vector2D direction(0.0f, 0.0f);
+                const float value = m_Integration[cell];
+                if (value != 0.0f && value != Infinity && m_Costs[cell] != Impassable) {
+                    float best = value;
+                    for (int k = 0; k < 8; ++k) {
+                        if (!CanStep(x, y, NeighborX[k], NeighborY[k])) {
+                            continue;
+                        }
+                        const float neighbor = m_Integration[(y + NeighborY[k]) * m_Width + x + NeighborX[k]];
+                        if (neighbor < best) {
+                            best = neighbor;
+                            const float length = k < 4 ? 1.0f : DiagonalDirection;
+                            direction = Vector2D(static_cast<float>(NeighborX[k]) * length,
+                                                 static_cast<float>(NeighborY[k]) * length);
+                        }
+                    }
+                }
+                m_Directions[cell] = direction;
+            }
+        }
+    }
+
+    std::size_t FlowField::Update(WorkerPool* pool) {
+        MATH_TRACE_SCOPE("FlowField::Update");
+
+        if (m_NeedsRebuild) {
+            std::fill(m_Integration.begin(), m_Integration.end(), Infinity);
+            for (const std::uint32_t cell : m_Goals) {
+                if (m_Costs[cell] != Impassable) {
+                    m_Integration[cell] = 0.0f;
+                    ActivateTile((cell % m_Width) / TileSize, (cell / m_Width) / TileSize, 0.0f);
+                }
+            }
+            std::fill(m_TileDirectionsDirty.begin(), m_TileDirectionsDirty.end(), 1);
+            m_NeedsRebuild = false;
+        } else {
+            // The stored values were computed with the old costs, so the search for cells that
+            // depend on a more expensive cell runs against the old costs
+            m_ChangedNewCosts.resize(m_ChangedCells.size());
+            for (std::size_t i = 0; i < m_ChangedCells.size(); ++i) {
+                m_ChangedNewCosts[i] = m_Costs[m_ChangedCells[i]];
+            }
+            for (std::size_t i = m_ChangedCells.size(); i > 0; --i) {
+                m_Costs[m_ChangedCells[i - 1]] = m_ChangedOldCosts[i - 1];
+            }
+            for (std::size_t i = 0; i < m_ChangedCells.size(); ++i) {
+                const std::uint32_t cell = m_ChangedCells[i];
+                if (m_ChangedNewCosts[i] > m_Costs[cell]) {
+                    Invalidate(cell);
+                }
+            }
+            for (std::size_t i = 0; i < m_ChangedCells.size(); ++i) {
+                const std::uint32_t cell = m_ChangedCells[i];
+                m_Costs[cell] = m_ChangedNewCosts[i];
+                ActivateTilesAround(cell % m_Width, cell / m_Width);
+                MarkDirectionsDirtyAround(TileOf(cell));
+            }
+            for (const std::uint32_t cell : m_Invalidated) {
+                MarkDirectionsDirtyAround(TileOf(cell));
+            }
+        }
+        m_ChangedCells.clear();
+        m_ChangedOldCosts.clear();
+        m_Invalidated.clear();
+
+        std::size_t solveCount = 0;
+        std::vector<std::uint32_t>& solved = m_SolvedTiles;
+        while (!m_ActiveTiles.empty()) {
+            // Take the tiles whose inputs are closest to the goals; the others stay active
+            float minKey = Infinity;
+            for (const std::uint32_t tile : m_ActiveTiles) {
+                minKey = std::min(minKey, m_TileKeys[tile]);
+            }
+            const float threshold = minKey + RoundSpan;
+            std::size_t kept = 0;
+            for (const std::uint32_t tile : m_ActiveTiles) {
+                if (m_TileKeys[tile] <= threshold) {
+                    solved.push_back(tile);
+                    m_TileActive[tile] = 0;
+                } else {
+                    m_ActiveTiles[kept++] = tile;
+                }
+            }
+            m_ActiveTiles.resize(kept);
+
+            const std::size_t solveTiles = solved.size();
+            m_TileValues.resize(solveTiles * LocalSize);
+            m_TileCosts.resize(solveTiles * LocalSize);
+            m_TileChanged.resize(solveTiles);
+
+            // Gather every tile of the round before any tile writes, so tiles never race
+            auto gather = [this, &solved](std::size_t begin, std::size_t end) {
+                for (std::size_t slot = begin; slot < end; ++slot) {
+                    GatherTile(solved[slot], m_TileValues.data() + slot * LocalSize, m_TileCosts.data() + slot * LocalSize);
+                }
+            };
+            // Each chunk of the solve reuses its own heap, so the chunks are split here rather
+            // than by ParallelForChunks
+            const std::size_t chunkCount = pool != nullptr
+                ? std::clamp<std::size_t>(solveTiles / MinTilesPerThread, 1, pool->GetThreadCount())
+                : 1;
+            if (m_TileHeaps.size() < chunkCount) {
+                m_TileHeaps.resize(chunkCount);
+            }
+            auto solve = [this, &solved, solveTiles, chunkCount](std::size_t firstChunk, std::size_t lastChunk) {
+                for (std::size_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+                    const std::size_t end = solveTiles * (chunk + 1) / chunkCount;
+                    for (std::size_t slot = solveTiles * chunk / chunkCount; slot < end; ++slot) {
+                        m_TileChanged[slot] = SolveTile(solved[slot], m_TileValues.data() + slot * LocalSize,
+                                                        m_TileCosts.data() + slot * LocalSize, m_TileHeaps[chunk]);
+                    }
+                }
+            };
+            if (pool != nullptr) {
+                pool->ParallelForChunks(solveTiles, MinTilesPerThread, gather);
+                pool->ParallelFor(chunkCount, chunkCount, solve);
+            } else {
+                gather(0, solveTiles);
+                solve(0, chunkCount);
+            }
+            solveCount += solveTiles;
+
+            // Tiles whose border improved activate the neighbors they improve
+            for (std::size_t slot = 0; slot < solveTiles; ++slot) {
+                const std::uint32_t tile = solved[slot];
+                if (m_TileChanged[slot] != 0) {
+                    MarkDirectionsDirtyAround(tile);
+                }
+                if (m_TileChanged[slot] == 2) {
+                    ActivateImprovedNeighbors(tile);
+                }
+            }
+            solved.clear();
+        }
+
+        // Directions only depend on the final values, so dirty tiles are independent
+        for (std::uint32_t tile = 0; tile < m_TileDirectionsDirty.size(); ++tile) {
+            if (m_TileDirectionsDirty[tile] != 0) {
+                m_TileDirectionsDirty[tile] = 0;
+                m_ActiveTiles.push_back(tile);
+            }
+        }
+        auto directions = [this](std::size_t begin, std::size_t end) {
+            for (std::size_t slot = begin; slot < end; ++slot) {
+                ComputeTileDirections(m_ActiveTiles[slot]);
+            }
+        };
+        if (pool != nullptr) {
+            pool->ParallelForChunks(m_ActiveTiles.size(), MinTilesPerThread, directions);
+        } else {
+            directions(0, m_ActiveTiles.size());
+        }
+        m_ActiveTiles.clear();
+        return solveCount;
+    }
+
+    float FlowField::GetIntegration(std::uint32_t x, std::uint32_t y) const {
+        return m_Integration[CellIndex(x, y)];
+    }
+
+    Vector2D FlowField::GetDirection(std::uint32_t x, std::uint32_t y) const {
+        return m_Directions[CellIndex(x, y)];
+    }
+
+    Vector2D FlowField::Sample(const Vector2D& position) const {
+        const float x = std::floor((position.x - m_Origin.x) / m_CellSize);
+        const float y = std::floor((position.y - m_Origin.y) / m_CellSize);
+        if (!(x >= 0.0f && y >= 0.0f && x < static_cast<float>(m_Width) && y < static_cast<float>(m_Height))) {
+            return Vector2D(0.0f, 0.0f);
+        }
+        return m_Directions[static_cast<std::size_t>(y) * m_Width + static_cast<std::size_t>(x)];
+    }
+
+    std::span<const float> FlowField::GetIntegrationField() const {
+        return m_Integration;
+    }
+
+    std::span<const Vector2D> FlowField::GetDirectionField() const {
+        return m_Directions;
+    }
+
+} // namespace Math
@@ -0,0 +1,209 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "MathFwd.h"
+#include "Vector2D.h"
+
+namespace Math {
+
+    /**
+     * @class FlowField
+     * @brief Integration and direction fields over a 2D cost grid, shared by every unit heading to the same goals.
+     *
+     * The integration field holds each cell's path cost to the nearest goal. It follows
+     * 8-connected Dijkstra rules: moving into a cell costs the cell's cost, times sqrt(2)
+     * for a diagonal move, and a diagonal move may not cut the corner of an impassable cell.
+     * The direction field holds, for every reachable cell, the unit vector towards its
+     * lowest neighbor. It is zero on goals, impassable cells and unreachable cells.
+     *
+     * The grid is split into tiles of TileSize x TileSize cells. Update solves tiles in
+     * rounds: each tile of a round runs a local Dijkstra seeded from its own values and its
+     * neighbors' border values, and tiles whose border values improve a neighboring cell
+     * activate that cell's tile. A round takes the active tiles whose incoming values are
+     * lowest, so most tiles are solved once their inputs are final. The tiles of a round run in parallel on an optional WorkerPool and the
+     * result is the same as a single global Dijkstra, whatever the thread count.
+     *
+     * SetCost only records the change. The next Update repairs the fields incrementally: a
+     * cheaper cell activates the tiles around it, and a more expensive cell first resets the
+     * cells whose path ran through it. AddGoal and ClearGoals make the next Update rebuild
+     * everything.
+     *
+     * Cells are addressed by column x and row y. Cell (x, y) covers the square from
+     * origin + (x, y) * cellSize to origin + (x + 1, y + 1) * cellSize.
+     */
+    class FlowField {
+    public:
+        /** Cost of a cell that cannot be entered */
+        static constexpr std::uint8_t Impassable = 255;
+
+        /** Width and height of a tile in cells */
+        static constexpr std::uint32_t TileSize = 16;
+
+    private:
+        struct HeapEntry {
+            float value;
+            std::uint32_t index;
+        };
+
+        std::uint32_t m_Width;
+        std::uint32_t m_Height;
+        std::uint32_t m_TilesX;
+        std::uint32_t m_TilesY;
+        float m_CellSize;
+        Vector2D m_Origin;
+
+        std::vector<std::uint8_t> m_Costs;
+        std::vector<std::uint8_t> m_GoalMask;
+        std::vector<std::uint32_t> m_Goals;
+        std::vector<float> m_Integration;
+        std::vector<Vector2D> m_Directions;
+
+        /** Cost changes since the last Update, with each cell's cost before the change */
+        std::vector<std::uint32_t> m_ChangedCells;
+        std::vector<std::uint8_t> m_ChangedOldCosts;
+        std::vector<std::uint8_t> m_ChangedNewCosts;
+        bool m_NeedsRebuild = true;
+
+        // Update state, kept between calls to avoid reallocating
+        std::vector<std::uint32_t> m_ActiveTiles;
+        std::vector<std::uint32_t> m_SolvedTiles;
+        std::vector<std::uint8_t> m_TileActive;
+        std::vector<float> m_TileKeys;
+        std::vector<std::uint8_t> m_TileDirectionsDirty;
+        std::vector<std::uint8_t> m_TileChanged;
+        std::vector<float> m_TileValues;
+        std::vector<std::uint8_t> m_TileCosts;
+        std::vector<std::uint32_t> m_Invalidated;
+        std::vector<HeapEntry> m_Candidates;
+        /** Dijkstra heap of each chunk of a solve round */
+        std::vector<std::vector<HeapEntry>> m_TileHeaps;
+
+        [[nodiscard]] std::uint32_t CellIndex(std::uint32_t x, std::uint32_t y) const;
+        [[nodiscard]] std::uint32_t TileOf(std::uint32_t cell) const;
+
+        /**
+         * @brief Checks whether a cell may be entered from its neighbor at (x + dx, y + dy).
+         */
+        [[nodiscard]] bool CanStep(std::uint32_t x, std::uint32_t y, int dx, int dy) const;
+
+        /**
+         * @brief Schedules a tile for solving.
+         * @param key Lowest value that may flow into the tile; tiles are solved in order of it
+         */
+        void ActivateTile(std::uint32_t tileX, std::uint32_t tileY, float key);
+        void ActivateTilesAround(std::uint32_t x, std::uint32_t y);
+        void MarkDirectionsDirtyAround(std::uint32_t tile);
+
+        /**
+         * @brief Activates the neighboring tiles that a tile's border values can improve.
+         */
+        void ActivateImprovedNeighbors(std::uint32_t tile);
+
+        /**
+         * @brief Resets the cells whose path depends on a cell that got more expensive.
+         */
+        void Invalidate(std::uint32_t cell);
+
+        /**
+         * @brief Copies the values and costs of a tile and of the ring of cells around it into local storage.
+         */
+        void GatherTile(std::uint32_t tile, float* localValues, std::uint8_t* localCosts) const;
+
+        /**
+         * @brief Runs Dijkstra inside a tile and writes the improved values back.
+         * @return 0 if nothing changed, 1 if only interior cells changed, 2 if a border cell changed
+         */
+        std::uint8_t SolveTile(std::uint32_t tile, float* local, const std::uint8_t* localCosts,
+                               std::vector<HeapEntry>& heap);
+
+        void ComputeTileDirections(std::uint32_t tile);
+
+    public:
+        /**
+         * @brief Creates a field with every cell at cost 1 and no goals.
+         * @param width Number of columns
+         * @param height Number of rows
+         * @param cellSize Side length of a cell in world units
+         * @param origin World position of the corner of cell (0, 0)
+         * @throws std::invalid_argument if the grid is empty or cellSize is not positive
+         */
+        FlowField(std::uint32_t width, std::uint32_t height, float cellSize = 1.0f,
+                  const Vector2D& origin = Vector2D(0.0f, 0.0f));
+
+        [[nodiscard]] std::uint32_t GetWidth() const;
+        [[nodiscard]] std::uint32_t GetHeight() const;
+        [[nodiscard]] float GetCellSize() const;
+        [[nodiscard]] const Vector2D& GetOrigin() const;
+
+        /**
+         * @brief Sets the cost of entering a cell, applied by the next Update.
+         * @param cost 1 to 254, or Impassable
+         * @throws std::out_of_range if the cell is outside the grid
+         * @throws std::invalid_argument if cost is 0
+         */
+        void SetCost(std::uint32_t x, std::uint32_t y, std::uint8_t cost);
+
+        /**
+         * @brief Gets the cost of entering a cell.
+         * @throws std::out_of_range if the cell is outside the grid
+         */
+        [[nodiscard]] std::uint8_t GetCost(std::uint32_t x, std::uint32_t y) const;
+
+        /**
+         * @brief Adds a goal cell. Goals on impassable cells are ignored.
+         * @throws std::out_of_range if the cell is outside the grid
+         */
+        void AddGoal(std::uint32_t x, std::uint32_t y);
+
+        /**
+         * @brief Removes every goal.
+         */
+        void ClearGoals();
+
+        /**
+         * @brief Brings the integration and direction fields up to date with the costs and goals.
+         * @param pool Optional worker pool to solve the tiles of each round in parallel
+         * @return The number of tile solves performed, a measure of the work done
+         */
+        std::size_t Update(WorkerPool* pool = nullptr);
+
+        /**
+         * @brief Gets a cell's path cost to the nearest goal, or infinity if no goal is reachable.
+         * @throws std::out_of_range if the cell is outside the grid
+         */
+        [[nodiscard]] float GetIntegration(std::uint32_t x, std::uint32_t y) const;
+
+        /**
+         * @brief Gets a cell's unit direction towards the nearest goal.
+         * @throws std::out_of_range if the cell is outside the grid
+         */
+        [[nodiscard]] Vector2D GetDirection(std::uint32_t x, std::uint32_t y) const;
+
+        /**
+         * @brief Gets the direction of the cell under a world position, or zero outside the grid.
+         */
+        [[nodiscard]] Vector2D Sample(const Vector2D& position) const;
+
+        /**
+         * @brief Gets the integration field, row by row.
+         */
+        [[nodiscard]] std::span<const float> GetIntegrationField() const;
+
+        /**
+         * @brief Gets the direction field, row by row.
+         */
+        [[nodiscard]] std::span<const Vector2D> GetDirectionField() const;
+    };
+
+} // namespace Math
+
+#endif // FLOW_FIELD_H
@@ -0,0 +1,289 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Format.h"
+#include "Vector2D.h"
+#include "Vector3D.h"
+#include "Matrix2D.h"
+#include "Matrix3D.h"
+#include "Matrix4D.h"
+#include "Transform2D.h"
+#include <array>
+#include <string_view>
+#include <system_error>
+
+namespace Math {
+
+    namespace {
+
+        // Formatting helpers; each advances it and returns false if the buffer is too small
+
+        bool WriteText(char*& it, char* last, std::string_view text) {
+            if (static_cast<std::size_t>(last - it) < text.size()) {
+                return false;
+            }
+            for (char c : text) {
+                *it++ = c;
+            }
+            return true;
+        }
+
+        bool WriteFloat(char*& it, char* last, float value) {
+            // Without a format argument to_chars emits the shortest text that round-trips
+            std::to_chars_result result = std::to_chars(it, last, value);
+            if (result.ec != std::errc()) {
+                return false;
+            }
+            it = result.ptr;
+            return true;
+        }
+
+        // Writes values separated by ", " within a row and "; " between rows of rowLength values
+        template <std::size_t N>
+        bool WriteValues(char*& it, char* last, const std::array<float, N>& values, std::size_t rowLength) {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (i > 0 && !WriteText(it, last, i % rowLength == 0 ? "; " : ", ")) {
+                    return false;
+                }
+                if (!WriteFloat(it, last, values[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <std::size_t N>
+        std::to_chars_result WriteBracketed(char* first, char* last, char open, const std::array<float, N>& values,
+                                            std::size_t rowLength, char close) {
+            char* it = first;
+            if (!WriteText(it, last, std::string_view(&open, 1)) ||
+                !WriteValues(it, last, values, rowLength) ||
+                !WriteText(it, last, std::string_view(&close, 1))) {
+                return {last, std::errc::value_too_large};
+            }
+            return {it, std::errc()};
+        }
+
+        // Parsing helpers; each advances it and returns std::errc() on success
+
+        void SkipSpaces(const char*& it, const char* last) {
+            while (it != last && (*it == ' ' || *it == '\t')) {
+                ++it;
+            }
+        }
+
+        std::errc ReadChar(const char*& it, const char* last, char expected) {
+            SkipSpaces(it, last);
+            if (it == last || *it != expected) {
+                return std::errc::invalid_argument;
+            }
+            ++it;
+            return std::errc();
+        }
+
+        std::errc ReadFloat(const char*& it, const char* last, float& value) {
+            SkipSpaces(it, last);
+            std::from_chars_result result = std::from_chars(it, last, value);
+            if (result.ec != std::errc()) {
+                return result.ec;
+            }
+            it = result.ptr;
+            return std::errc();
+        }
+
+        // Reads values separated by ',' within a row and ';' between rows of rowLength values
+        template <std::size_t N>
+        std::errc ReadValues(const char*& it, const char* last, std::array<float, N>& values, std::size_t rowLength) {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (i > 0) {
+                    std::errc ec = ReadChar(it, last, i % rowLength == 0 ? ';' : ',');
+                    if (ec != std::errc()) {
+                        return ec;
+                    }
+                }
+                std::errc ec = ReadFloat(it, last, values[i]);
+                if (ec != std::errc()) {
+                    return ec;
+                }
+            }
+            return std::errc();
+        }
+
+        template <std::size_t N>
+        std::from_chars_result ReadBracketed(const char* first, const char* last, char open,
+                                             std::array<float, N>& values, std::size_t rowLength, char close) {
+            const char* it = first;
+            std::errc ec = ReadChar(it, last, open);
+            if (ec == std::errc()) {
+                ec = ReadValues(it, last, values, rowLength);
+            }
+            if (ec == std::errc()) {
+                ec = ReadChar(it, last, close);
+            }
+            if (ec != std::errc()) {
+                return {first, ec};
+            }
+            return {it, std::errc()};
+        }
+
+    } // namespace
+
+    // Formatting
+
+    std::to_chars_result ToChars(char* first, char* last, const Vector2D& value) {
+        return WriteBracketed(first, last, '(', std::array<float, 2>{value.x, value.y}, 2, ')');
+    }
+
+    std::to_chars_result ToChars(char* first, char* last, const Vector3D& value) {
+        return WriteBracketed(first, last, '(', std::array<float, 3>{value.x, value.y, value.z}, 3, ')');
+    }
+
+    std::to_chars_result ToChars(char* first, char* last, const Matrix2D& value) {
+        const std::array<float, 4> values = {value.m00, value.m01, value.m10, value.m11};
+        return WriteBracketed(first, last, '[', values, 2, ']');
+    }
+
+    std::to_chars_result ToChars(char* first, char* last, const Matrix3D& value) {
+        const std::array<float, 9> values = {
+            value.m00, value.m01, value.m02,
+            value.m10, value.m11, value.m12,
+            value.m20, value.m21, value.m22
+        };
+        return WriteBracketed(first, last, '[', values, 3, ']');
+    }
+
+    std::to_chars_result ToChars(char* first, char* last, const Matrix4D& value) {
+        const std::array<float, 16> values = {
+            value.m00, value.m01, value.m02, value.m03,
+            value.m10, value.m11, value.m12, value.m13,
+            value.m20, value.m21, value.m22, value.m23,
+            value.m30, value.m31, value.m32, value.m33
+        };
+        return WriteBracketed(first, last, '[', values, 4, ']');
+    }
+
+    std::to_chars_result ToChars(char* first, char* last, const Transform2D& value) {
+        char* it = first;
+        if (!WriteText(it, last, "{")) {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::to_chars_result result = ToChars(it, last, value.GetPosition());
+        if (result.ec != std::errc()) {
+            return result;
+        }
+        it = result.ptr;
+
+        if (!WriteText(it, last, ", ") || !WriteFloat(it, last, value.GetRotationRad()) || !WriteText(it, last, ", ")) {
+            return {last, std::errc::value_too_large};
+        }
+
+        result = ToChars(it, last, value.GetScale());
+        if (result.ec != std::errc()) {
+            return result;
+        }
+        it = result.ptr;
+
+        if (!WriteText(it, last, "}")) {
+            return {last, std::errc::value_too_large};
+        }
+        return {it, std::errc()};
+    }
+
+    // Parsing
+
+    std::from_chars_result FromChars(const char* first, const char* last, Vector2D& value) {
+        std::array<float, 2> values{};
+        std::from_chars_result result = ReadBracketed(first, last, '(', values, 2, ')');
+        if (result.ec == std::errc()) {
+            value = Vector2D(values[0], values[1]);
+        }
+        return result;
+    }
+
+    std::from_chars_result FromChars(const char* first, const char* last, Vector3D& value) {
+        std::array<float, 3> values{};
+        std::from_chars_result result = ReadBracketed(first, last, '(', values, 3, ')');
+        if (result.ec == std::errc()) {
+            value = Vector3D(values[0], values[1], values[2]);
+        }
+        return result;
+    }
+
+    std::from_chars_result FromChars(const char* first, const char* last, Matrix2D& value) {
+        std::array<float, 4> v{};
+        std::from_chars_result result = ReadBracketed(first, last, '[', v, 2, ']');
+        if (result.ec == std::errc()) {
+            value = Matrix2D(v[0], v[1], v[2], v[3]);
+        }
+        return result;
+    }
+
+    std::from_chars_result FromChars(const char* first, const char* last, Matrix3D& value) {
+        std::array<float, 9> v{};
+        std::from_chars_result result = ReadBracketed(first, last, '[', v, 3, ']');
+        if (result.ec == std::errc()) {
+            value = Matrix3D(
+                v[0], v[1], v[2],
+                v[3], v[4], v[5],
+                v[6], v[7], v[8]
+            );
+        }
+        return result;
+    }
+
+    std::from_chars_result FromChars(const char* first, const char* last, Matrix4D& value) {
+        std::array<float, 16> v{};
+        std::from_chars_result result = ReadBracketed(first, last, '[', v, 4, ']');
+        if (result.ec == std::errc()) {
+            value = Matrix4D(
+                v[0],  v[1],  v[2],  v[3],
+                v[4],  v[5],  v[6],  v[7],
+                v[8],  v[9],  v[10], v[11],
+                v[12], v[13], v[14], v[15]
+            );
+        }
+        return result;
+    }
+
+    std::from_chars_result FromChars(const char* first, const char* last, Transform2D& value) {
+        const char* it = first;
+        Vector2D position;
+        Vector2D scale;
+        float rotation = 0.0f;
+
+        std::errc ec = ReadChar(it, last, '{');
+        if (ec == std::errc()) {
+            std::from_chars_result result = FromChars(it, last, position);
+            ec = result.ec;
+            it = result.ptr;
+        }
+        if (ec == std::errc()) {
+            ec = ReadChar(it, last, ',');
+        }
+        if (ec == std::errc()) {
+            ec = ReadFloat(it, last, rotation);
+        }
+        if (ec == std::errc()) {
+            ec = ReadChar(it, last, ',');
+        }
+        if (ec == std::errc()) {
+            std::from_chars_result result = FromChars(it, last, scale);
+            ec = result.ec;
+            it = result.ptr;
+        }
+        if (ec == std::errc()) {
+            ec = ReadChar(it, last, '}');
+        }
+        if (ec != std::errc()) {
+            return {first, ec};
+        }
+
+        value.SetPosition(position);
+        value.SetRotationRad(rotation);
+        value.SetScale(scale);
+        return {it, std::errc()};
+    }
+
+} // namespace Math
@@ -0,0 +1,149 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <charconv>
+#include <cstddef>
+
+#include "MathFwd.h"
+
+namespace Math {
+
+    /**
+     * @brief Allocation-free text conversion of math types.
+     *
+     * ToChars writes into a caller-provided buffer and FromChars parses from a character
+     * range, following the conventions of std::to_chars and std::from_chars: nothing is
+     * allocated, no locale is consulted and errors are reported through the returned
+     * result instead of exceptions.
+     *
+     * Components are written in the shortest form that reads back to the same float, so
+     * FromChars(ToChars(v)) reproduces v bit for bit (including infinities and signed zeros).
+     *
+     * Text formats:
+     * - Vector2D:    (x, y)
+     * - Vector3D:    (x, y, z)
+     * - Matrix2D:    [m00, m01; m10, m11]              (rows separated by ';')
+     * - Matrix3D:    [m00, m01, m02; m10, ...; ..., m22]
+     * - Matrix4D:    [m00, m01, m02, m03; ...; ..., m33]
+     * - Transform2D: {(px, py), rotation, (sx, sy)}    (local components, rotation in radians)
+     *
+     * Parsing accepts any amount of spaces or tabs around components and separators.
+     */
+
+    /** Longest shortest-round-trip representation of a float, e.g. "-1.17549435e-38" */
+    inline constexpr std::size_t MaxFloatChars = 15;
+
+    /**
+     * @brief Buffer size that is always large enough for ToChars of the given type.
+     *
+     * Every component takes at most MaxFloatChars plus a two-character separator, and each
+     * format adds at most four bracket characters.
+     */
+    template <typename T>
+    inline constexpr std::size_t MaxFormattedSize = 0;
+
+    template <> inline constexpr std::size_t MaxFormattedSize<Vector2D> = 2 * (MaxFloatChars + 2) + 4;
+    template <> inline constexpr std::size_t MaxFormattedSize<Vector3D> = 3 * (MaxFloatChars + 2) + 4;
+    template <> inline constexpr std::size_t MaxFormattedSize<Matrix2D> = 4 * (MaxFloatChars + 2) + 4;
+    template <> inline constexpr std::size_t MaxFormattedSize<Matrix3D> = 9 * (MaxFloatChars + 2) + 4;
+    template <> inline constexpr std::size_t MaxFormattedSize<Matrix4D> = 16 * (MaxFloatChars + 2) + 4;
+    template <> inline constexpr std::size_t MaxFormattedSize<Transform2D> = 5 * (MaxFloatChars + 2) + 4;
+
+    // Formatting
+
+    /**
+     * @brief Writes a vector as "(x, y)".
+     * @param first Start of the destination buffer
+     * @param last End of the destination buffer
+     * @param value The vector to write
+     * @return Pointer past the last written character; ec is std::errc::value_too_large
+     *         (and ptr is last) if the buffer is too small
+     */
+    std::to_chars_result ToChars(char* first, char* last, const Vector2D& value);
+
+    /**
+     * @brief Writes a vector as "(x, y, z)".
+     * @see ToChars(char*, char*, const Vector2D&)
+     */
+    std::to_chars_result ToChars(char* first, char* last, const Vector3D& value);
+
+    /**
+     * @brief Writes a matrix as "[m00, m01; m10, m11]".
+     * @see ToChars(char*, char*, const Vector2D&)
+     */
+    std::to_chars_result ToChars(char* first, char* last, const Matrix2D& value);
+
+    /**
+     * @brief Writes a matrix row by row, rows separated by ';'.
+     * @see ToChars(char*, char*, const Vector2D&)
+     */
+    std::to_chars_result ToChars(char* first, char* last, const Matrix3D& value);
+
+    /**
+     * @brief Writes a matrix row by row, rows separated by ';'.
+     * @see ToChars(char*, char*, const Vector2D&)
+     */
+    std::to_chars_result ToChars(char* first, char* last, const Matrix4D& value);
+
+    /**
+     * @brief Writes the local components of a transform as "{(px, py), rotation, (sx, sy)}".
+     *
+     * The parent link is not part of the text.
+     *
+     * @see ToChars(char*, char*, const Vector2D&)
+     */
+    std::to_chars_result ToChars(char* first, char* last, const Transform2D& value);
+
+    // Parsing
+
+    /**
+     * @brief Parses a vector written as "(x, y)".
+     * @param first Start of the text
+     * @param last End of the text
+     * @param value Receives the parsed vector; left unchanged on failure
+     * @return Pointer past the parsed text; ec is std::errc::invalid_argument (and ptr is first)
+     *         if the text is malformed, or std::errc::result_out_of_range if a component does
+     *         not fit in a float
+     */
+    std::from_chars_result FromChars(const char* first, const char* last, Vector2D& value);
+
+    /**
+     * @brief Parses a vector written as "(x, y, z)".
+     * @see FromChars(const char*, const char*, Vector2D&)
+     */
+    std::from_chars_result FromChars(const char* first, const char* last, Vector3D& value);
+
+    /**
+     * @brief Parses a matrix written as "[m00, m01; m10, m11]".
+     * @see FromChars(const char*, const char*, Vector2D&)
+     */
+    std::from_chars_result FromChars(const char* first, const char* last, Matrix2D& value);
+
+    /**
+     * @brief Parses a matrix written row by row, rows separated by ';'.
+     * @see FromChars(const char*, const char*, Vector2D&)
+     */
+    std::from_chars_result FromChars(const char* first, const char* last, Matrix3D& value);
+
+    /**
+     * @brief Parses a matrix written row by row, rows separated by ';'.
+     * @see FromChars(const char*, const char*, Vector2D&)
+     */
+    std::from_chars_result FromChars(const char* first, const char* last, Matrix4D& value);
+
+    /**
+     * @brief Parses "{(px, py), rotation, (sx, sy)}" into the local components of a transform.
+     *
+     * The parent of the transform is left untouched.
+     *
+     * @see FromChars(const char*, const char*, Vector2D&)
+     */
+    std::from_chars_result FromChars(const char* first, const char* last, Transform2D& value);
+
+} // namespace Math
+
+#endif // FORMAT_H
@@ -0,0 +1,164 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+/**
+ * @file MathEngine.cppm
+ * @brief C++20 module interface for the math library.
+ *
+ * Consumers can write `import MathEngine;` instead of including the individual headers.
+ * The module is built once and imported as a compiled interface, so importing translation
+ * units skip re-parsing the headers entirely. It is only built when the
+ * MATHENGINE_BUILD_MODULE CMake option is enabled (requires CMake 3.28 or newer).
+ */
+module;
+
+#include "Constants.h"
+#include "ScalarMath.h"
+#include "Vector2D.h"
+#include "Vector3D.h"
+#include "Matrix2D.h"
+#include "Matrix2DSimd.h"
+#include "Matrix3D.h"
+#include "Matrix4D.h"
+#include "TaggedMatrix4D.h"
+#include "Transform2D.h"
+#include "TransformHierarchy2D.h"
+#include "Format.h"
+#include "WorkloadTrace.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include "ParticleSystem.h"
+#include "CrowdSteering.h"
+#include "FlowField.h"
+#include "NavMesh.h"
+#include "ClothSolver.h"
+#include "SphFluid.h"
+
+export module MathEngine;
+
+export namespace Math {
+
+    namespace Constants {
+        using Math::Constants::PI;
+        using Math::Constants::TAU;
+        using Math::Constants::HALF_PI;
+        using Math::Constants::QUARTER_PI;
+        using Math::Constants::INV_PI;
+        using Math::Constants::E;
+        using Math::Constants::EULER;
+        using Math::Constants::GOLDEN_RATIO;
+        using Math::Constants::SQRT_2;
+        using Math::Constants::SQRT_3;
+        using Math::Constants::INFINITY_F;
+        using Math::Constants::DEG_TO_RAD;
+        using Math::Constants::RAD_TO_DEG;
+        using Math::Constants::EPSILON;
+        using Math::Constants::EPSILON_MEDIUM;
+        using Math::Constants::EPSILON_LARGE;
+        using Math::Constants::MACHINE_EPSILON;
+        using Math::Constants::MAX_FLOAT;
+        using Math::Constants::MIN_FLOAT;
+        using Math::Constants::LOWEST_FLOAT;
+        using Math::Constants::RADIANS_30;
+        using Math::Constants::RADIANS_45;
+        using Math::Constants::RADIANS_60;
+        using Math::Constants::RADIANS_90;
+        using Math::Constants::RADIANS_180;
+        using Math::Constants::RADIANS_270;
+        using Math::Constants::RADIANS_360;
+        using Math::Constants::FloatEquals;
+        using Math::Constants::IsZero;
+        using Math::Constants::IsOne;
+    }
+
+    using Math::Sin;
+    using Math::Cos;
+    using Math::SinCos;
+    using Math::Tan;
+    using Math::Acos;
+    using Math::Atan2;
+
+    namespace Deterministic {
+        using Math::Deterministic::Sin;
+        using Math::Deterministic::Cos;
+        using Math::Deterministic::SinCos;
+        using Math::Deterministic::Tan;
+        using Math::Deterministic::Acos;
+        using Math::Deterministic::Atan2;
+    }
+
+    using Math::Vector2D;
+    using Math::Vector3D;
+
+    using Math::Matrix2D;
+    using Math::Matrix3D;
+    using Math::Matrix4D;
+    using Math::operator*;
+
+    namespace Simd {
+        using Math::Simd::Multiply;
+        using Math::Simd::Determinant;
+        using Math::Simd::Transpose;
+        using Math::Simd::Inverse;
+        using Math::Simd::TransformVectors;
+    }
+
+    using Math::Matrix4DKind;
+    using Math::TaggedMatrix4D;
+
+    using Math::TransformFlags;
+    using Math::operator|;
+    using Math::operator&;
+    using Math::HasAnyFlag;
+    using Math::Transform2D;
+
+    using Math::Transform2DHandle;
+    using Math::Transform2DReparent;
+    using Math::TransformHierarchy2D;
+
+    using Math::MaxFloatChars;
+    using Math::MaxFormattedSize;
+    using Math::ToChars;
+    using Math::FromChars;
+
+    using Math::TraceOp;
+    using Math::WorkloadRecorder;
+    using Math::WorkloadTrace;
+
+    // MATH_TRACE_SCOPE is a macro and cannot be exported; include Trace.h to use it
+    namespace Trace {
+        using Math::Trace::Event;
+        using Math::Trace::RingBuffer;
+        using Math::Trace::ThreadBufferCapacity;
+        using Math::Trace::SetEnabled;
+        using Math::Trace::IsEnabled;
+        using Math::Trace::Now;
+        using Math::Trace::Record;
+        using Math::Trace::GetDroppedEventCount;
+        using Math::Trace::WriteChromeJson;
+        using Math::Trace::SaveChromeJson;
+        using Math::Trace::ScopedEvent;
+    }
+
+    using Math::WorkerPool;
+
+    using Math::ParticleEmitter;
+    using Math::ParticleAttractor;
+    using Math::ParticleSystem;
+    using Math::NeighborGrid2D;
+    using Math::SteeringSettings;
+    using Math::SteeringAgents;
+    using Math::CrowdSteering;
+    using Math::FlowField;
+    using Math::NavPathRequest;
+    using Math::NavMesh;
+    using Math::NavMeshQuery;
+    using Math::ClothSphereCollider;
+    using Math::ClothPlaneCollider;
+    using Math::ClothDistanceConstraint;
+    using Math::ClothSolver;
+    using Math::SphSettings;
+    using Math::SphFluid;
+
+} // namespace Math
@@ -0,0 +1,63 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef MATH_FWD_H
+#define MATH_FWD_H
+
+#include <cstdint>
+
+/**
+ * @file MathFwd.h
+ * @brief Forward declarations of every math type.
+ *
+ * Include this instead of the full headers wherever types are only named, passed by
+ * reference or pointer, or used as return types of declarations. Translation units that
+ * include such a header only pay for the full definitions when they actually use them.
+ */
+namespace Math {
+
+    struct Vector2D;
+    struct Vector3D;
+
+    struct Matrix2D;
+    struct Matrix3D;
+    struct Matrix4D;
+
+    enum class Matrix4DKind : std::uint8_t;
+    struct TaggedMatrix4D;
+
+    enum class TransformFlags : std::uint8_t;
+    class Transform2D;
+
+    struct Transform2DHandle;
+    struct Transform2DReparent;
+    class TransformHierarchy2D;
+
+    enum class TraceOp : std::uint8_t;
+    class WorkloadRecorder;
+    class WorkloadTrace;
+
+    class WorkerPool;
+
+    struct ParticleEmitter;
+    struct ParticleAttractor;
+    class ParticleSystem;
+    class NeighborGrid2D;
+    struct SteeringSettings;
+    struct SteeringAgents;
+    class CrowdSteering;
+    class FlowField;
+    struct NavPathRequest;
+    class NavMesh;
+    class NavMeshQuery;
+    struct ClothSphereCollider;
+    struct ClothPlaneCollider;
+    struct ClothDistanceConstraint;
+    class ClothSolver;
+    struct SphSettings;
+    class SphFluid;
+
+} // namespace Math
+
+#endif // MATH_FWD_H
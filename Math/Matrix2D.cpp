@@ -0,0 +1,24 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Matrix2D.h"
+#include <iostream>
+
+namespace Math {
+
+    void Matrix2D::Print(const char* label) const {
+        if (label) {
+            std::cout << label << ":\n";
+        }
+        std::cout << "[" << m00 << ", " << m01 << "]\n"
+                  << "[" << m10 << ", " << m11 << "]\n";
+    }
+
+    std::ostream &operator<<(std::ostream &os, const Matrix2D &Matrix) {
+        os << "[" << Matrix.m00 << ", " << Matrix.m01 << "]\n"
+           << "[" << Matrix.m10 << ", " << Matrix.m11 << "]\n";
+        return os;
+    }
+
+} // namespace Math
@@ -6,8 +6,10 @@
 #define MATRIX2D_H
 
 #include <cmath>
-#include <iostream>
+#include <iosfwd>
+#include <stdexcept>
 
+#include "ScalarMath.h"
 #include "Vector2D.h"
 
 namespace Math {
@@ -158,8 +160,8 @@ namespace Math {
          * @return A 2x2 matrix representing the rotation.
          */
         static inline Matrix2D RotationRad(float RadAngle) {
-            float Cos = std::cos(RadAngle);
-            float Sin = std::sin(RadAngle);
+            float Cos = Math::Cos(RadAngle);
+            float Sin = Math::Sin(RadAngle);
             return Matrix2D(
                     Cos, -Sin,
                     Sin, Cos
@@ -357,13 +359,7 @@ namespace Math {
         /**
          * Prints the matrix to the console.
          */
-        inline void Print(const char* label = nullptr) const {
-            if (label) {
-                std::cout << label << ":\n";
-            }
-            std::cout << "[" << m00 << ", " << m01 << "]\n"
-                      << "[" << m10 << ", " << m11 << "]\n";
-        }
+        void Print(const char* label = nullptr) const;
 
         /**
          * Returns a rotated matrix.
@@ -513,11 +509,7 @@ namespace Math {
          * @param Matrix The matrix to print.
          * @return The output stream.
          */
-        friend std::ostream &operator<<(std::ostream &os, const Matrix2D &Matrix) {
-            os << "[" << Matrix.m00 << ", " << Matrix.m01 << "]\n"
-               << "[" << Matrix.m10 << ", " << Matrix.m11 << "]\n";
-            return os;
-        }
+        friend std::ostream &operator<<(std::ostream &os, const Matrix2D &Matrix);
 
     };
 } // namespace Math
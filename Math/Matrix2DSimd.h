@@ -0,0 +1,233 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef MATRIX2D_SIMD_H
+#define MATRIX2D_SIMD_H
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+#include "Matrix2D.h"
+#include "SimdConfig.h"
+#include "Vector2D.h"
+
+namespace Math {
+
+    static_assert(sizeof(Matrix2D) == 4 * sizeof(float), "Matrix2D must be exactly four packed floats");
+    static_assert(sizeof(Vector2D) == 2 * sizeof(float), "Vector2D must be exactly two packed floats");
+
+    /**
+     * @brief Vectorized Matrix2D operations.
+     *
+     * A Matrix2D is four floats in row-major order (m00, m01, m10, m11), which fits a single
+     * 128-bit register; two Vector2D values fit one register as well. These functions load
+     * matrices and vector pairs directly and use shuffles instead of scalar element access.
+     * When SSE2 is unavailable (or MATHENGINE_NO_SIMD is defined) they fall back to the
+     * scalar Matrix2D implementation and produce the same results.
+     */
+    namespace Simd {
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        /**
+         * @brief Loads a matrix into one register as (m00, m01, m10, m11).
+         */
+        inline __m128 Load(const Matrix2D& matrix) {
+            return _mm_loadu_ps(&matrix.m00);
+        }
+
+        /**
+         * @brief Stores a register laid out as (m00, m01, m10, m11) into a matrix.
+         */
+        inline Matrix2D Store(__m128 value) {
+            Matrix2D result;
+            _mm_storeu_ps(&result.m00, value);
+            return result;
+        }
+#endif
+
+        /**
+         * @brief Multiplies two matrices (a * b).
+         *
+         * Computes all four elements at once as
+         *          (a00, a00, a10, a10) * (b00, b01, b00, b01) + (a01, a01, a11, a11) * (b10, b11, b10, b11)
+         *
+         * @param a The left matrix
+         * @param b The right matrix
+         * @return The product of the two matrices
+         */
+        inline Matrix2D Multiply(const Matrix2D& a, const Matrix2D& b) {
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 va = Load(a);
+            const __m128 vb = Load(b);
+            const __m128 left = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(2, 2, 0, 0)),
+                                           _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(1, 0, 1, 0)));
+            const __m128 right = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 3, 1, 1)),
+                                            _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 2, 3, 2)));
+            return Store(_mm_add_ps(left, right));
+#else
+            return a * b;
+#endif
+        }
+
+        /**
+         * @brief Calculates the determinant of the matrix.
+         *
+         * Multiplies the matrix by its reversed self, (m00, m01, m10, m11) * (m11, m10, m01, m00),
+         * and subtracts the second lane from the first.
+         *
+         * @param matrix The matrix
+         * @return The determinant of the matrix
+         */
+        inline float Determinant(const Matrix2D& matrix) {
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 v = Load(matrix);
+            const __m128 products = _mm_mul_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)));
+            const __m128 cross = _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1));
+            return _mm_cvtss_f32(_mm_sub_ss(products, cross));
+#else
+            return matrix.Determinant();
+#endif
+        }
+
+        /**
+         * @brief Transposes the matrix with a single shuffle.
+         *
+         * @param matrix The matrix
+         * @return The transposed matrix
+         */
+        inline Matrix2D Transpose(const Matrix2D& matrix) {
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 v = Load(matrix);
+            return Store(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 2, 0)));
+#else
+            return matrix.Transpose();
+#endif
+        }
+
+        /**
+         * @brief Calculates the inverse of the matrix.
+         *
+         * The adjoint (m11, -m01, -m10, m00) is built with one shuffle and a sign flip,
+         * then scaled by the reciprocal of the determinant.
+         *
+         * @param matrix The matrix
+         * @return The inverse of the matrix
+         * @throws std::runtime_error if the matrix is singular
+         */
+        inline Matrix2D Inverse(const Matrix2D& matrix) {
+#if defined(MATHENGINE_SIMD_SSE2)
+            const float det = Determinant(matrix);
+            if (det == 0) {
+                throw std::runtime_error("Matrix is singular and cannot be inverted.");
+            }
+
+            const __m128 v = Load(matrix);
+            const __m128 signMask = _mm_set_ps(0.0f, -0.0f, -0.0f, 0.0f);
+            const __m128 adjoint = _mm_xor_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 2, 1, 3)), signMask);
+            return Store(_mm_div_ps(adjoint, _mm_set1_ps(det)));
+#else
+            return matrix.Inverse();
+#endif
+        }
+
+        /**
+         * @brief Multiplies an array of vectors by a matrix (out[i] = matrix * vectors[i]).
+         *
+         * Two vectors are processed per register and four per loop iteration. The output
+         * may alias the input for in-place transformation.
+         *
+         * @param matrix The matrix to apply
+         * @param vectors The input vectors
+         * @param outVectors Destination for the transformed vectors (same size as vectors)
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        inline void TransformVectors(const Matrix2D& matrix, std::span<const Vector2D> vectors,
+                                     std::span<Vector2D> outVectors) {
+            if (vectors.size() != outVectors.size()) {
+                throw std::invalid_argument("Input and output spans must have the same size");
+            }
+
+            const std::size_t count = vectors.size();
+            std::size_t i = 0;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+            // Columns of the matrix, repeated for two vectors: (m00, m10, m00, m10) and (m01, m11, m01, m11)
+            const __m128 column0 = _mm_setr_ps(matrix.m00, matrix.m10, matrix.m00, matrix.m10);
+            const __m128 column1 = _mm_setr_ps(matrix.m01, matrix.m11, matrix.m01, matrix.m11);
+
+            const float* in = &vectors.data()->x;
+            float* out = &outVectors.data()->x;
+
+            // Each register holds (x0, y0, x1, y1)
+            auto transformPair = [&](__m128 pair) {
+                const __m128 xs = _mm_shuffle_ps(pair, pair, _MM_SHUFFLE(2, 2, 0, 0));
+                const __m128 ys = _mm_shuffle_ps(pair, pair, _MM_SHUFFLE(3, 3, 1, 1));
+                return _mm_add_ps(_mm_mul_ps(xs, column0), _mm_mul_ps(ys, column1));
+            };
+
+            for (; i + 4 <= count; i += 4) {
+                const __m128 first = _mm_loadu_ps(in + 2 * i);
+                const __m128 second = _mm_loadu_ps(in + 2 * i + 4);
+                _mm_storeu_ps(out + 2 * i, transformPair(first));
+                _mm_storeu_ps(out + 2 * i + 4, transformPair(second));
+            }
+            for (; i + 2 <= count; i += 2) {
+                _mm_storeu_ps(out + 2 * i, transformPair(_mm_loadu_ps(in + 2 * i)));
+            }
+#endif
+
+            for (; i < count; ++i) {
+                outVectors[i] = matrix * vectors[i];
+            }
+        }
+
+        /**
+         * @brief Multiplies vectors stored as separate x and y arrays by a matrix.
+         *
+         * Four vectors are processed per instruction.
+         *
+         * @param matrix The matrix to apply
+         * @param xs X components of the input vectors
+         * @param ys Y components of the input vectors
+         * @param outXs Destination for the transformed x components
+         * @param outYs Destination for the transformed y components
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        inline void TransformVectors(const Matrix2D& matrix, std::span<const float> xs, std::span<const float> ys,
+                                     std::span<float> outXs, std::span<float> outYs) {
+            if (xs.size() != ys.size() || xs.size() != outXs.size() || xs.size() != outYs.size()) {
+                throw std::invalid_argument("Input and output spans must have the same size");
+            }
+
+            const std::size_t count = xs.size();
+            std::size_t i = 0;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 m00 = _mm_set1_ps(matrix.m00);
+            const __m128 m01 = _mm_set1_ps(matrix.m01);
+            const __m128 m10 = _mm_set1_ps(matrix.m10);
+            const __m128 m11 = _mm_set1_ps(matrix.m11);
+
+            for (; i + 4 <= count; i += 4) {
+                const __m128 x = _mm_loadu_ps(xs.data() + i);
+                const __m128 y = _mm_loadu_ps(ys.data() + i);
+                _mm_storeu_ps(outXs.data() + i, _mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)));
+                _mm_storeu_ps(outYs.data() + i, _mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)));
+            }
+#endif
+
+            for (; i < count; ++i) {
+                const float x = xs[i];
+                const float y = ys[i];
+                outXs[i] = matrix.m00 * x + matrix.m01 * y;
+                outYs[i] = matrix.m10 * x + matrix.m11 * y;
+            }
+        }
+
+    } // namespace Simd
+
+} // namespace Math
+
+#endif // MATRIX2D_SIMD_H
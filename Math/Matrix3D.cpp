@@ -0,0 +1,283 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Matrix3D.h"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace Math {
+
+    Matrix3D Matrix3D::RotationAxis(const Vector3D& axis, float angleRadians) {
+        float cosAngle = Math::Cos(angleRadians);
+        float sinAngle = Math::Sin(angleRadians);
+        float oneMinusCos = 1.0f - cosAngle;
+
+        // Ensure the axis is normalized
+        Vector3D normalizedAxis = axis.GetNormalized();
+        float x = normalizedAxis.x;
+        float y = normalizedAxis.y;
+        float z = normalizedAxis.z;
+
+        // Precompute common products
+        float xx = x * x;
+        float xy = x * y;
+        float xz = x * z;
+        float yy = y * y;
+        float yz = y * z;
+        float zz = z * z;
+
+        float xSin = x * sinAngle;
+        float ySin = y * sinAngle;
+        float zSin = z * sinAngle;
+
+        return Matrix3D(
+            cosAngle + xx * oneMinusCos,    xy * oneMinusCos - zSin,      xz * oneMinusCos + ySin,
+            xy * oneMinusCos + zSin,        cosAngle + yy * oneMinusCos,  yz * oneMinusCos - xSin,
+            xz * oneMinusCos - ySin,        yz * oneMinusCos + xSin,      cosAngle + zz * oneMinusCos
+        );
+    }
+
+    Matrix3D Matrix3D::RotationEuler(float xRadians, float yRadians, float zRadians) {
+        Matrix3D xRot = RotationX(xRadians);
+        Matrix3D yRot = RotationY(yRadians);
+        Matrix3D zRot = RotationZ(zRadians);
+
+        // Apply rotations in the order Z, Y, X
+        return xRot * yRot * zRot;
+    }
+
+    Matrix3D Matrix3D::RotationEulerDegrees(float xDegrees, float yDegrees, float zDegrees) {
+        constexpr float degToRad = M_PI / 180.0f;
+        return RotationEuler(
+            xDegrees * degToRad,
+            yDegrees * degToRad,
+            zDegrees * degToRad
+        );
+    }
+
+    Matrix3D Matrix3D::LookAt(const Vector3D& direction, const Vector3D& up) {
+        // Ensure the direction is normalized
+        Vector3D forward = direction.GetNormalized();
+
+        // Compute right vector via cross product
+        Vector3D right = up.Cross(forward).GetNormalized();
+
+        // Recompute up vector to ensure orthogonality
+        Vector3D newUp = forward.Cross(right);
+
+        // Construct rotation matrix from the three orthogonal vectors
+        return Matrix3D(
+            right.x, right.y, right.z,
+            newUp.x, newUp.y, newUp.z,
+            forward.x, forward.y, forward.z
+        );
+    }
+
+    Matrix3D Matrix3D::Reflection(const Vector3D& normal) {
+        // Ensure the normal is normalized
+        Vector3D normalizedNormal = normal.GetNormalized();
+        float x = normalizedNormal.x;
+        float y = normalizedNormal.y;
+        float z = normalizedNormal.z;
+
+        float xx = 2.0f * x * x;
+        float xy = 2.0f * x * y;
+        float xz = 2.0f * x * z;
+        float yy = 2.0f * y * y;
+        float yz = 2.0f * y * z;
+        float zz = 2.0f * z * z;
+
+        return Matrix3D(
+            1.0f - xx, -xy, -xz,
+            -xy, 1.0f - yy, -yz,
+            -xz, -yz, 1.0f - zz
+        );
+    }
+
+    Vector3D Matrix3D::ExtractScale() const {
+        Vector3D col0(m00, m10, m20);
+        Vector3D col1(m01, m11, m21);
+        Vector3D col2(m02, m12, m22);
+
+        return Vector3D(
+            col0.Length(),
+            col1.Length(),
+            col2.Length()
+        );
+    }
+
+    Matrix3D Matrix3D::ExtractRotation() const {
+        Vector3D scale = ExtractScale();
+
+        // Prevent division by zero
+        if (scale.x < 1e-6f || scale.y < 1e-6f || scale.z < 1e-6f) {
+            return Identity();
+        }
+
+        // Remove scaling to get pure rotation
+        return Matrix3D(
+            m00 / scale.x, m01 / scale.y, m02 / scale.z,
+            m10 / scale.x, m11 / scale.y, m12 / scale.z,
+            m20 / scale.x, m21 / scale.y, m22 / scale.z
+        );
+    }
+
+    Matrix3D Matrix3D::ProjectionOntoPlane(const Vector3D& normal) {
+        // Ensure the normal is normalized
+        Vector3D normalizedNormal = normal.GetNormalized();
+        float x = normalizedNormal.x;
+        float y = normalizedNormal.y;
+        float z = normalizedNormal.z;
+
+        float xx = x * x;
+        float xy = x * y;
+        float xz = x * z;
+        float yy = y * y;
+        float yz = y * z;
+        float zz = z * z;
+
+        return Matrix3D(
+            1.0f - xx, -xy, -xz,
+            -xy, 1.0f - yy, -yz,
+            -xz, -yz, 1.0f - zz
+        );
+    }
+
+    Vector3D Matrix3D::CalculateEigenvalues() {
+        // Ensure the matrix is symmetric
+        if (!IsSymmetric()) {
+            throw std::runtime_error("Eigenvalue calculation requires a symmetric matrix");
+        }
+
+        // Use the characteristic equation for a 3x3 matrix
+        // λ³ - tr(A)λ² + (m00m11 + m11m22 + m00m22 - m01² - m12² - m02²)λ - det(A) = 0
+
+        float a = -Trace();
+        float b = m00 * m11 + m11 * m22 + m00 * m22 -
+                 m01 * m01 - m12 * m12 - m02 * m02;
+        float c = -Determinant();
+
+        // This is a cubic equation. For simplicity, we'll use a numerical method
+        // For a more robust implementation, consider using a dedicated eigenvalue solver
+
+        // For this example, we'll implement a simple power iteration method
+        // which works well for symmetric matrices
+
+        Vector3D eigenvalues;
+        Vector3D v = Vector3D(1, 1, 1).GetNormalized(); // Starting vector
+
+        for (int i = 0; i < 3; i++) {
+            // Power iteration for largest eigenvalue
+            for (int iter = 0; iter < 30; iter++) { // Usually converges in fewer iterations
+                Vector3D new_v = (*this) * v;
+                float length = new_v.Length();
+
+                if (length < 1e-10f) {
+                    // Matrix likely has a zero eigenvalue
+                    eigenvalues[i] = 0;
+                    break;
+                }
+
+                new_v = new_v / length;
+
+                // Check for convergence
+                if ((new_v - v).Length() < 1e-6f || (new_v + v).Length() < 1e-6f) {
+                    eigenvalues[i] = v.Dot((*this) * v); // Rayleigh quotient
+                    break;
+                }
+
+                v = new_v;
+
+                if (iter == 29) {
+                    // Failed to converge
+                    throw std::runtime_error("Eigenvalue calculation failed to converge");
+                }
+            }
+
+            // Deflation - remove the found eigenvalue/eigenvector
+            if (i < 2) { // We don't need to do this for the last eigenvalue
+                Matrix3D vvT(
+                    v.x * v.x, v.x * v.y, v.x * v.z,
+                    v.y * v.x, v.y * v.y, v.y * v.z,
+                    v.z * v.x, v.z * v.y, v.z * v.z
+                );
+
+                *this = *this - vvT * eigenvalues[i];
+
+                // For the next eigenvalue, start with a vector orthogonal to v
+                if (i == 0) {
+                    if (std::fabs(v.x) > std::fabs(v.y)) {
+                        v = Vector3D(-v.z, 0, v.x).GetNormalized();
+                    } else {
+                        v = Vector3D(0, -v.z, v.y).GetNormalized();
+                    }
+                }
+            }
+        }
+
+        return eigenvalues;
+    }
+
+    // Output
+
+    std::ostream& operator<<(std::ostream& os, const Matrix3D& m) {
+        os << "[" << m.m00 << ", " << m.m01 << ", " << m.m02 << "]\n"
+           << "[" << m.m10 << ", " << m.m11 << ", " << m.m12 << "]\n"
+           << "[" << m.m20 << ", " << m.m21 << ", " << m.m22 << "]";
+        return os;
+    }
+
+    void Matrix3D::Print(const char* label) const {
+        if (label) {
+            std::cout << label << ":\n";
+        }
+        std::cout << *this << std::endl;
+    }
+
+    std::string Matrix3D::ToString() const {
+        std::ostringstream ss;
+        ss << *this;
+        return ss.str();
+    }
+
+    Matrix3D Matrix3D::Orthogonalize() const {
+        // Extract column vectors
+        Vector3D v1 = GetColumn(0);
+        Vector3D v2 = GetColumn(1);
+        Vector3D v3 = GetColumn(2);
+
+        // Gram-Schmidt process
+        Vector3D u1 = v1.GetNormalized();
+
+        Vector3D u2 = v2 - u1 * v2.Dot(u1);
+        float len2 = u2.Length();
+        if (len2 > 1e-6f) {
+            u2 = u2 / len2;
+        } else {
+            // Generate a vector orthogonal to u1
+            if (std::fabs(u1.x) < std::fabs(u1.y)) {
+                if (std::fabs(u1.x) < std::fabs(u1.z)) {
+                    u2 = Vector3D(1, 0, 0) - u1 * u1.x;
+                } else {
+                    u2 = Vector3D(0, 0, 1) - u1 * u1.z;
+                }
+            } else {
+                if (std::fabs(u1.y) < std::fabs(u1.z)) {
+                    u2 = Vector3D(0, 1, 0) - u1 * u1.y;
+                } else {
+                    u2 = Vector3D(0, 0, 1) - u1 * u1.z;
+                }
+            }
+            u2 = u2.GetNormalized();
+        }
+
+        // u3 is orthogonal to both u1 and u2
+        Vector3D u3 = u1.Cross(u2);
+
+        return Matrix3D(u1, u2, u3);
+    }
+
+} // namespace Math
@@ -8,10 +8,11 @@
 
 #include <cmath>
 #include <array>
-#include <iostream>
-#include <sstream>
+#include <iosfwd>
+#include <string>
 #include <stdexcept>
 
+#include "ScalarMath.h"
 #include "Vector3D.h"
 #include "Constants.h"
 
@@ -442,7 +443,7 @@ namespace Math {
          *
          * @return The determinant of the matrix
          */
-        [[nodiscard]] float Determinant() const {
+        [[nodiscard]] constexpr float Determinant() const {
             return m00 * (m11 * m22 - m12 * m21) -
                    m01 * (m10 * m22 - m12 * m20) +
                    m02 * (m10 * m21 - m11 * m20);
@@ -492,7 +493,7 @@ namespace Math {
          *
          * @return The adjoint matrix
          */
-        [[nodiscard]] Matrix3D Adjoint() const {
+        [[nodiscard]] constexpr Matrix3D Adjoint() const {
             // Calculate cofactors
             float c00 = m11 * m22 - m12 * m21;
             float c01 = m10 * m22 - m12 * m20;
@@ -520,13 +521,15 @@ namespace Math {
          * The inverse is calculated as:
          * inverse = adjoint / determinant
          *
+         * Usable in constant expressions, so inverses of constant matrices are computed at compile time.
+         *
          * @return The inverse matrix
          * @throws std::runtime_error if the matrix is singular (determinant is zero)
          */
-        [[nodiscard]] Matrix3D Inverse() const {
+        [[nodiscard]] constexpr Matrix3D Inverse() const {
             float det = Determinant();
             
-            if (std::fabs(det) < 1e-6f) {
+            if (det > -1e-6f && det < 1e-6f) {
                 throw std::runtime_error("Matrix is singular and cannot be inverted");
             }
             
@@ -726,8 +729,8 @@ namespace Math {
          * @return A rotation matrix around the X axis
          */
         static Matrix3D RotationX(float angleRadians) {
-            float cosAngle = std::cos(angleRadians);
-            float sinAngle = std::sin(angleRadians);
+            float cosAngle = Math::Cos(angleRadians);
+            float sinAngle = Math::Sin(angleRadians);
             
             return Matrix3D(
                 1.0f, 0.0f, 0.0f,
@@ -743,8 +746,8 @@ namespace Math {
          * @return A rotation matrix around the Y axis
          */
         static Matrix3D RotationY(float angleRadians) {
-            float cosAngle = std::cos(angleRadians);
-            float sinAngle = std::sin(angleRadians);
+            float cosAngle = Math::Cos(angleRadians);
+            float sinAngle = Math::Sin(angleRadians);
             
             return Matrix3D(
                 cosAngle, 0.0f, sinAngle,
@@ -760,8 +763,8 @@ namespace Math {
          * @return A rotation matrix around the Z axis
          */
         static Matrix3D RotationZ(float angleRadians) {
-            float cosAngle = std::cos(angleRadians);
-            float sinAngle = std::sin(angleRadians);
+            float cosAngle = Math::Cos(angleRadians);
+            float sinAngle = Math::Sin(angleRadians);
             
             return Matrix3D(
                 cosAngle, -sinAngle, 0.0f,
@@ -778,35 +781,7 @@ namespace Math {
          * @param angleRadians The rotation angle in radians
          * @return A rotation matrix around the specified axis
          */
-        static Matrix3D RotationAxis(const Vector3D& axis, float angleRadians) {
-            float cosAngle = std::cos(angleRadians);
-            float sinAngle = std::sin(angleRadians);
-            float oneMinusCos = 1.0f - cosAngle;
-
-            // Ensure the axis is normalized
-            Vector3D normalizedAxis = axis.GetNormalized();
-            float x = normalizedAxis.x;
-            float y = normalizedAxis.y;
-            float z = normalizedAxis.z;
-
-            // Precompute common products
-            float xx = x * x;
-            float xy = x * y;
-            float xz = x * z;
-            float yy = y * y;
-            float yz = y * z;
-            float zz = z * z;
-
-            float xSin = x * sinAngle;
-            float ySin = y * sinAngle;
-            float zSin = z * sinAngle;
-
-            return Matrix3D(
-                cosAngle + xx * oneMinusCos,    xy * oneMinusCos - zSin,      xz * oneMinusCos + ySin,
-                xy * oneMinusCos + zSin,        cosAngle + yy * oneMinusCos,  yz * oneMinusCos - xSin,
-                xz * oneMinusCos - ySin,        yz * oneMinusCos + xSin,      cosAngle + zz * oneMinusCos
-            );
-        }
+        static Matrix3D RotationAxis(const Vector3D& axis, float angleRadians);
 
         /**
          * @brief Creates a rotation matrix from Euler angles (in radians).
@@ -818,14 +793,7 @@ namespace Math {
          * @param zRadians Rotation around Z axis in radians (yaw)
          * @return A combined rotation matrix
          */
-        static Matrix3D RotationEuler(float xRadians, float yRadians, float zRadians) {
-            Matrix3D xRot = RotationX(xRadians);
-            Matrix3D yRot = RotationY(yRadians);
-            Matrix3D zRot = RotationZ(zRadians);
-
-            // Apply rotations in the order Z, Y, X
-            return xRot * yRot * zRot;
-        }
+        static Matrix3D RotationEuler(float xRadians, float yRadians, float zRadians);
 
         /**
          * @brief Creates a rotation matrix from Euler angles specified in degrees.
@@ -837,14 +805,7 @@ namespace Math {
          * @param zDegrees Rotation around Z axis in degrees (yaw)
          * @return A combined rotation matrix
          */
-        static Matrix3D RotationEulerDegrees(float xDegrees, float yDegrees, float zDegrees) {
-            constexpr float degToRad = M_PI / 180.0f;
-            return RotationEuler(
-                xDegrees * degToRad,
-                yDegrees * degToRad,
-                zDegrees * degToRad
-            );
-        }
+        static Matrix3D RotationEulerDegrees(float xDegrees, float yDegrees, float zDegrees);
 
         /**
          * @brief Creates a rotation matrix to align with the specified direction.
@@ -855,23 +816,7 @@ namespace Math {
          * @param up The up vector used to determine orientation (default is world up)
          * @return A rotation matrix aligning with the specified direction
          */
-        static Matrix3D LookAt(const Vector3D& direction, const Vector3D& up = Vector3D(0, 1, 0)) {
-            // Ensure the direction is normalized
-            Vector3D forward = direction.GetNormalized();
-
-            // Compute right vector via cross product
-            Vector3D right = up.Cross(forward).GetNormalized();
-
-            // Recompute up vector to ensure orthogonality
-            Vector3D newUp = forward.Cross(right);
-
-            // Construct rotation matrix from the three orthogonal vectors
-            return Matrix3D(
-                right.x, right.y, right.z,
-                newUp.x, newUp.y, newUp.z,
-                forward.x, forward.y, forward.z
-            );
-        }
+        static Matrix3D LookAt(const Vector3D& direction, const Vector3D& up = Vector3D(0, 1, 0));
 
         /**
          * @brief Creates a reflection matrix that reflects across a plane.
@@ -879,26 +824,7 @@ namespace Math {
          * @param normal The normal vector of the reflection plane (should be normalized)
          * @return A reflection matrix
          */
-        static Matrix3D Reflection(const Vector3D& normal) {
-            // Ensure the normal is normalized
-            Vector3D normalizedNormal = normal.GetNormalized();
-            float x = normalizedNormal.x;
-            float y = normalizedNormal.y;
-            float z = normalizedNormal.z;
-
-            float xx = 2.0f * x * x;
-            float xy = 2.0f * x * y;
-            float xz = 2.0f * x * z;
-            float yy = 2.0f * y * y;
-            float yz = 2.0f * y * z;
-            float zz = 2.0f * z * z;
-
-            return Matrix3D(
-                1.0f - xx, -xy, -xz,
-                -xy, 1.0f - yy, -yz,
-                -xz, -yz, 1.0f - zz
-            );
-        }
+        static Matrix3D Reflection(const Vector3D& normal);
 
         /**
          * @brief Creates a shearing matrix.
@@ -945,38 +871,14 @@ namespace Math {
          *
          * @return A vector containing the scale factors along each axis
          */
-        [[nodiscard]] Vector3D ExtractScale() const {
-            Vector3D col0(m00, m10, m20);
-            Vector3D col1(m01, m11, m21);
-            Vector3D col2(m02, m12, m22);
-
-            return Vector3D(
-                col0.Length(),
-                col1.Length(),
-                col2.Length()
-            );
-        }
+        [[nodiscard]] Vector3D ExtractScale() const;
 
         /**
          * @brief Extracts the rotation matrix by removing scaling.
          *
          * @return A rotation-only matrix
          */
-        [[nodiscard]] Matrix3D ExtractRotation() const {
-            Vector3D scale = ExtractScale();
-
-            // Prevent division by zero
-            if (scale.x < 1e-6f || scale.y < 1e-6f || scale.z < 1e-6f) {
-                return Identity();
-            }
-
-            // Remove scaling to get pure rotation
-            return Matrix3D(
-                m00 / scale.x, m01 / scale.y, m02 / scale.z,
-                m10 / scale.x, m11 / scale.y, m12 / scale.z,
-                m20 / scale.x, m21 / scale.y, m22 / scale.z
-            );
-        }
+        [[nodiscard]] Matrix3D ExtractRotation() const;
 
         /**
          * @brief Linearly interpolates between two matrices.
@@ -1003,26 +905,7 @@ namespace Math {
          * @param normal The normal vector of the projection plane (should be normalized)
          * @return A projection matrix
          */
-        static Matrix3D ProjectionOntoPlane(const Vector3D& normal) {
-            // Ensure the normal is normalized
-            Vector3D normalizedNormal = normal.GetNormalized();
-            float x = normalizedNormal.x;
-            float y = normalizedNormal.y;
-            float z = normalizedNormal.z;
-
-            float xx = x * x;
-            float xy = x * y;
-            float xz = x * z;
-            float yy = y * y;
-            float yz = y * z;
-            float zz = z * z;
-
-            return Matrix3D(
-                1.0f - xx, -xy, -xz,
-                -xy, 1.0f - yy, -yz,
-                -xz, -yz, 1.0f - zz
-            );
-        }
+        static Matrix3D ProjectionOntoPlane(const Vector3D& normal);
 
         /**
          * @brief Calculates the eigenvalues of the matrix.
@@ -1035,80 +918,7 @@ namespace Math {
          * @return A vector containing the eigenvalues
          * @throws std::runtime_error if the algorithm fails to converge
          */
-        [[nodiscard]] Vector3D CalculateEigenvalues() {
-            // Ensure the matrix is symmetric
-            if (!IsSymmetric()) {
-                throw std::runtime_error("Eigenvalue calculation requires a symmetric matrix");
-            }
-
-            // Use the characteristic equation for a 3x3 matrix
-            // λ³ - tr(A)λ² + (m00m11 + m11m22 + m00m22 - m01² - m12² - m02²)λ - det(A) = 0
-
-            float a = -Trace();
-            float b = m00 * m11 + m11 * m22 + m00 * m22 -
-                     m01 * m01 - m12 * m12 - m02 * m02;
-            float c = -Determinant();
-
-            // This is a cubic equation. For simplicity, we'll use a numerical method
-            // For a more robust implementation, consider using a dedicated eigenvalue solver
-
-            // For this example, we'll implement a simple power iteration method
-            // which works well for symmetric matrices
-
-            Vector3D eigenvalues;
-            Vector3D v = Vector3D(1, 1, 1).GetNormalized(); // Starting vector
-
-            for (int i = 0; i < 3; i++) {
-                // Power iteration for largest eigenvalue
-                for (int iter = 0; iter < 30; iter++) { // Usually converges in fewer iterations
-                    Vector3D new_v = (*this) * v;
-                    float length = new_v.Length();
-
-                    if (length < 1e-10f) {
-                        // Matrix likely has a zero eigenvalue
-                        eigenvalues[i] = 0;
-                        break;
-                    }
-
-                    new_v = new_v / length;
-
-                    // Check for convergence
-                    if ((new_v - v).Length() < 1e-6f || (new_v + v).Length() < 1e-6f) {
-                        eigenvalues[i] = v.Dot((*this) * v); // Rayleigh quotient
-                        break;
-                    }
-
-                    v = new_v;
-
-                    if (iter == 29) {
-                        // Failed to converge
-                        throw std::runtime_error("Eigenvalue calculation failed to converge");
-                    }
-                }
-
-                // Deflation - remove the found eigenvalue/eigenvector
-                if (i < 2) { // We don't need to do this for the last eigenvalue
-                    Matrix3D vvT(
-                        v.x * v.x, v.x * v.y, v.x * v.z,
-                        v.y * v.x, v.y * v.y, v.y * v.z,
-                        v.z * v.x, v.z * v.y, v.z * v.z
-                    );
-
-                    *this = *this - vvT * eigenvalues[i];
-
-                    // For the next eigenvalue, start with a vector orthogonal to v
-                    if (i == 0) {
-                        if (std::fabs(v.x) > std::fabs(v.y)) {
-                            v = Vector3D(-v.z, 0, v.x).GetNormalized();
-                        } else {
-                            v = Vector3D(0, -v.z, v.y).GetNormalized();
-                        }
-                    }
-                }
-            }
-
-            return eigenvalues;
-        }
+        [[nodiscard]] Vector3D CalculateEigenvalues();
 
         [[nodiscard]] constexpr Matrix3D operator/(float scalar) const {
             if (std::abs(scalar) < Constants::EPSILON) {
@@ -1207,35 +1017,21 @@ namespace Math {
          * @param m The matrix to output
          * @return The output stream
          */
-        friend std::ostream& operator<<(std::ostream& os, const Matrix3D& m) {
-            os << "[" << m.m00 << ", " << m.m01 << ", " << m.m02 << "]\n"
-               << "[" << m.m10 << ", " << m.m11 << ", " << m.m12 << "]\n"
-               << "[" << m.m20 << ", " << m.m21 << ", " << m.m22 << "]";
-            return os;
-        }
+        friend std::ostream& operator<<(std::ostream& os, const Matrix3D& m);
 
         /**
          * @brief Print the matrix to the console with an optional label.
          *
          * @param label An optional label to print before the matrix
          */
-        void Print(const char* label = nullptr) const {
-            if (label) {
-                std::cout << label << ":\n";
-            }
-            std::cout << *this << std::endl;
-        }
+        void Print(const char* label = nullptr) const;
 
         /**
          * @brief Convert the matrix to a formatted string.
          *
          * @return A string representation of the matrix
          */
-        [[nodiscard]] std::string ToString() const {
-            std::ostringstream ss;
-            ss << *this;
-            return ss.str();
-        }
+        [[nodiscard]] std::string ToString() const;
 
         /**
          * @brief Performs matrix orthogonalization using the Gram-Schmidt process.
@@ -1245,42 +1041,7 @@ namespace Math {
          *
          * @return An orthogonalized matrix
          */
-        [[nodiscard]] Matrix3D Orthogonalize() const {
-            // Extract column vectors
-            Vector3D v1 = GetColumn(0);
-            Vector3D v2 = GetColumn(1);
-            Vector3D v3 = GetColumn(2);
-
-            // Gram-Schmidt process
-            Vector3D u1 = v1.GetNormalized();
-
-            Vector3D u2 = v2 - u1 * v2.Dot(u1);
-            float len2 = u2.Length();
-            if (len2 > 1e-6f) {
-                u2 = u2 / len2;
-            } else {
-                // Generate a vector orthogonal to u1
-                if (std::fabs(u1.x) < std::fabs(u1.y)) {
-                    if (std::fabs(u1.x) < std::fabs(u1.z)) {
-                        u2 = Vector3D(1, 0, 0) - u1 * u1.x;
-                    } else {
-                        u2 = Vector3D(0, 0, 1) - u1 * u1.z;
-                    }
-                } else {
-                    if (std::fabs(u1.y) < std::fabs(u1.z)) {
-                        u2 = Vector3D(0, 1, 0) - u1 * u1.y;
-                    } else {
-                        u2 = Vector3D(0, 0, 1) - u1 * u1.z;
-                    }
-                }
-                u2 = u2.GetNormalized();
-            }
-
-            // u3 is orthogonal to both u1 and u2
-            Vector3D u3 = u1.Cross(u2);
-
-            return Matrix3D(u1, u2, u3);
-        }
+        [[nodiscard]] Matrix3D Orthogonalize() const;
 
         /**
          * @brief Accesses the matrix elements using row and column indices.
@@ -0,0 +1,217 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Matrix4D.h"
+#include "Trace.h"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace Math {
+
+void Matrix4D::TransformPoints(std::span<const Vector3D> points, std::span<Vector3D> outPoints) const {
+    MATH_TRACE_SCOPE("Matrix4D::TransformPoints");
+    if (points.size() != outPoints.size()) {
+        throw std::invalid_argument("Input and output spans must have the same size");
+    }
+
+    const std::size_t count = points.size();
+    if (m30 == 0.0f && m31 == 0.0f && m32 == 0.0f && m33 == 1.0f) {
+        // Affine: w is always 1, so no per-point divide or branch
+        for (std::size_t i = 0; i < count; ++i) {
+            const Vector3D p = points[i];
+            outPoints[i] = Vector3D(
+                m00 * p.x + m01 * p.y + m02 * p.z + m03,
+                m10 * p.x + m11 * p.y + m12 * p.z + m13,
+                m20 * p.x + m21 * p.y + m22 * p.z + m23
+            );
+        }
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        outPoints[i] = TransformPoint(points[i]);
+    }
+}
+
+void Matrix4D::TransformVectors(std::span<const Vector3D> vectors, std::span<Vector3D> outVectors) const {
+    MATH_TRACE_SCOPE("Matrix4D::TransformVectors");
+    if (vectors.size() != outVectors.size()) {
+        throw std::invalid_argument("Input and output spans must have the same size");
+    }
+
+    const std::size_t count = vectors.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vector3D v = vectors[i];
+        outVectors[i] = Vector3D(
+            m00 * v.x + m01 * v.y + m02 * v.z,
+            m10 * v.x + m11 * v.y + m12 * v.z,
+            m20 * v.x + m21 * v.y + m22 * v.z
+        );
+    }
+}
+
+Matrix4D Matrix4D::Rotate(const Vector3D& axis, float angleRadians) const {
+    float c = Math::Cos(angleRadians);
+    float s = Math::Sin(angleRadians);
+    float t = 1.0f - c;
+
+    // Normalize the axis
+    Vector3D nAxis = axis.GetNormalized();
+    float x = nAxis.x;
+    float y = nAxis.y;
+    float z = nAxis.z;
+
+    // Create the rotation matrix
+    Matrix4D rotation(
+        // First row
+        t * x * x + c,
+        t * x * y - s * z,
+        t * x * z + s * y,
+        0.0f,
+
+        // Second row
+        t * x * y + s * z,
+        t * y * y + c,
+        t * y * z - s * x,
+        0.0f,
+
+        // Third row
+        t * x * z - s * y,
+        t * y * z + s * x,
+        t * z * z + c,
+        0.0f,
+
+        // Fourth row
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+
+    return *this * rotation;
+}
+
+Matrix4D Matrix4D::CreatePerspective(float fovYRadians, float aspectRatio, float nearPlane, float farPlane) {
+    if (nearPlane <= 0.0f) {
+        throw std::invalid_argument("Near plane must be positive");
+    }
+    if (farPlane <= nearPlane) {
+        throw std::invalid_argument("Far plane must be greater than near plane");
+    }
+
+    float tanHalfFovy = Math::Tan(fovYRadians * 0.5f);
+    float f = 1.0f / tanHalfFovy;
+    float nf = 1.0f / (nearPlane - farPlane);
+
+    return Matrix4D(
+        f / aspectRatio, 0.0f, 0.0f, 0.0f,
+        0.0f, f, 0.0f, 0.0f,
+        0.0f, 0.0f, (farPlane + nearPlane) * nf, -1.0f,
+        0.0f, 0.0f, 2.0f * farPlane * nearPlane * nf, 0.0f
+    );
+}
+
+Matrix4D Matrix4D::CreateOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) {
+    if (left == right) {
+        throw std::invalid_argument("Left cannot equal right");
+    }
+    if (bottom == top) {
+        throw std::invalid_argument("Bottom cannot equal top");
+    }
+    if (nearPlane == farPlane) {
+        throw std::invalid_argument("Near plane cannot equal far plane");
+    }
+
+    float invWidth = 1.0f / (right - left);
+    float invHeight = 1.0f / (top - bottom);
+    float invDepth = 1.0f / (farPlane - nearPlane);
+
+    return Matrix4D(
+        2.0f * invWidth, 0.0f, 0.0f, 0.0f,
+        0.0f, 2.0f * invHeight, 0.0f, 0.0f,
+        0.0f, 0.0f, -2.0f * invDepth, 0.0f,
+        -(right + left) * invWidth, -(top + bottom) * invHeight, -(farPlane + nearPlane) * invDepth, 1.0f
+    );
+}
+
+Matrix4D Matrix4D::CreateLookAt(const Vector3D& eye, const Vector3D& target, const Vector3D& up) {
+    Vector3D f = (target - eye).GetNormalized();
+    Vector3D s = f.Cross(up).GetNormalized();
+    Vector3D u = s.Cross(f);
+
+    return Matrix4D(
+        s.x, s.y, s.z, -s.Dot(eye),
+        u.x, u.y, u.z, -u.Dot(eye),
+        -f.x, -f.y, -f.z, f.Dot(eye),
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
+
+Matrix4D Matrix4D::CreateRotation(const Vector3D& axis, float angleRadians) {
+    float c = Math::Cos(angleRadians);
+    float s = Math::Sin(angleRadians);
+    float t = 1.0f - c;
+
+    // Normalize the axis
+    Vector3D nAxis = axis.GetNormalized();
+    float x = nAxis.x;
+    float y = nAxis.y;
+    float z = nAxis.z;
+
+    return Matrix4D(
+        // First row
+        t * x * x + c,
+        t * x * y - s * z,
+        t * x * z + s * y,
+        0.0f,
+
+        // Second row
+        t * x * y + s * z,
+        t * y * y + c,
+        t * y * z - s * x,
+        0.0f,
+
+        // Third row
+        t * x * z - s * y,
+        t * y * z + s * x,
+        t * z * z + c,
+        0.0f,
+
+        // Fourth row
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
+
+Matrix4D Matrix4D::CreateTransformation(
+    const Vector3D& position,
+    const Vector3D& rotationAxis,
+    float rotationAngleRadians,
+    const Vector3D& scale
+) {
+    Matrix4D scaleMatrix = CreateScale(scale);
+    Matrix4D rotationMatrix = CreateRotation(rotationAxis, rotationAngleRadians);
+    Matrix4D translationMatrix = CreateTranslation(position);
+
+    // Combine transformations: first scale, then rotate, then translate
+    return translationMatrix * rotationMatrix * scaleMatrix;
+}
+
+// Output
+
+std::ostream& operator<<(std::ostream& os, const Matrix4D& matrix) {
+    os << "Matrix4D[\n"
+       << "  [" << matrix.m00 << ", " << matrix.m01 << ", " << matrix.m02 << ", " << matrix.m03 << "]\n"
+       << "  [" << matrix.m10 << ", " << matrix.m11 << ", " << matrix.m12 << ", " << matrix.m13 << "]\n"
+       << "  [" << matrix.m20 << ", " << matrix.m21 << ", " << matrix.m22 << ", " << matrix.m23 << "]\n"
+       << "  [" << matrix.m30 << ", " << matrix.m31 << ", " << matrix.m32 << ", " << matrix.m33 << "]\n"
+       << "]";
+    return os;
+}
+
+std::string Matrix4D::ToString() const {
+    std::ostringstream oss;
+    oss << *this;
+    return oss.str();
+}
+
+} // namespace Math
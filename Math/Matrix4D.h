@@ -7,10 +7,12 @@
 
 #include <array>
 #include <cmath>
-#include <iostream>
+#include <iosfwd>
+#include <span>
 #include <string>
 #include <stdexcept>
 
+#include "ScalarMath.h"
 #include "Vector3D.h"
 #include "Constants.h"
 
@@ -342,6 +344,31 @@ struct Matrix4D {
         );
     }
 
+    /**
+     * @brief Transforms an array of points (w=1) using this matrix.
+     *
+     * Produces the same results as calling TransformPoint on each element. When the bottom
+     * row is (0, 0, 0, 1) the perspective divide is skipped for the whole batch. The output
+     * may alias the input for in-place transformation.
+     *
+     * @param points The points to transform
+     * @param outPoints Destination for the transformed points (same size as points)
+     * @throws std::invalid_argument if the spans differ in size
+     */
+    void TransformPoints(std::span<const Vector3D> points, std::span<Vector3D> outPoints) const;
+
+    /**
+     * @brief Transforms an array of directions (w=0) using this matrix, ignoring translation.
+     *
+     * Produces the same results as calling TransformVector on each element. The output may
+     * alias the input for in-place transformation.
+     *
+     * @param vectors The vectors to transform
+     * @param outVectors Destination for the transformed vectors (same size as vectors)
+     * @throws std::invalid_argument if the spans differ in size
+     */
+    void TransformVectors(std::span<const Vector3D> vectors, std::span<Vector3D> outVectors) const;
+
     /**
      * @brief Multiply this matrix by a scalar.
      *
@@ -530,7 +557,7 @@ struct Matrix4D {
      *
      * @return The determinant value
      */
-    [[nodiscard]] float Determinant() const {
+    [[nodiscard]] constexpr float Determinant() const {
         // Calculate cofactors for the first row
         float c00 = m11 * (m22 * m33 - m23 * m32) - m12 * (m21 * m33 - m23 * m31) + m13 * (m21 * m32 - m22 * m31);
         float c01 = m10 * (m22 * m33 - m23 * m32) - m12 * (m20 * m33 - m23 * m30) + m13 * (m20 * m32 - m22 * m30);
@@ -579,56 +606,71 @@ struct Matrix4D {
     /**
      * @brief Calculate the adjoint (adjugate) of this matrix.
      *
-     * The adjoint is the transpose of the cofactor matrix.
+     * The adjoint is the transpose of the cofactor matrix. Each 3x3 minor is expanded
+     * along its row from the top or bottom half, reusing the 2x2 determinants of the
+     * other half.
      *
      * @return The adjoint matrix
      */
-    [[nodiscard]] Matrix4D Adjoint() const {
-        Matrix4D result;
-
-        // Calculate the cofactors and place them in the transposed position
-        auto minor = [this](int i0, int j0) -> float {
-            // Create a 3x3 submatrix by excluding row i0 and column j0
-            float s[3][3];
-            int si = 0;
-            for (int i = 0; i < 4; i++) {
-                if (i == i0) continue;
-                int sj = 0;
-                for (int j = 0; j < 4; j++) {
-                    if (j == j0) continue;
-                    s[si][sj] = GetElement(i, j);
-                    sj++;
-                }
-                si++;
-            }
-
-            // Calculate the determinant of the 3x3 submatrix
-            return s[0][0] * (s[1][1] * s[2][2] - s[1][2] * s[2][1]) -
-                   s[0][1] * (s[1][0] * s[2][2] - s[1][2] * s[2][0]) +
-                   s[0][2] * (s[1][0] * s[2][1] - s[1][1] * s[2][0]);
-        };
-
-        // Fill the result matrix with cofactors (transposed)
-        for (int i = 0; i < 4; i++) {
-            for (int j = 0; j < 4; j++) {
-                // Cofactor sign: (-1)^(i+j)
-                float sign = ((i + j) % 2 == 0) ? 1.0f : -1.0f;
-                result.SetElement(j, i, sign * minor(i, j)); // Transposed position
-            }
-        }
-
-        return result;
+    [[nodiscard]] constexpr Matrix4D Adjoint() const {
+        // 2x2 determinants of the top rows (0, 1) for each pair of columns
+        const float a01 = m00 * m11 - m01 * m10;
+        const float a02 = m00 * m12 - m02 * m10;
+        const float a03 = m00 * m13 - m03 * m10;
+        const float a12 = m01 * m12 - m02 * m11;
+        const float a13 = m01 * m13 - m03 * m11;
+        const float a23 = m02 * m13 - m03 * m12;
+
+        // 2x2 determinants of the bottom rows (2, 3) for each pair of columns
+        const float b01 = m20 * m31 - m21 * m30;
+        const float b02 = m20 * m32 - m22 * m30;
+        const float b03 = m20 * m33 - m23 * m30;
+        const float b12 = m21 * m32 - m22 * m31;
+        const float b13 = m21 * m33 - m23 * m31;
+        const float b23 = m22 * m33 - m23 * m32;
+
+        // Minors of rows 0 and 1, expanded along the other top row
+        const float minor00 = m11 * b23 - m12 * b13 + m13 * b12;
+        const float minor01 = m10 * b23 - m12 * b03 + m13 * b02;
+        const float minor02 = m10 * b13 - m11 * b03 + m13 * b01;
+        const float minor03 = m10 * b12 - m11 * b02 + m12 * b01;
+
+        const float minor10 = m01 * b23 - m02 * b13 + m03 * b12;
+        const float minor11 = m00 * b23 - m02 * b03 + m03 * b02;
+        const float minor12 = m00 * b13 - m01 * b03 + m03 * b01;
+        const float minor13 = m00 * b12 - m01 * b02 + m02 * b01;
+
+        // Minors of rows 2 and 3, expanded along the other bottom row
+        const float minor20 = m31 * a23 - m32 * a13 + m33 * a12;
+        const float minor21 = m30 * a23 - m32 * a03 + m33 * a02;
+        const float minor22 = m30 * a13 - m31 * a03 + m33 * a01;
+        const float minor23 = m30 * a12 - m31 * a02 + m32 * a01;
+
+        const float minor30 = m21 * a23 - m22 * a13 + m23 * a12;
+        const float minor31 = m20 * a23 - m22 * a03 + m23 * a02;
+        const float minor32 = m20 * a13 - m21 * a03 + m23 * a01;
+        const float minor33 = m20 * a12 - m21 * a02 + m22 * a01;
+
+        // Cofactor signs are (-1)^(i+j); cofactor (i, j) goes to position (j, i)
+        return Matrix4D(
+             minor00, -minor10,  minor20, -minor30,
+            -minor01,  minor11, -minor21,  minor31,
+             minor02, -minor12,  minor22, -minor32,
+            -minor03,  minor13, -minor23,  minor33
+        );
     }
 
     /**
      * @brief Calculate the inverse of this matrix.
      *
+     * Usable in constant expressions, so inverses of constant matrices are computed at compile time.
+     *
      * @return The inverse matrix
      * @throws std::runtime_error if the matrix is not invertible (determinant is zero)
      */
-    [[nodiscard]] Matrix4D Inverse() const {
+    [[nodiscard]] constexpr Matrix4D Inverse() const {
         float det = Determinant();
-        if (std::fabs(det) < Constants::EPSILON) {
+        if (det > -Constants::EPSILON && det < Constants::EPSILON) {
             throw std::runtime_error("Matrix is not invertible (determinant is zero)");
         }
 
@@ -720,8 +762,8 @@ struct Matrix4D {
      * @return The rotated matrix
      */
     [[nodiscard]] Matrix4D RotateX(float angleRadians) const {
-        float c = std::cos(angleRadians);
-        float s = std::sin(angleRadians);
+        float c = Math::Cos(angleRadians);
+        float s = Math::Sin(angleRadians);
 
         Matrix4D rotation;
         rotation.m11 = c;
@@ -739,8 +781,8 @@ struct Matrix4D {
      * @return The rotated matrix
      */
     [[nodiscard]] Matrix4D RotateY(float angleRadians) const {
-        float c = std::cos(angleRadians);
-        float s = std::sin(angleRadians);
+        float c = Math::Cos(angleRadians);
+        float s = Math::Sin(angleRadians);
 
         Matrix4D rotation;
         rotation.m00 = c;
@@ -758,8 +800,8 @@ struct Matrix4D {
      * @return The rotated matrix
      */
     [[nodiscard]] Matrix4D RotateZ(float angleRadians) const {
-        float c = std::cos(angleRadians);
-        float s = std::sin(angleRadians);
+        float c = Math::Cos(angleRadians);
+        float s = Math::Sin(angleRadians);
 
         Matrix4D rotation;
         rotation.m00 = c;
@@ -777,43 +819,7 @@ struct Matrix4D {
      * @param angleRadians Rotation angle in radians
      * @return The rotated matrix
      */
-    [[nodiscard]] Matrix4D Rotate(const Vector3D& axis, float angleRadians) const {
-        float c = std::cos(angleRadians);
-        float s = std::sin(angleRadians);
-        float t = 1.0f - c;
-
-        // Normalize the axis
-        Vector3D nAxis = axis.GetNormalized();
-        float x = nAxis.x;
-        float y = nAxis.y;
-        float z = nAxis.z;
-
-        // Create the rotation matrix
-        Matrix4D rotation(
-            // First row
-            t * x * x + c,
-            t * x * y - s * z,
-            t * x * z + s * y,
-            0.0f,
-
-            // Second row
-            t * x * y + s * z,
-            t * y * y + c,
-            t * y * z - s * x,
-            0.0f,
-
-            // Third row
-            t * x * z - s * y,
-            t * y * z + s * x,
-            t * z * z + c,
-            0.0f,
-
-            // Fourth row
-            0.0f, 0.0f, 0.0f, 1.0f
-        );
-
-        return *this * rotation;
-    }
+    [[nodiscard]] Matrix4D Rotate(const Vector3D& axis, float angleRadians) const;
 
     /**
      * @brief Creates a perspective projection matrix.
@@ -825,25 +831,7 @@ struct Matrix4D {
      * @return A perspective projection matrix
      * @throws std::invalid_argument if nearPlane <= 0 or farPlane <= nearPlane
      */
-    [[nodiscard]] static Matrix4D CreatePerspective(float fovYRadians, float aspectRatio, float nearPlane, float farPlane) {
-        if (nearPlane <= 0.0f) {
-            throw std::invalid_argument("Near plane must be positive");
-        }
-        if (farPlane <= nearPlane) {
-            throw std::invalid_argument("Far plane must be greater than near plane");
-        }
-
-        float tanHalfFovy = std::tan(fovYRadians * 0.5f);
-        float f = 1.0f / tanHalfFovy;
-        float nf = 1.0f / (nearPlane - farPlane);
-
-        return Matrix4D(
-            f / aspectRatio, 0.0f, 0.0f, 0.0f,
-            0.0f, f, 0.0f, 0.0f,
-            0.0f, 0.0f, (farPlane + nearPlane) * nf, -1.0f,
-            0.0f, 0.0f, 2.0f * farPlane * nearPlane * nf, 0.0f
-        );
-    }
+    [[nodiscard]] static Matrix4D CreatePerspective(float fovYRadians, float aspectRatio, float nearPlane, float farPlane);
 
     /**
      * @brief Creates an orthographic projection matrix.
@@ -857,28 +845,7 @@ struct Matrix4D {
      * @return An orthographic projection matrix
      * @throws std::invalid_argument if left = right, bottom = top, or nearPlane = farPlane
      */
-    [[nodiscard]] static Matrix4D CreateOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) {
-        if (left == right) {
-            throw std::invalid_argument("Left cannot equal right");
-        }
-        if (bottom == top) {
-            throw std::invalid_argument("Bottom cannot equal top");
-        }
-        if (nearPlane == farPlane) {
-            throw std::invalid_argument("Near plane cannot equal far plane");
-        }
-
-        float invWidth = 1.0f / (right - left);
-        float invHeight = 1.0f / (top - bottom);
-        float invDepth = 1.0f / (farPlane - nearPlane);
-
-        return Matrix4D(
-            2.0f * invWidth, 0.0f, 0.0f, 0.0f,
-            0.0f, 2.0f * invHeight, 0.0f, 0.0f,
-            0.0f, 0.0f, -2.0f * invDepth, 0.0f,
-            -(right + left) * invWidth, -(top + bottom) * invHeight, -(farPlane + nearPlane) * invDepth, 1.0f
-        );
-    }
+    [[nodiscard]] static Matrix4D CreateOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane);
 
     /**
      * @brief Creates a view matrix for looking at a target from a specific position.
@@ -888,18 +855,7 @@ struct Matrix4D {
      * @param up Up vector (typically Vector3D(0, 1, 0))
      * @return A view matrix
      */
-    [[nodiscard]] static Matrix4D CreateLookAt(const Vector3D& eye, const Vector3D& target, const Vector3D& up) {
-        Vector3D f = (target - eye).GetNormalized();
-        Vector3D s = f.Cross(up).GetNormalized();
-        Vector3D u = s.Cross(f);
-
-        return Matrix4D(
-            s.x, s.y, s.z, -s.Dot(eye),
-            u.x, u.y, u.z, -u.Dot(eye),
-            -f.x, -f.y, -f.z, f.Dot(eye),
-            0.0f, 0.0f, 0.0f, 1.0f
-        );
-    }
+    [[nodiscard]] static Matrix4D CreateLookAt(const Vector3D& eye, const Vector3D& target, const Vector3D& up);
 
     /**
      * @brief Creates a translation matrix.
@@ -970,8 +926,8 @@ struct Matrix4D {
      * @return A rotation matrix
      */
     [[nodiscard]] static Matrix4D CreateRotationX(float angleRadians) {
-    float cosAngle = std::cos(angleRadians);
-    float sinAngle = std::sin(angleRadians);
+    float cosAngle = Math::Cos(angleRadians);
+    float sinAngle = Math::Sin(angleRadians);
 
     return Matrix4D(
         1.0f, 0.0f, 0.0f, 0.0f,
@@ -988,8 +944,8 @@ struct Matrix4D {
      * @return A rotation matrix
      */
     [[nodiscard]] static Matrix4D CreateRotationY(float angleRadians) {
-    float cosAngle = std::cos(angleRadians);
-    float sinAngle = std::sin(angleRadians);
+    float cosAngle = Math::Cos(angleRadians);
+    float sinAngle = Math::Sin(angleRadians);
 
     return Matrix4D(
         cosAngle, 0.0f, -sinAngle, 0.0f,
@@ -1006,8 +962,8 @@ struct Matrix4D {
      * @return A rotation matrix
      */
     [[nodiscard]] static Matrix4D CreateRotationZ(float angleRadians) {
-    float cosAngle = std::cos(angleRadians);
-    float sinAngle = std::sin(angleRadians);
+    float cosAngle = Math::Cos(angleRadians);
+    float sinAngle = Math::Sin(angleRadians);
 
     return Matrix4D(
         cosAngle, sinAngle, 0.0f, 0.0f,
@@ -1024,40 +980,7 @@ struct Matrix4D {
      * @param angleRadians Rotation angle in radians
      * @return A rotation matrix
      */
-    [[nodiscard]] static Matrix4D CreateRotation(const Vector3D& axis, float angleRadians) {
-        float c = std::cos(angleRadians);
-        float s = std::sin(angleRadians);
-        float t = 1.0f - c;
-
-        // Normalize the axis
-        Vector3D nAxis = axis.GetNormalized();
-        float x = nAxis.x;
-        float y = nAxis.y;
-        float z = nAxis.z;
-
-        return Matrix4D(
-            // First row
-            t * x * x + c,
-            t * x * y - s * z,
-            t * x * z + s * y,
-            0.0f,
-
-            // Second row
-            t * x * y + s * z,
-            t * y * y + c,
-            t * y * z - s * x,
-            0.0f,
-
-            // Third row
-            t * x * z - s * y,
-            t * y * z + s * x,
-            t * z * z + c,
-            0.0f,
-
-            // Fourth row
-            0.0f, 0.0f, 0.0f, 1.0f
-        );
-    }
+    [[nodiscard]] static Matrix4D CreateRotation(const Vector3D& axis, float angleRadians);
 
     /**
      * @brief Creates a transformation matrix from a position, rotation axis and angle, and scale.
@@ -1073,14 +996,7 @@ struct Matrix4D {
         const Vector3D& rotationAxis,
         float rotationAngleRadians,
         const Vector3D& scale
-    ) {
-        Matrix4D scaleMatrix = CreateScale(scale);
-        Matrix4D rotationMatrix = CreateRotation(rotationAxis, rotationAngleRadians);
-        Matrix4D translationMatrix = CreateTranslation(position);
-
-        // Combine transformations: first scale, then rotate, then translate
-        return translationMatrix * rotationMatrix * scaleMatrix;
-    }
+    );
 
     /**
      * @brief Output stream operator for debugging.
@@ -1089,33 +1005,21 @@ struct Matrix4D {
      * @param matrix Matrix to output
      * @return Reference to the output stream
      */
-    friend std::ostream& operator<<(std::ostream& os, const Matrix4D& matrix) {
-        os << "Matrix4D[\n"
-           << "  [" << matrix.m00 << ", " << matrix.m01 << ", " << matrix.m02 << ", " << matrix.m03 << "]\n"
-           << "  [" << matrix.m10 << ", " << matrix.m11 << ", " << matrix.m12 << ", " << matrix.m13 << "]\n"
-           << "  [" << matrix.m20 << ", " << matrix.m21 << ", " << matrix.m22 << ", " << matrix.m23 << "]\n"
-           << "  [" << matrix.m30 << ", " << matrix.m31 << ", " << matrix.m32 << ", " << matrix.m33 << "]\n"
-           << "]";
-        return os;
-    }
+    friend std::ostream& operator<<(std::ostream& os, const Matrix4D& matrix);
 
     /**
      * @brief Convert the matrix to a string representation.
      *
      * @return String representation of the matrix
      */
-    [[nodiscard]] std::string ToString() const {
-        std::ostringstream oss;
-        oss << *this;
-        return oss.str();
-    }
+    [[nodiscard]] std::string ToString() const;
 
     /**
      * @brief Returns an Identity matrix.
      *
      * @return Identity matrix
      */
-    [[nodiscard]] static Matrix4D Identity() {
+    [[nodiscard]] static constexpr Matrix4D Identity() {
         return Matrix4D(
             1.0f, 0.0f, 0.0f, 0.0f,
             0.0f, 1.0f, 0.0f, 0.0f,
@@ -0,0 +1,417 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "NavMesh.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Math {
+
+    namespace {
+
+        // Requests per thread below which another thread does not pay off
+        constexpr std::size_t MinRequestsPerThread = 16;
+
+        // Twice the signed area of the triangle a, b, c; positive if c is left of a -> b
+        float Cross(const Vector2D& a, const Vector2D& b, const Vector2D& c) {
+            return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        }
+
+    } // namespace
+
+    // NavMesh
+
+    NavMesh::NavMesh(std::span<const Vector2D> vertices, std::span<const std::uint32_t> polygonSizes,
+                     std::span<const std::uint32_t> polygonIndices)
+        : m_Vertices(vertices.begin(), vertices.end()),
+          m_PolygonVertices(polygonIndices.begin(), polygonIndices.end()) {
+        m_PolygonStart.reserve(polygonSizes.size() + 1);
+        m_PolygonStart.push_back(0);
+        std::size_t total = 0;
+        for (const std::uint32_t size : polygonSizes) {
+            if (size < 3) {
+                throw std::invalid_argument("Navmesh polygons need at least three vertices");
+            }
+            total += size;
+            if (total > polygonIndices.size()) {
+                throw std::invalid_argument("Polygon sizes exceed the number of polygon indices");
+            }
+            m_PolygonStart.push_back(static_cast<std::uint32_t>(total));
+        }
+        if (total != polygonIndices.size()) {
+            throw std::invalid_argument("Polygon sizes do not match the number of polygon indices");
+        }
+
+        for (std::uint32_t polygon = 0; polygon < GetPolygonCount(); ++polygon) {
+            const std::span<const std::uint32_t> indices = GetPolygon(polygon);
+            for (const std::uint32_t index : indices) {
+                if (index >= m_Vertices.size()) {
+                    throw std::invalid_argument("Polygon vertex index out of range");
+                }
+            }
+            float area = 0.0f;
+            for (std::size_t i = 0; i < indices.size(); ++i) {
+                const Vector2D& a = m_Vertices[indices[i]];
+                const Vector2D& b = m_Vertices[indices[(i + 1) % indices.size()]];
+                const Vector2D& c = m_Vertices[indices[(i + 2) % indices.size()]];
+                if (Cross(a, b, c) < 0.0f) {
+                    throw std::invalid_argument("Navmesh polygons must be convex and counter-clockwise");
+                }
+                area += a.x * b.y - b.x * a.y;
+            }
+            if (!(area > 0.0f)) {
+                throw std::invalid_argument("Navmesh polygons must be convex and counter-clockwise");
+            }
+        }
+
+        BuildAdjacency();
+        BuildGrid();
+    }
+
+    void NavMesh::BuildAdjacency() {
+        m_EdgeNeighbors.assign(m_PolygonVertices.size(), NoPolygon);
+
+        // Edges keyed by their sorted vertex pair; the value is the first edge seen
+        std::unordered_map<std::uint64_t, std::uint32_t> edges;
+        edges.reserve(m_PolygonVertices.size());
+        std::vector<std::uint32_t> edgePolygon(m_PolygonVertices.size());
+        for (std::uint32_t polygon = 0; polygon < GetPolygonCount(); ++polygon) {
+            const std::uint32_t first = m_PolygonStart[polygon];
+            const std::uint32_t count = m_PolygonStart[polygon + 1] - first;
+            for (std::uint32_t i = 0; i < count; ++i) {
+                const std::uint32_t edge = first + i;
+                edgePolygon[edge] = polygon;
+                const std::uint32_t a = m_PolygonVertices[edge];
+                const std::uint32_t b = m_PolygonVertices[first + (i + 1) % count];
+                const std::uint64_t key = (static_cast<std::uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+                const auto [found, inserted] = edges.try_emplace(key, edge);
+                if (inserted) {
+                    continue;
+                }
+                const std::uint32_t other = found->second;
+                if (m_EdgeNeighbors[other] != NoPolygon) {
+                    throw std::invalid_argument("A navmesh edge is shared by more than two polygons");
+                }
+                m_EdgeNeighbors[other] = polygon;
+                m_EdgeNeighbors[edge] = edgePolygon[other];
+            }
+        }
+    }
+
+    void NavMesh::BuildGrid() {
+        if (m_PolygonStart.size() < 2) {
+            m_GridCellStart.assign(2, 0);
+            return;
+        }
+
+        // Bounds of the used vertices
+        Vector2D min = m_Vertices[m_PolygonVertices[0]];
+        Vector2D max = min;
+        for (const std::uint32_t index : m_PolygonVertices) {
+            min = Vector2D(std::min(min.x, m_Vertices[index].x), std::min(min.y, m_Vertices[index].y));
+            max = Vector2D(std::max(max.x, m_Vertices[index].x), std::max(max.y, m_Vertices[index].y));
+        }
+
+        // About one cell per polygon
+        const float width = std::max(max.x - min.x, 1e-6f);
+        const float height = std::max(max.y - min.y, 1e-6f);
+        m_GridCellSize = std::sqrt(width * height / static_cast<float>(GetPolygonCount()));
+        m_GridColumns = std::min<std::uint32_t>(static_cast<std::uint32_t>(width / m_GridCellSize) + 1, 4096);
+        m_GridRows = std::min<std::uint32_t>(static_cast<std::uint32_t>(height / m_GridCellSize) + 1, 4096);
+        m_GridCellSize = std::max(width / static_cast<float>(m_GridColumns), height / static_cast<float>(m_GridRows));
+        m_GridMin = min;
+
+        // Two passes over the polygon bounds: count, then fill
+        const std::size_t cellCount = static_cast<std::size_t>(m_GridColumns) * m_GridRows;
+        m_GridCellStart.assign(cellCount + 1, 0);
+        for (int pass = 0; pass < 2; ++pass) {
+            if (pass == 1) {
+                for (std::size_t cell = 0; cell < cellCount; ++cell) {
+                    m_GridCellStart[cell + 1] += m_GridCellStart[cell];
+                }
+                m_GridPolygons.resize(m_GridCellStart[cellCount]);
+            }
+            for (std::uint32_t polygon = 0; polygon < GetPolygonCount(); ++polygon) {
+                Vector2D low = m_Vertices[m_PolygonVertices[m_PolygonStart[polygon]]];
+                Vector2D high = low;
+                for (const std::uint32_t index : GetPolygon(polygon)) {
+                    low = Vector2D(std::min(low.x, m_Vertices[index].x), std::min(low.y, m_Vertices[index].y));
+                    high = Vector2D(std::max(high.x, m_Vertices[index].x), std::max(high.y, m_Vertices[index].y));
+                }
+                const auto cellOf = [this](float value, float origin, std::uint32_t count) {
+                    const float cell = std::floor((value - origin) / m_GridCellSize);
+                    return cell <= 0.0f ? 0u : std::min(static_cast<std::uint32_t>(cell), count - 1);
+                };
+                for (std::uint32_t row = cellOf(low.y, min.y, m_GridRows); row <= cellOf(high.y, min.y, m_GridRows); ++row) {
+                    for (std::uint32_t column = cellOf(low.x, min.x, m_GridColumns);
+                         column <= cellOf(high.x, min.x, m_GridColumns); ++column) {
+                        const std::size_t cell = static_cast<std::size_t>(row) * m_GridColumns + column;
+                        if (pass == 0) {
+                            ++m_GridCellStart[cell + 1];
+                        } else {
+                            // m_GridCellStart[cell] is used as the insertion cursor
+                            m_GridPolygons[m_GridCellStart[cell]++] = polygon;
+                        }
+                    }
+                }
+            }
+        }
+        for (std::size_t cell = cellCount; cell > 0; --cell) {
+            m_GridCellStart[cell] = m_GridCellStart[cell - 1];
+        }
+        m_GridCellStart[0] = 0;
+    }
+
+    std::size_t NavMesh::GetPolygonCount() const {
+        return m_PolygonStart.size() - 1;
+    }
+
+    std::span<const Vector2D> NavMesh::GetVertices() const {
+        return m_Vertices;
+    }
+
+    std::span<const std::uint32_t> NavMesh::GetPolygon(std::uint32_t polygon) const {
+        if (polygon >= GetPolygonCount()) {
+            throw std::out_of_range("Polygon index out of range");
+        }
+        return std::span<const std::uint32_t>(m_PolygonVertices).subspan(
+            m_PolygonStart[polygon], m_PolygonStart[polygon + 1] - m_PolygonStart[polygon]);
+    }
+
+    std::span<const std::uint32_t> NavMesh::GetNeighbors(std::uint32_t polygon) const {
+        if (polygon >= GetPolygonCount()) {
+            throw std::out_of_range("Polygon index out of range");
+        }
+        return std::span<const std::uint32_t>(m_EdgeNeighbors).subspan(
+            m_PolygonStart[polygon], m_PolygonStart[polygon + 1] - m_PolygonStart[polygon]);
+    }
+
+    std::uint32_t NavMesh::FindPolygon(const Vector2D& point) const {
+        const float column = std::floor((point.x - m_GridMin.x) / m_GridCellSize);
+        const float row = std::floor((point.y - m_GridMin.y) / m_GridCellSize);
+        if (GetPolygonCount() == 0 || !(column >= 0.0f && row >= 0.0f && column <= static_cast<float>(m_GridColumns) &&
+                                        row <= static_cast<float>(m_GridRows))) {
+            return NoPolygon;
+        }
+        // Points on the far edge of the bounds belong to the last cell
+        const std::size_t cell =
+            static_cast<std::size_t>(std::min(static_cast<std::uint32_t>(row), m_GridRows - 1)) * m_GridColumns +
+            std::min(static_cast<std::uint32_t>(column), m_GridColumns - 1);
+
+        for (std::uint32_t i = m_GridCellStart[cell]; i < m_GridCellStart[cell + 1]; ++i) {
+            const std::uint32_t polygon = m_GridPolygons[i];
+            const std::uint32_t first = m_PolygonStart[polygon];
+            const std::uint32_t count = m_PolygonStart[polygon + 1] - first;
+            bool inside = true;
+            for (std::uint32_t j = 0; j < count && inside; ++j) {
+                inside = Cross(m_Vertices[m_PolygonVertices[first + j]],
+                               m_Vertices[m_PolygonVertices[first + (j + 1) % count]], point) >= 0.0f;
+            }
+            if (inside) {
+                return polygon;
+            }
+        }
+        return NoPolygon;
+    }
+
+    std::size_t NavMesh::FindPaths(std::span<const NavPathRequest> requests, std::span<std::vector<Vector2D>> outPaths,
+                                   WorkerPool* pool) const {
+        MATH_TRACE_SCOPE("NavMesh::FindPaths");
+        if (requests.size() != outPaths.size()) {
+            throw std::invalid_argument("Input and output spans must have the same size");
+        }
+
+        std::atomic<std::size_t> found{0};
+        auto process = [&](std::size_t begin, std::size_t end) {
+            NavMeshQuery query(*this);
+            std::vector<std::uint32_t> corridor;
+            std::size_t chunkFound = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                if (query.FindPath(requests[i].start, requests[i].end, outPaths[i], corridor)) {
+                    ++chunkFound;
+                }
+            }
+            found.fetch_add(chunkFound, std::memory_order_relaxed);
+        };
+        if (pool != nullptr) {
+            pool->ParallelForChunks(requests.size(), MinRequestsPerThread, process);
+        } else {
+            process(0, requests.size());
+        }
+        return found.load(std::memory_order_relaxed);
+    }
+
+    // NavMeshQuery
+
+    NavMeshQuery::NavMeshQuery(const NavMesh& mesh)
+        : m_Mesh(&mesh),
+          m_Costs(mesh.GetPolygonCount()),
+          m_Parents(mesh.GetPolygonCount()),
+          m_Positions(mesh.GetPolygonCount()),
+          m_SeenQuery(mesh.GetPolygonCount(), 0),
+          m_ClosedQuery(mesh.GetPolygonCount(), 0) {
+    }
+
+    bool NavMeshQuery::FindCorridor(const Vector2D& start, const Vector2D& end, std::vector<std::uint32_t>& outCorridor) {
+        outCorridor.clear();
+        const std::uint32_t startPolygon = m_Mesh->FindPolygon(start);
+        const std::uint32_t endPolygon = m_Mesh->FindPolygon(end);
+        if (startPolygon == NavMesh::NoPolygon || endPolygon == NavMesh::NoPolygon) {
+            return false;
+        }
+
+        // A new query number invalidates every mark of the previous queries
+        if (++m_Query == 0) {
+            std::fill(m_SeenQuery.begin(), m_SeenQuery.end(), 0);
+            std::fill(m_ClosedQuery.begin(), m_ClosedQuery.end(), 0);
+            m_Query = 1;
+        }
+
+        const auto greater = [](const OpenEntry& a, const OpenEntry& b) { return a.estimate > b.estimate; };
+        const std::span<const Vector2D> vertices = m_Mesh->GetVertices();
+        m_Open.clear();
+        m_SeenQuery[startPolygon] = m_Query;
+        m_Costs[startPolygon] = 0.0f;
+        m_Parents[startPolygon] = NavMesh::NoPolygon;
+        m_Positions[startPolygon] = start;
+        m_Open.push_back({(end - start).Length(), startPolygon});
+
+        bool reached = false;
+        while (!m_Open.empty()) {
+            std::pop_heap(m_Open.begin(), m_Open.end(), greater);
+            const std::uint32_t polygon = m_Open.back().polygon;
+            m_Open.pop_back();
+            if (m_ClosedQuery[polygon] == m_Query) {
+                continue;
+            }
+            m_ClosedQuery[polygon] = m_Query;
+            if (polygon == endPolygon) {
+                reached = true;
+                break;
+            }
+
+            const std::span<const std::uint32_t> indices = m_Mesh->GetPolygon(polygon);
+            const std::span<const std::uint32_t> neighbors = m_Mesh->GetNeighbors(polygon);
+            for (std::size_t i = 0; i < neighbors.size(); ++i) {
+                const std::uint32_t neighbor = neighbors[i];
+                if (neighbor == NavMesh::NoPolygon || m_ClosedQuery[neighbor] == m_Query) {
+                    continue;
+                }
+                const Vector2D portal = (vertices[indices[i]] + vertices[indices[(i + 1) % indices.size()]]) * 0.5f;
+                float cost = m_Costs[polygon] + (portal - m_Positions[polygon]).Length();
+                const float remaining = (end - portal).Length();
+                if (neighbor == endPolygon) {
+                    cost += remaining;
+                }
+                if (m_SeenQuery[neighbor] == m_Query && cost >= m_Costs[neighbor]) {
+                    continue;
+                }
+                m_SeenQuery[neighbor] = m_Query;
+                m_Costs[neighbor] = cost;
+                m_Parents[neighbor] = polygon;
+                m_Positions[neighbor] = portal;
+                m_Open.push_back({neighbor == endPolygon ? cost : cost + remaining, neighbor});
+                std::push_heap(m_Open.begin(), m_Open.end(), greater);
+            }
+        }
+        if (!reached) {
+            return false;
+        }
+
+        for (std::uint32_t polygon = endPolygon; polygon != NavMesh::NoPolygon; polygon = m_Parents[polygon]) {
+            outCorridor.push_back(polygon);
+        }
+        std::reverse(outCorridor.begin(), outCorridor.end());
+        return true;
+    }
+
+    void NavMeshQuery::StringPull(const Vector2D& start, const Vector2D& end, std::span<const std::uint32_t> corridor,
+                                  std::vector<Vector2D>& outPath) {
+        outPath.clear();
+        const std::span<const Vector2D> vertices = m_Mesh->GetVertices();
+
+        // Portals from start to end; the start and end points are portals of zero width
+        m_PortalLeft.assign(1, start);
+        m_PortalRight.assign(1, start);
+        for (std::size_t i = 0; i + 1 < corridor.size(); ++i) {
+            const std::span<const std::uint32_t> indices = m_Mesh->GetPolygon(corridor[i]);
+            const std::span<const std::uint32_t> neighbors = m_Mesh->GetNeighbors(corridor[i]);
+            const auto edge = std::find(neighbors.begin(), neighbors.end(), corridor[i + 1]);
+            if (edge == neighbors.end()) {
+                throw std::invalid_argument("Corridor polygons must be adjacent");
+            }
+            // Leaving a counter-clockwise polygon, the edge's end vertex is on the left
+            const std::size_t j = static_cast<std::size_t>(edge - neighbors.begin());
+            m_PortalRight.push_back(vertices[indices[j]]);
+            m_PortalLeft.push_back(vertices[indices[(j + 1) % indices.size()]]);
+        }
+        m_PortalLeft.push_back(end);
+        m_PortalRight.push_back(end);
+
+        // Simple stupid funnel algorithm: narrow the funnel portal by portal, and when one
+        // side crosses the other, the other side's point becomes a corner and the new apex
+        Vector2D apex = start;
+        Vector2D left = start;
+        Vector2D right = start;
+        std::size_t apexIndex = 0, leftIndex = 0, rightIndex = 0;
+        outPath.push_back(start);
+        for (std::size_t i = 1; i < m_PortalLeft.size(); ++i) {
+            const Vector2D& portalLeft = m_PortalLeft[i];
+            const Vector2D& portalRight = m_PortalRight[i];
+
+            if (Cross(apex, right, portalRight) >= 0.0f) {
+                if (apex == right || Cross(apex, left, portalRight) < 0.0f) {
+                    right = portalRight;
+                    rightIndex = i;
+                } else {
+                    if (!(outPath.back() == left)) {
+                        outPath.push_back(left);
+                    }
+                    apex = left;
+                    apexIndex = leftIndex;
+                    right = left = apex;
+                    rightIndex = leftIndex = apexIndex;
+                    i = apexIndex;
+                    continue;
+                }
+            }
+
+            if (Cross(apex, left, portalLeft) <= 0.0f) {
+                if (apex == left || Cross(apex, right, portalLeft) > 0.0f) {
+                    left = portalLeft;
+                    leftIndex = i;
+                } else {
+                    if (!(outPath.back() == right)) {
+                        outPath.push_back(right);
+                    }
+                    apex = right;
+                    apexIndex = rightIndex;
+                    right = left = apex;
+                    rightIndex = leftIndex = apexIndex;
+                    i = apexIndex;
+                    continue;
+                }
+            }
+        }
+        if (!(outPath.back() == end)) {
+            outPath.push_back(end);
+        }
+    }
+
+    bool NavMeshQuery::FindPath(const Vector2D& start, const Vector2D& end, std::vector<Vector2D>& outPath,
+                                std::vector<std::uint32_t>& corridor) {
+        outPath.clear();
+        if (!FindCorridor(start, end, corridor)) {
+            return false;
+        }
+        StringPull(start, end, corridor, outPath);
+        return true;
+    }
+
+} // namespace Math
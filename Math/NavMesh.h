@@ -0,0 +1,195 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef NAV_MESH_H
+#define NAV_MESH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "MathFwd.h"
+#include "Vector2D.h"
+
+namespace Math {
+
+    /**
+     * @brief Start and end point of a path query.
+     */
+    struct NavPathRequest {
+        Vector2D start;
+        Vector2D end;
+    };
+
+    /**
+     * @class NavMesh
+     * @brief Walkable area made of convex polygons that share edges, with path queries.
+     *
+     * Polygons are given as counter-clockwise lists of vertex indices. Two polygons are
+     * adjacent when they use the same two vertices for an edge; the shared edge is the
+     * portal between them. A uniform grid of polygon bounds locates the polygon under a
+     * point.
+     *
+     * Paths are found by NavMeshQuery: A* over the polygon adjacency gives a corridor of
+     * polygons, and the simple stupid funnel algorithm pulls the path tight through the
+     * corridor's portals. The mesh is immutable, so any number of queries may use it from
+     * different threads.
+     */
+    class NavMesh {
+    public:
+        /** Polygon index meaning "no polygon" */
+        static constexpr std::uint32_t NoPolygon = std::numeric_limits<std::uint32_t>::max();
+
+    private:
+        std::vector<Vector2D> m_Vertices;
+
+        /** First entry of each polygon in m_PolygonVertices; one extra entry marks the end */
+        std::vector<std::uint32_t> m_PolygonStart;
+        std::vector<std::uint32_t> m_PolygonVertices;
+
+        /** Polygon across each polygon edge, parallel to m_PolygonVertices */
+        std::vector<std::uint32_t> m_EdgeNeighbors;
+
+        // Point location grid
+        Vector2D m_GridMin;
+        float m_GridCellSize = 1.0f;
+        std::uint32_t m_GridColumns = 1;
+        std::uint32_t m_GridRows = 1;
+        std::vector<std::uint32_t> m_GridCellStart;
+        std::vector<std::uint32_t> m_GridPolygons;
+
+        void BuildAdjacency();
+        void BuildGrid();
+
+    public:
+        /**
+         * @brief Creates a mesh.
+         * @param vertices Vertex positions
+         * @param polygonSizes Number of vertices of each polygon
+         * @param polygonIndices Vertex indices of all polygons, one polygon after the other,
+         *                       each in counter-clockwise order
+         * @throws std::invalid_argument if an index is out of range, a polygon has fewer than
+         *         three vertices or is not convex and counter-clockwise, or an edge is shared by
+         *         more than two polygons
+         */
+        NavMesh(std::span<const Vector2D> vertices, std::span<const std::uint32_t> polygonSizes,
+                std::span<const std::uint32_t> polygonIndices);
+
+        [[nodiscard]] std::size_t GetPolygonCount() const;
+        [[nodiscard]] std::span<const Vector2D> GetVertices() const;
+
+        /**
+         * @brief Gets the vertex indices of a polygon.
+         * @throws std::out_of_range if the polygon does not exist
+         */
+        [[nodiscard]] std::span<const std::uint32_t> GetPolygon(std::uint32_t polygon) const;
+
+        /**
+         * @brief Gets the polygon across each edge of a polygon, or NoPolygon for boundary edges.
+         *
+         * Edge i runs from vertex i to vertex i + 1 of the polygon.
+         *
+         * @throws std::out_of_range if the polygon does not exist
+         */
+        [[nodiscard]] std::span<const std::uint32_t> GetNeighbors(std::uint32_t polygon) const;
+
+        /**
+         * @brief Finds the polygon containing a point, or NoPolygon if the point is off the mesh.
+         *
+         * A point on an edge shared by two polygons may be reported in either of them.
+         */
+        [[nodiscard]] std::uint32_t FindPolygon(const Vector2D& point) const;
+
+        /**
+         * @brief Finds the paths of many requests, splitting them between threads.
+         *
+         * Each chunk of requests runs on its own NavMeshQuery, so the pooled search state is
+         * created once per chunk rather than once per request.
+         *
+         * @param requests Start and end of each path
+         * @param outPaths Receives each path as in NavMeshQuery::FindPath; empty if none exists
+         * @param pool Optional worker pool to split the requests between threads
+         * @return The number of requests for which a path was found
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        std::size_t FindPaths(std::span<const NavPathRequest> requests, std::span<std::vector<Vector2D>> outPaths,
+                              WorkerPool* pool = nullptr) const;
+    };
+
+    /**
+     * @class NavMeshQuery
+     * @brief Path search state for one thread, reused across queries.
+     *
+     * The per-polygon costs, parents and open/closed marks are allocated once for the mesh
+     * size. Marks carry the number of the query that wrote them, so starting a query does
+     * not clear anything, and the open list keeps its capacity between queries.
+     */
+    class NavMeshQuery {
+    private:
+        struct OpenEntry {
+            float estimate;
+            std::uint32_t polygon;
+        };
+
+        const NavMesh* m_Mesh;
+        std::vector<float> m_Costs;
+        std::vector<std::uint32_t> m_Parents;
+        std::vector<Vector2D> m_Positions;
+        std::vector<std::uint32_t> m_SeenQuery;
+        std::vector<std::uint32_t> m_ClosedQuery;
+        std::vector<OpenEntry> m_Open;
+        std::uint32_t m_Query = 0;
+
+        /** Portal end points of the current corridor, left and right as seen when walking it */
+        std::vector<Vector2D> m_PortalLeft;
+        std::vector<Vector2D> m_PortalRight;
+
+    public:
+        /**
+         * @brief Creates query state sized for a mesh, which must outlive the query.
+         */
+        explicit NavMeshQuery(const NavMesh& mesh);
+
+        /**
+         * @brief Finds the corridor of polygons from the start polygon to the end polygon.
+         *
+         * A* runs over the polygon adjacency. A polygon's cost is measured through the
+         * midpoints of the portals the search entered by, with the straight-line distance to
+         * the end as the heuristic.
+         *
+         * @param start Start point
+         * @param end End point
+         * @param outCorridor Cleared, then filled with the polygons from start to end
+         * @return false if either point is off the mesh or no corridor connects them
+         */
+        bool FindCorridor(const Vector2D& start, const Vector2D& end, std::vector<std::uint32_t>& outCorridor);
+
+        /**
+         * @brief Finds a shortest path through a corridor with the simple stupid funnel algorithm.
+         * @param start Start point, inside the first polygon of the corridor
+         * @param end End point, inside the last polygon of the corridor
+         * @param corridor Adjacent polygons from start to end
+         * @param outPath Cleared, then filled with the start, every corner and the end
+         * @throws std::invalid_argument if two consecutive corridor polygons are not adjacent
+         */
+        void StringPull(const Vector2D& start, const Vector2D& end, std::span<const std::uint32_t> corridor,
+                        std::vector<Vector2D>& outPath);
+
+        /**
+         * @brief Finds the corridor and pulls the path through it.
+         * @param start Start point
+         * @param end End point
+         * @param outPath Cleared, then filled with the start, every corner and the end
+         * @param corridor Scratch storage for the corridor, reused between calls
+         * @return false if no path exists; outPath is then empty
+         */
+        bool FindPath(const Vector2D& start, const Vector2D& end, std::vector<Vector2D>& outPath,
+                      std::vector<std::uint32_t>& corridor);
+    };
+
+} // namespace Math
+
+#endif // NAV_MESH_H
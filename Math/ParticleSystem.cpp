@@ -0,0 +1,306 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "ParticleSystem.h"
+#include "SimdConfig.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        // Integer hash with good avalanche (lowbias32); vectorizes well since it has no branches
+        std::uint32_t Hash(std::uint32_t x) {
+            x ^= x >> 16;
+            x *= 0x7FEB352Du;
+            x ^= x >> 15;
+            x *= 0x846CA68Bu;
+            x ^= x >> 16;
+            return x;
+        }
+
+        // Uniform float in [-1, 1) from the top 24 bits of a hash
+        float SignedUnit(std::uint32_t hash) {
+            return static_cast<float>(hash >> 8) * (2.0f / 16777216.0f) - 1.0f;
+        }
+
+        // Random values drawn per spawned particle
+        constexpr std::uint32_t StreamsPerParticle = 7;
+
+        std::vector<float> MakeStream(std::size_t capacity) {
+            return std::vector<float>(capacity, 0.0f);
+        }
+
+    } // namespace
+
+    ParticleSystem::ParticleSystem(std::size_t capacity, std::uint32_t seed)
+        : m_PositionX(MakeStream(capacity)), m_PositionY(MakeStream(capacity)), m_PositionZ(MakeStream(capacity)),
+          m_VelocityX(MakeStream(capacity)), m_VelocityY(MakeStream(capacity)), m_VelocityZ(MakeStream(capacity)),
+          m_Age(MakeStream(capacity)), m_Lifetime(MakeStream(capacity)), m_Seed(Hash(seed)) {
+    }
+
+    // Emitters and forces
+
+    std::size_t ParticleSystem::AddEmitter(const ParticleEmitter& emitter) {
+        if (!(emitter.minLifetime > 0.0f) || !(emitter.maxLifetime >= emitter.minLifetime)) {
+            throw std::invalid_argument("Emitter lifetimes must be positive and minLifetime <= maxLifetime");
+        }
+        if (!(emitter.rate >= 0.0f)) {
+            throw std::invalid_argument("Emitter rate must not be negative");
+        }
+        m_Emitters.push_back(emitter);
+        m_EmitterCarry.push_back(0.0f);
+        return m_Emitters.size() - 1;
+    }
+
+    ParticleEmitter& ParticleSystem::GetEmitter(std::size_t index) {
+        return m_Emitters.at(index);
+    }
+
+    std::size_t ParticleSystem::GetEmitterCount() const {
+        return m_Emitters.size();
+    }
+
+    std::size_t ParticleSystem::AddAttractor(const ParticleAttractor& attractor) {
+        m_Attractors.push_back(attractor);
+        return m_Attractors.size() - 1;
+    }
+
+    ParticleAttractor& ParticleSystem::GetAttractor(std::size_t index) {
+        return m_Attractors.at(index);
+    }
+
+    void ParticleSystem::ClearAttractors() {
+        m_Attractors.clear();
+    }
+
+    void ParticleSystem::SetGravity(const Vector3D& gravity) {
+        m_Gravity = gravity;
+    }
+
+    void ParticleSystem::SetDrag(float drag) {
+        if (!(drag >= 0.0f)) {
+            throw std::invalid_argument("Drag must not be negative");
+        }
+        m_Drag = drag;
+    }
+
+    // Simulation
+
+    std::size_t ParticleSystem::Emit(std::size_t emitterIndex, std::size_t count) {
+        const ParticleEmitter& emitter = m_Emitters.at(emitterIndex);
+        const std::size_t spawned = std::min(count, GetCapacity() - m_Count);
+        m_DroppedSpawnCount += count - spawned;
+
+        const float lifetimeCenter = 0.5f * (emitter.minLifetime + emitter.maxLifetime);
+        const float lifetimeRange = 0.5f * (emitter.maxLifetime - emitter.minLifetime);
+        const std::size_t first = m_Count;
+
+        // Each particle draws from its own slice of the hash sequence, so this loop has no
+        // dependency between iterations
+        for (std::size_t k = 0; k < spawned; ++k) {
+            const std::uint32_t base = m_Seed + (m_SpawnCounter + static_cast<std::uint32_t>(k)) * StreamsPerParticle;
+            const std::size_t i = first + k;
+            m_PositionX[i] = emitter.position.x + emitter.extent.x * SignedUnit(Hash(base));
+            m_PositionY[i] = emitter.position.y + emitter.extent.y * SignedUnit(Hash(base + 1));
+            m_PositionZ[i] = emitter.position.z + emitter.extent.z * SignedUnit(Hash(base + 2));
+            m_VelocityX[i] = emitter.velocity.x + emitter.velocitySpread.x * SignedUnit(Hash(base + 3));
+            m_VelocityY[i] = emitter.velocity.y + emitter.velocitySpread.y * SignedUnit(Hash(base + 4));
+            m_VelocityZ[i] = emitter.velocity.z + emitter.velocitySpread.z * SignedUnit(Hash(base + 5));
+            m_Lifetime[i] = lifetimeCenter + lifetimeRange * SignedUnit(Hash(base + 6));
+            m_Age[i] = 0.0f;
+        }
+
+        m_SpawnCounter += static_cast<std::uint32_t>(spawned);
+        m_Count += spawned;
+        return spawned;
+    }
+
+    void ParticleSystem::Simulate(std::size_t begin, std::size_t end, float deltaTime) {
+        const float dragFactor = std::max(0.0f, 1.0f - m_Drag * deltaTime);
+        float* const px = m_PositionX.data();
+        float* const py = m_PositionY.data();
+        float* const pz = m_PositionZ.data();
+        float* const vx = m_VelocityX.data();
+        float* const vy = m_VelocityY.data();
+        float* const vz = m_VelocityZ.data();
+        float* const age = m_Age.data();
+        std::size_t i = begin;
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128 drag = _mm_set1_ps(dragFactor);
+        for (; i + 4 <= end; i += 4) {
+            const __m128 x = _mm_loadu_ps(px + i);
+            const __m128 y = _mm_loadu_ps(py + i);
+            const __m128 z = _mm_loadu_ps(pz + i);
+            __m128 ax = _mm_set1_ps(m_Gravity.x);
+            __m128 ay = _mm_set1_ps(m_Gravity.y);
+            __m128 az = _mm_set1_ps(m_Gravity.z);
+
+            for (const ParticleAttractor& attractor : m_Attractors) {
+                const __m128 dx = _mm_sub_ps(_mm_set1_ps(attractor.position.x), x);
+                const __m128 dy = _mm_sub_ps(_mm_set1_ps(attractor.position.y), y);
+                const __m128 dz = _mm_sub_ps(_mm_set1_ps(attractor.position.z), z);
+                const __m128 d2 = _mm_add_ps(
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)),
+                    _mm_set1_ps(attractor.softening * attractor.softening));
+                const __m128 scale = _mm_div_ps(_mm_set1_ps(attractor.strength), _mm_mul_ps(d2, _mm_sqrt_ps(d2)));
+                ax = _mm_add_ps(ax, _mm_mul_ps(dx, scale));
+                ay = _mm_add_ps(ay, _mm_mul_ps(dy, scale));
+                az = _mm_add_ps(az, _mm_mul_ps(dz, scale));
+            }
+
+            const __m128 newVx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vx + i), _mm_mul_ps(ax, dt)), drag);
+            const __m128 newVy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vy + i), _mm_mul_ps(ay, dt)), drag);
+            const __m128 newVz = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(vz + i), _mm_mul_ps(az, dt)), drag);
+            _mm_storeu_ps(vx + i, newVx);
+            _mm_storeu_ps(vy + i, newVy);
+            _mm_storeu_ps(vz + i, newVz);
+            _mm_storeu_ps(px + i, _mm_add_ps(x, _mm_mul_ps(newVx, dt)));
+            _mm_storeu_ps(py + i, _mm_add_ps(y, _mm_mul_ps(newVy, dt)));
+            _mm_storeu_ps(pz + i, _mm_add_ps(z, _mm_mul_ps(newVz, dt)));
+            _mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), dt));
+        }
+#endif
+
+        // Same operations in the same order as the vector loop
+        for (; i < end; ++i) {
+            float ax = m_Gravity.x;
+            float ay = m_Gravity.y;
+            float az = m_Gravity.z;
+            for (const ParticleAttractor& attractor : m_Attractors) {
+                const float dx = attractor.position.x - px[i];
+                const float dy = attractor.position.y - py[i];
+                const float dz = attractor.position.z - pz[i];
+                const float d2 = ((dx * dx + dy * dy) + dz * dz) + attractor.softening * attractor.softening;
+                const float scale = attractor.strength / (d2 * std::sqrt(d2));
+                ax += dx * scale;
+                ay += dy * scale;
+                az += dz * scale;
+            }
+
+            vx[i] = (vx[i] + ax * deltaTime) * dragFactor;
+            vy[i] = (vy[i] + ay * deltaTime) * dragFactor;
+            vz[i] = (vz[i] + az * deltaTime) * dragFactor;
+            px[i] += vx[i] * deltaTime;
+            py[i] += vy[i] * deltaTime;
+            pz[i] += vz[i] * deltaTime;
+            age[i] += deltaTime;
+        }
+    }
+
+    void ParticleSystem::RemoveExpired() {
+        // Only the age and lifetime streams are read for live particles
+        std::size_t count = m_Count;
+        std::size_t i = 0;
+        while (i < count) {
+            if (m_Age[i] < m_Lifetime[i]) {
+                ++i;
+                continue;
+            }
+            --count;
+            m_PositionX[i] = m_PositionX[count];
+            m_PositionY[i] = m_PositionY[count];
+            m_PositionZ[i] = m_PositionZ[count];
+            m_VelocityX[i] = m_VelocityX[count];
+            m_VelocityY[i] = m_VelocityY[count];
+            m_VelocityZ[i] = m_VelocityZ[count];
+            m_Age[i] = m_Age[count];
+            m_Lifetime[i] = m_Lifetime[count];
+        }
+        m_Count = count;
+    }
+
+    void ParticleSystem::Update(float deltaTime, WorkerPool* pool) {
+        MATH_TRACE_SCOPE("ParticleSystem::Update");
+        if (!std::isfinite(deltaTime) || deltaTime < 0.0f) {
+            throw std::invalid_argument("Time step must be finite and not negative");
+        }
+
+        for (std::size_t e = 0; e < m_Emitters.size(); ++e) {
+            float& carry = m_EmitterCarry[e];
+            carry += m_Emitters[e].rate * deltaTime;
+            const float whole = std::floor(carry);
+            carry -= whole;
+
+            // Emit spawns at most up to the capacity; the clamp keeps huge counts representable
+            Emit(e, static_cast<std::size_t>(std::min(whole, static_cast<float>(GetCapacity()))));
+        }
+
+        if (pool != nullptr) {
+            pool->ParallelForChunks(m_Count, MinParticlesPerThread, [this, deltaTime](std::size_t begin, std::size_t end) {
+                Simulate(begin, end, deltaTime);
+            });
+        } else {
+            Simulate(0, m_Count, deltaTime);
+        }
+
+        RemoveExpired();
+    }
+
+    void ParticleSystem::Clear() {
+        m_Count = 0;
+        std::fill(m_EmitterCarry.begin(), m_EmitterCarry.end(), 0.0f);
+    }
+
+    // Particle access
+
+    std::size_t ParticleSystem::GetCount() const {
+        return m_Count;
+    }
+
+    std::size_t ParticleSystem::GetCapacity() const {
+        return m_Age.size();
+    }
+
+    std::size_t ParticleSystem::GetDroppedSpawnCount() const {
+        return m_DroppedSpawnCount;
+    }
+
+    Vector3D ParticleSystem::GetPosition(std::size_t index) const {
+        return Vector3D(m_PositionX[index], m_PositionY[index], m_PositionZ[index]);
+    }
+
+    Vector3D ParticleSystem::GetVelocity(std::size_t index) const {
+        return Vector3D(m_VelocityX[index], m_VelocityY[index], m_VelocityZ[index]);
+    }
+
+    std::span<const float> ParticleSystem::GetPositionsX() const {
+        return std::span<const float>(m_PositionX).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetPositionsY() const {
+        return std::span<const float>(m_PositionY).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetPositionsZ() const {
+        return std::span<const float>(m_PositionZ).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetVelocitiesX() const {
+        return std::span<const float>(m_VelocityX).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetVelocitiesY() const {
+        return std::span<const float>(m_VelocityY).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetVelocitiesZ() const {
+        return std::span<const float>(m_VelocityZ).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetAges() const {
+        return std::span<const float>(m_Age).first(m_Count);
+    }
+
+    std::span<const float> ParticleSystem::GetLifetimes() const {
+        return std::span<const float>(m_Lifetime).first(m_Count);
+    }
+
+} // namespace Math
@@ -0,0 +1,253 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "MathFwd.h"
+#include "Vector3D.h"
+
+namespace Math {
+
+    /**
+     * @brief Spawns particles with random positions in a box and random velocities.
+     */
+    struct ParticleEmitter {
+        /** Center of the spawn box */
+        Vector3D position = Vector3D(0.0f, 0.0f, 0.0f);
+
+        /** Half size of the spawn box along each axis */
+        Vector3D extent = Vector3D(0.0f, 0.0f, 0.0f);
+
+        /** Mean initial velocity */
+        Vector3D velocity = Vector3D(0.0f, 0.0f, 0.0f);
+
+        /** Largest deviation from the mean velocity along each axis */
+        Vector3D velocitySpread = Vector3D(0.0f, 0.0f, 0.0f);
+
+        /** Lifetimes are drawn uniformly from [minLifetime, maxLifetime] seconds */
+        float minLifetime = 1.0f;
+        float maxLifetime = 1.0f;
+
+        /** Particles spawned per second by ParticleSystem::Update */
+        float rate = 0.0f;
+    };
+
+    /**
+     * @brief Point force field pulling particles towards a position (or pushing, if negative).
+     *
+     * The acceleration is strength * d / (|d|^2 + softening^2)^(3/2), where d points from the
+     * particle to the attractor; softening keeps it finite at the center.
+     */
+    struct ParticleAttractor {
+        Vector3D position = Vector3D(0.0f, 0.0f, 0.0f);
+        float strength = 0.0f;
+        float softening = 1.0f;
+    };
+
+    /**
+     * @class ParticleSystem
+     * @brief Fixed-capacity particle simulation over structure-of-arrays streams.
+     *
+     * Each particle attribute (position and velocity components, age, lifetime) lives in its
+     * own float array, so the update streams through contiguous memory and processes four
+     * particles per SSE2 instruction. All storage is allocated by the constructor; spawning,
+     * updating and removing particles never allocate.
+     *
+     * Update spawns particles from the emitters, applies gravity, attractors and drag with
+     * semi-implicit Euler integration, and removes expired particles by moving the last
+     * particle into their slot. Particle order is therefore not stable. With a WorkerPool,
+     * the simulation runs in contiguous chunks on several threads and gives the same result
+     * as on one thread.
+     *
+     * Random numbers come from a counter-based hash of the spawn index, so a system with the
+     * same seed and the same calls always produces the same particles.
+     */
+    class ParticleSystem {
+    private:
+        std::size_t m_Count = 0;
+
+        // One stream per attribute, each sized to the capacity
+
+        std::vector<float> m_PositionX;
+        std::vector<float> m_PositionY;
+        std::vector<float> m_PositionZ;
+        std::vector<float> m_VelocityX;
+        std::vector<float> m_VelocityY;
+        std::vector<float> m_VelocityZ;
+        std::vector<float> m_Age;
+        std::vector<float> m_Lifetime;
+
+        std::vector<ParticleEmitter> m_Emitters;
+
+        /** Fraction of a particle each emitter carries over to the next update */
+        std::vector<float> m_EmitterCarry;
+
+        std::vector<ParticleAttractor> m_Attractors;
+        Vector3D m_Gravity = Vector3D(0.0f, 0.0f, 0.0f);
+        float m_Drag = 0.0f;
+
+        std::uint32_t m_Seed;
+
+        /** Number of particles spawned so far; indexes the random streams */
+        std::uint32_t m_SpawnCounter = 0;
+
+        std::size_t m_DroppedSpawnCount = 0;
+
+        /**
+         * @brief Applies forces and integrates the particles in [begin, end).
+         */
+        void Simulate(std::size_t begin, std::size_t end, float deltaTime);
+
+        /**
+         * @brief Removes expired particles by moving the last particle into their slot.
+         */
+        void RemoveExpired();
+
+    public:
+        /** Smallest number of particles worth simulating on another thread */
+        static constexpr std::size_t MinParticlesPerThread = 16384;
+
+        /**
+         * @brief Creates an empty system.
+         * @param capacity Maximum number of live particles
+         * @param seed Seed of the random spawn positions, velocities and lifetimes
+         */
+        explicit ParticleSystem(std::size_t capacity, std::uint32_t seed = 1);
+
+        // Emitters and forces
+
+        /**
+         * @brief Adds an emitter.
+         * @return Index of the emitter
+         * @throws std::invalid_argument if the lifetime range or rate is invalid
+         */
+        std::size_t AddEmitter(const ParticleEmitter& emitter);
+
+        /**
+         * @brief Gets an emitter for editing, e.g. to move it.
+         * @throws std::out_of_range if the index is invalid
+         */
+        [[nodiscard]] ParticleEmitter& GetEmitter(std::size_t index);
+
+        /**
+         * @brief Gets the number of emitters.
+         */
+        [[nodiscard]] std::size_t GetEmitterCount() const;
+
+        /**
+         * @brief Adds an attractor.
+         * @return Index of the attractor
+         */
+        std::size_t AddAttractor(const ParticleAttractor& attractor);
+
+        /**
+         * @brief Gets an attractor for editing.
+         * @throws std::out_of_range if the index is invalid
+         */
+        [[nodiscard]] ParticleAttractor& GetAttractor(std::size_t index);
+
+        /**
+         * @brief Removes all attractors.
+         */
+        void ClearAttractors();
+
+        /**
+         * @brief Sets the acceleration applied to every particle.
+         */
+        void SetGravity(const Vector3D& gravity);
+
+        /**
+         * @brief Sets the fraction of velocity lost per second (0 = no drag).
+         * @throws std::invalid_argument if drag is negative
+         */
+        void SetDrag(float drag);
+
+        // Simulation
+
+        /**
+         * @brief Spawns particles from an emitter immediately.
+         *
+         * Particles that do not fit into the remaining capacity are dropped and counted.
+         *
+         * @param emitterIndex The emitter
+         * @param count Number of particles to spawn
+         * @return Number of particles actually spawned
+         * @throws std::out_of_range if the emitter index is invalid
+         */
+        std::size_t Emit(std::size_t emitterIndex, std::size_t count);
+
+        /**
+         * @brief Advances the simulation by one step.
+         * @param deltaTime Step length in seconds
+         * @param pool Optional worker pool; the simulation is split between its threads
+         * @throws std::invalid_argument if deltaTime is negative or not finite
+         */
+        void Update(float deltaTime, WorkerPool* pool = nullptr);
+
+        /**
+         * @brief Removes all particles.
+         */
+        void Clear();
+
+        // Particle access
+
+        /**
+         * @brief Gets the number of live particles.
+         */
+        [[nodiscard]] std::size_t GetCount() const;
+
+        /**
+         * @brief Gets the maximum number of live particles.
+         */
+        [[nodiscard]] std::size_t GetCapacity() const;
+
+        /**
+         * @brief Gets the number of spawns dropped because the system was full.
+         */
+        [[nodiscard]] std::size_t GetDroppedSpawnCount() const;
+
+        /**
+         * @brief Gets the position of a live particle.
+         */
+        [[nodiscard]] Vector3D GetPosition(std::size_t index) const;
+
+        /**
+         * @brief Gets the velocity of a live particle.
+         */
+        [[nodiscard]] Vector3D GetVelocity(std::size_t index) const;
+
+        /**
+         * @brief Gets the x, y and z position components of all live particles.
+         */
+        [[nodiscard]] std::span<const float> GetPositionsX() const;
+        [[nodiscard]] std::span<const float> GetPositionsY() const;
+        [[nodiscard]] std::span<const float> GetPositionsZ() const;
+
+        /**
+         * @brief Gets the x, y and z velocity components of all live particles.
+         */
+        [[nodiscard]] std::span<const float> GetVelocitiesX() const;
+        [[nodiscard]] std::span<const float> GetVelocitiesY() const;
+        [[nodiscard]] std::span<const float> GetVelocitiesZ() const;
+
+        /**
+         * @brief Gets the age of all live particles in seconds.
+         */
+        [[nodiscard]] std::span<const float> GetAges() const;
+
+        /**
+         * @brief Gets the lifetime of all live particles in seconds.
+         */
+        [[nodiscard]] std::span<const float> GetLifetimes() const;
+    };
+
+} // namespace Math
+
+#endif // PARTICLE_SYSTEM_H
@@ -0,0 +1,175 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "ScalarMath.h"
+#include <cfloat>
+#include <limits>
+
+// Double arithmetic must not be evaluated in wider registers (x87), or rounding would
+// depend on register allocation
+#if defined(MATHENGINE_DETERMINISTIC) && defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+#error "MATHENGINE_DETERMINISTIC requires SSE2 floating point (FLT_EVAL_METHOD == 0)"
+#endif
+
+namespace Math::Deterministic {
+
+    namespace {
+
+        constexpr double Pi = 3.14159265358979311600e+00;
+        constexpr double HalfPi = 1.57079632679489655800e+00;
+        constexpr double QuarterPi = 7.85398163397448278999e-01;
+        constexpr double TwoOverPi = 6.36619772367581382433e-01;
+
+        // pi/2 split into three parts (Cody-Waite); the first has 33 significant bits, so
+        // k * HalfPi1 is exact for quadrant numbers k below 2^20
+        constexpr double HalfPi1 = 1.57079632673412561417e+00;
+        constexpr double HalfPi2 = 6.07710050630396597660e-11;
+        constexpr double HalfPi3 = 2.02226624879595063154e-21;
+
+        // tan(pi/8)
+        constexpr double TanEighthPi = 4.14213562373095145475e-01;
+
+        /**
+         * @brief Reduces x to r in [-pi/4, pi/4] with x = r + quadrant * pi/2.
+         */
+        double Reduce(double x, int& quadrant) {
+            // floor and the basic operations below are exact or correctly rounded
+            const double k = std::floor(x * TwoOverPi + 0.5);
+            const double kModFour = k - 4.0 * std::floor(k * 0.25);
+            quadrant = static_cast<int>(kModFour);
+            return ((x - k * HalfPi1) - k * HalfPi2) - k * HalfPi3;
+        }
+
+        // Taylor series on [-pi/4, pi/4]; the first omitted term is below 2e-9
+
+        double SinKernel(double r) {
+            const double z = r * r;
+            return r + r * z * (-1.0 / 6.0 + z * (1.0 / 120.0 + z * (-1.0 / 5040.0 + z * (1.0 / 362880.0
+                + z * (-1.0 / 39916800.0)))));
+        }
+
+        double CosKernel(double r) {
+            const double z = r * r;
+            return 1.0 + z * (-0.5 + z * (1.0 / 24.0 + z * (-1.0 / 720.0 + z * (1.0 / 40320.0
+                + z * (-1.0 / 3628800.0 + z * (1.0 / 479001600.0))))));
+        }
+
+        void SinCosDouble(float angleRadians, double& sine, double& cosine) {
+            int quadrant;
+            const double r = Reduce(angleRadians, quadrant);
+            const double s = SinKernel(r);
+            const double c = CosKernel(r);
+            switch (quadrant) {
+                case 0: sine = s; cosine = c; break;
+                case 1: sine = c; cosine = -s; break;
+                case 2: sine = -s; cosine = -c; break;
+                default: sine = -c; cosine = s; break;
+            }
+        }
+
+        /**
+         * @brief Arc tangent of t in [0, 1].
+         */
+        double AtanUnit(double t) {
+            // atan(t) = pi/4 + atan((t - 1) / (t + 1)) keeps the series argument below tan(pi/8)
+            double offset = 0.0;
+            if (t > TanEighthPi) {
+                t = (t - 1.0) / (t + 1.0);
+                offset = QuarterPi;
+            }
+
+            // Series up to t^23; the first omitted term is below 1e-10
+            const double z = t * t;
+            double sum = -1.0 / 23.0;
+            sum = 1.0 / 21.0 + z * sum;
+            sum = -1.0 / 19.0 + z * sum;
+            sum = 1.0 / 17.0 + z * sum;
+            sum = -1.0 / 15.0 + z * sum;
+            sum = 1.0 / 13.0 + z * sum;
+            sum = -1.0 / 11.0 + z * sum;
+            sum = 1.0 / 9.0 + z * sum;
+            sum = -1.0 / 7.0 + z * sum;
+            sum = 1.0 / 5.0 + z * sum;
+            sum = -1.0 / 3.0 + z * sum;
+            return offset + (t + t * z * sum);
+        }
+
+        double Atan2Double(double y, double x) {
+            if (std::isnan(x) || std::isnan(y)) {
+                return x + y;
+            }
+
+            const double ax = std::fabs(x);
+            const double ay = std::fabs(y);
+            double angle;
+            if (ax == ay) {
+                // Covers both zero and both infinite, where the ratio is undefined
+                angle = ax == 0.0 ? 0.0 : QuarterPi;
+            } else if (ay < ax) {
+                angle = AtanUnit(ay / ax);
+            } else {
+                angle = HalfPi - AtanUnit(ax / ay);
+            }
+
+            if (std::signbit(x)) {
+                angle = Pi - angle;
+            }
+            return std::copysign(angle, y);
+        }
+
+    } // namespace
+
+    float Sin(float angleRadians) {
+        if (!std::isfinite(angleRadians)) {
+            return angleRadians - angleRadians;
+        }
+        double sine, cosine;
+        SinCosDouble(angleRadians, sine, cosine);
+        // sin(-0) must stay -0
+        return angleRadians == 0.0f ? angleRadians : static_cast<float>(sine);
+    }
+
+    float Cos(float angleRadians) {
+        if (!std::isfinite(angleRadians)) {
+            return angleRadians - angleRadians;
+        }
+        double sine, cosine;
+        SinCosDouble(angleRadians, sine, cosine);
+        return static_cast<float>(cosine);
+    }
+
+    void SinCos(float angleRadians, float& sine, float& cosine) {
+        if (!std::isfinite(angleRadians)) {
+            sine = cosine = angleRadians - angleRadians;
+            return;
+        }
+        double s, c;
+        SinCosDouble(angleRadians, s, c);
+        sine = angleRadians == 0.0f ? angleRadians : static_cast<float>(s);
+        cosine = static_cast<float>(c);
+    }
+
+    float Tan(float angleRadians) {
+        if (!std::isfinite(angleRadians)) {
+            return angleRadians - angleRadians;
+        }
+        double sine, cosine;
+        SinCosDouble(angleRadians, sine, cosine);
+        return angleRadians == 0.0f ? angleRadians : static_cast<float>(sine / cosine);
+    }
+
+    float Acos(float value) {
+        const double x = value;
+        if (!(std::fabs(x) <= 1.0)) {
+            return std::numeric_limits<float>::quiet_NaN();
+        }
+        // acos(x) = atan2(sqrt(1 - x^2), x); the factored form keeps precision near |x| = 1
+        return static_cast<float>(Atan2Double(std::sqrt((1.0 - x) * (1.0 + x)), x));
+    }
+
+    float Atan2(float y, float x) {
+        return static_cast<float>(Atan2Double(y, x));
+    }
+
+} // namespace Math::Deterministic
@@ -0,0 +1,94 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef SCALAR_MATH_H
+#define SCALAR_MATH_H
+
+#include <cmath>
+
+/**
+ * @file ScalarMath.h
+ * @brief Trigonometric functions used by the library, with an optional deterministic mode.
+ *
+ * By default these forward to the standard library. When MATHENGINE_DETERMINISTIC is
+ * defined (CMake option of the same name), they use the in-library implementations of
+ * Math::Deterministic instead. Those only use IEEE 754 basic operations, which round the
+ * same way on every conforming platform, so results are bit-identical across compilers,
+ * standard libraries and CPUs. The CMake option also turns off floating-point contraction,
+ * so compilers cannot fuse a multiply and an add into an FMA differently per target.
+ *
+ * std::sqrt stays in use in both modes: IEEE 754 requires it to be correctly rounded.
+ */
+
+namespace Math {
+
+    /**
+     * @brief Libm-free sin, cos, tan, acos and atan2.
+     *
+     * Arguments are reduced and evaluated in double precision with a fixed operation order,
+     * then rounded to float once. Results are within 1 ulp of the exact value for arguments
+     * up to about 1e6 radians and stay deterministic (but lose accuracy) beyond. These are
+     * always available, so their results can be compared against the default mode.
+     */
+    namespace Deterministic {
+
+        /** @brief Sine of an angle in radians. */
+        [[nodiscard]] float Sin(float angleRadians);
+
+        /** @brief Cosine of an angle in radians. */
+        [[nodiscard]] float Cos(float angleRadians);
+
+        /**
+         * @brief Sine and cosine of an angle in radians, sharing one argument reduction.
+         */
+        void SinCos(float angleRadians, float& sine, float& cosine);
+
+        /** @brief Tangent of an angle in radians. */
+        [[nodiscard]] float Tan(float angleRadians);
+
+        /** @brief Arc cosine in radians, in [0, pi]; NaN outside [-1, 1]. */
+        [[nodiscard]] float Acos(float value);
+
+        /** @brief Angle of the point (x, y) in radians, in [-pi, pi]. */
+        [[nodiscard]] float Atan2(float y, float x);
+
+    } // namespace Deterministic
+
+#if defined(MATHENGINE_DETERMINISTIC)
+
+    [[nodiscard]] inline float Sin(float angleRadians) { return Deterministic::Sin(angleRadians); }
+    [[nodiscard]] inline float Cos(float angleRadians) { return Deterministic::Cos(angleRadians); }
+    inline void SinCos(float angleRadians, float& sine, float& cosine) { Deterministic::SinCos(angleRadians, sine, cosine); }
+    [[nodiscard]] inline float Tan(float angleRadians) { return Deterministic::Tan(angleRadians); }
+    [[nodiscard]] inline float Acos(float value) { return Deterministic::Acos(value); }
+    [[nodiscard]] inline float Atan2(float y, float x) { return Deterministic::Atan2(y, x); }
+
+#else
+
+    /** @brief Sine of an angle in radians. */
+    [[nodiscard]] inline float Sin(float angleRadians) { return std::sin(angleRadians); }
+
+    /** @brief Cosine of an angle in radians. */
+    [[nodiscard]] inline float Cos(float angleRadians) { return std::cos(angleRadians); }
+
+    /** @brief Sine and cosine of an angle in radians. */
+    inline void SinCos(float angleRadians, float& sine, float& cosine) {
+        sine = std::sin(angleRadians);
+        cosine = std::cos(angleRadians);
+    }
+
+    /** @brief Tangent of an angle in radians. */
+    [[nodiscard]] inline float Tan(float angleRadians) { return std::tan(angleRadians); }
+
+    /** @brief Arc cosine in radians. */
+    [[nodiscard]] inline float Acos(float value) { return std::acos(value); }
+
+    /** @brief Angle of the point (x, y) in radians. */
+    [[nodiscard]] inline float Atan2(float y, float x) { return std::atan2(y, x); }
+
+#endif
+
+} // namespace Math
+
+#endif // SCALAR_MATH_H
@@ -0,0 +1,15 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef SIMD_CONFIG_H
+#define SIMD_CONFIG_H
+
+// SSE2 is part of every x86-64 target; define MATHENGINE_NO_SIMD to force the scalar paths.
+// Every vectorized function has a scalar fallback that produces the same results.
+#if !defined(MATHENGINE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATHENGINE_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#endif // SIMD_CONFIG_H
@@ -0,0 +1,449 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "SphFluid.h"
+#include "Constants.h"
+#include "SimdConfig.h"
+#include "Trace.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        template <typename Process>
+        void RunChunks(WorkerPool* pool, std::size_t count, Process&& process) {
+            if (pool != nullptr) {
+                pool->ParallelForChunks(count, SphFluid::MinParticlesPerThread, process);
+            } else {
+                process(0, count);
+            }
+        }
+
+#if defined(MATHENGINE_SIMD_SSE2)
+        float HorizontalSum(__m128 values) {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, values);
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+#endif
+
+    } // namespace
+
+    SphFluid::SphFluid(const Vector3D& boundsMin, const Vector3D& boundsMax, const SphSettings& settings)
+        : m_BoundsMin(boundsMin), m_BoundsMax(boundsMax) {
+        if (!(boundsMin.x < boundsMax.x && boundsMin.y < boundsMax.y && boundsMin.z < boundsMax.z)) {
+            throw std::invalid_argument("Fluid bounds must not be empty");
+        }
+        SetSettings(settings);
+    }
+
+    void SphFluid::SetSettings(const SphSettings& settings) {
+        if (!(settings.smoothingRadius > 0.0f) || !(settings.particleMass > 0.0f) || !(settings.restDensity > 0.0f)) {
+            throw std::invalid_argument("Smoothing radius, particle mass and rest density must be positive");
+        }
+        if (!(settings.stiffness >= 0.0f) || !(settings.viscosity >= 0.0f)) {
+            throw std::invalid_argument("Stiffness and viscosity must not be negative");
+        }
+        if (!(settings.boundaryRestitution >= 0.0f && settings.boundaryRestitution <= 1.0f)) {
+            throw std::invalid_argument("Boundary restitution must be in [0, 1]");
+        }
+        m_Settings = settings;
+    }
+
+    const SphSettings& SphFluid::GetSettings() const {
+        return m_Settings;
+    }
+
+    // Particles
+
+    std::size_t SphFluid::AddParticle(const Vector3D& position, const Vector3D& velocity) {
+        m_PositionX.push_back(std::clamp(position.x, m_BoundsMin.x, m_BoundsMax.x));
+        m_PositionY.push_back(std::clamp(position.y, m_BoundsMin.y, m_BoundsMax.y));
+        m_PositionZ.push_back(std::clamp(position.z, m_BoundsMin.z, m_BoundsMax.z));
+        m_VelocityX.push_back(velocity.x);
+        m_VelocityY.push_back(velocity.y);
+        m_VelocityZ.push_back(velocity.z);
+        m_Density.push_back(0.0f);
+        m_Pressure.push_back(0.0f);
+        return m_PositionX.size() - 1;
+    }
+
+    std::size_t SphFluid::AddBlock(const Vector3D& blockMin, const Vector3D& blockMax, float spacing) {
+        if (!(spacing > 0.0f)) {
+            throw std::invalid_argument("Particle spacing must be positive");
+        }
+        // Counts rather than accumulated coordinates, so rounding cannot add or drop a layer
+        auto layers = [spacing](float low, float high) {
+            return high < low ? 0 : static_cast<std::uint32_t>(std::floor((high - low) / spacing + 1e-4f)) + 1;
+        };
+        const std::uint32_t countX = layers(blockMin.x, blockMax.x);
+        const std::uint32_t countY = layers(blockMin.y, blockMax.y);
+        const std::uint32_t countZ = layers(blockMin.z, blockMax.z);
+        for (std::uint32_t z = 0; z < countZ; ++z) {
+            for (std::uint32_t y = 0; y < countY; ++y) {
+                for (std::uint32_t x = 0; x < countX; ++x) {
+                    AddParticle(blockMin + Vector3D(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * spacing);
+                }
+            }
+        }
+        return static_cast<std::size_t>(countX) * countY * countZ;
+    }
+
+    void SphFluid::Clear() {
+        for (std::vector<float>* stream : {&m_PositionX, &m_PositionY, &m_PositionZ, &m_VelocityX, &m_VelocityY,
+                                           &m_VelocityZ, &m_Density, &m_Pressure}) {
+            stream->clear();
+        }
+    }
+
+    std::size_t SphFluid::GetCount() const {
+        return m_PositionX.size();
+    }
+
+    Vector3D SphFluid::GetPosition(std::size_t index) const {
+        if (index >= GetCount()) {
+            throw std::out_of_range("Particle index out of range");
+        }
+        return Vector3D(m_PositionX[index], m_PositionY[index], m_PositionZ[index]);
+    }
+
+    Vector3D SphFluid::GetVelocity(std::size_t index) const {
+        if (index >= GetCount()) {
+            throw std::out_of_range("Particle index out of range");
+        }
+        return Vector3D(m_VelocityX[index], m_VelocityY[index], m_VelocityZ[index]);
+    }
+
+    std::span<const float> SphFluid::GetPositionsX() const {
+        return m_PositionX;
+    }
+
+    std::span<const float> SphFluid::GetPositionsY() const {
+        return m_PositionY;
+    }
+
+    std::span<const float> SphFluid::GetPositionsZ() const {
+        return m_PositionZ;
+    }
+
+    std::span<const float> SphFluid::GetDensities() const {
+        return m_Density;
+    }
+
+    // Spatial hash
+
+    std::int32_t SphFluid::CellOf(float coordinate) const {
+        return static_cast<std::int32_t>(std::floor(coordinate / m_Settings.smoothingRadius));
+    }
+
+    std::uint32_t SphFluid::BucketOf(std::int32_t cellX, std::int32_t cellY, std::int32_t cellZ) const {
+        // Teschner et al.'s hash of y and z, offset by x so that rows of cells along x land in
+        // consecutive buckets and their particles are contiguous after sorting
+        const std::uint32_t hash = (static_cast<std::uint32_t>(cellY) * 19349663u) ^
+                                   (static_cast<std::uint32_t>(cellZ) * 83492791u);
+        return (hash + static_cast<std::uint32_t>(cellX)) & m_BucketMask;
+    }
+
+    void SphFluid::BuildHash(WorkerPool* pool) {
+        const std::size_t count = GetCount();
+
+        // About two buckets per particle keeps collisions between occupied cells rare
+        const std::size_t bucketCount = std::bit_ceil(std::max<std::size_t>(2 * count, 64));
+        m_BucketMask = static_cast<std::uint32_t>(bucketCount - 1);
+        m_Buckets.resize(count);
+        RunChunks(pool, count, [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                m_Buckets[i] = BucketOf(CellOf(m_PositionX[i]), CellOf(m_PositionY[i]), CellOf(m_PositionZ[i]));
+            }
+        });
+
+        // Counting sort; the scatter advances each bucket's start to the next bucket's start,
+        // so the starts are shifted back afterwards
+        m_BucketStart.assign(bucketCount + 1, 0);
+        for (const std::uint32_t bucket : m_Buckets) {
+            ++m_BucketStart[bucket];
+        }
+        std::uint32_t first = 0;
+        for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+            const std::uint32_t size = m_BucketStart[bucket];
+            m_BucketStart[bucket] = first;
+            first += size;
+        }
+        m_Order.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            m_Order[m_BucketStart[m_Buckets[i]]++] = static_cast<std::uint32_t>(i);
+        }
+        for (std::size_t bucket = bucketCount; bucket > 0; --bucket) {
+            m_BucketStart[bucket] = m_BucketStart[bucket - 1];
+        }
+        m_BucketStart[0] = 0;
+
+        // Reorder the particles themselves so neighbors are read from contiguous memory
+        m_Scratch.resize(count);
+        for (std::vector<float>* stream : {&m_PositionX, &m_PositionY, &m_PositionZ, &m_VelocityX, &m_VelocityY, &m_VelocityZ}) {
+            RunChunks(pool, count, [this, stream](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    m_Scratch[i] = (*stream)[m_Order[i]];
+                }
+            });
+            stream->swap(m_Scratch);
+        }
+    }
+
+    std::size_t SphFluid::GatherNeighborRanges(std::int32_t cellX, std::int32_t cellY, std::int32_t cellZ,
+                                               std::uint32_t* ranges) const {
+        std::uint32_t buckets[27];
+        std::size_t bucketCount = 0;
+        for (std::int32_t z = cellZ - 1; z <= cellZ + 1; ++z) {
+            for (std::int32_t y = cellY - 1; y <= cellY + 1; ++y) {
+                for (std::int32_t x = cellX - 1; x <= cellX + 1; ++x) {
+                    buckets[bucketCount++] = BucketOf(x, y, z);
+                }
+            }
+        }
+
+        // Cells that hash to the same bucket must not visit its particles twice. Sorted
+        // buckets also let ranges that follow each other merge, mostly into one per row of 3 cells.
+        std::sort(buckets, buckets + bucketCount);
+        bucketCount = static_cast<std::size_t>(std::unique(buckets, buckets + bucketCount) - buckets);
+        std::size_t rangeCount = 0;
+        for (std::size_t i = 0; i < bucketCount; ++i) {
+            const std::uint32_t start = m_BucketStart[buckets[i]];
+            const std::uint32_t end = m_BucketStart[buckets[i] + 1];
+            if (start == end) {
+                continue;
+            }
+            if (rangeCount > 0 && ranges[2 * rangeCount - 1] == start) {
+                ranges[2 * rangeCount - 1] = end;
+            } else {
+                ranges[2 * rangeCount] = start;
+                ranges[2 * rangeCount + 1] = end;
+                ++rangeCount;
+            }
+        }
+        return rangeCount;
+    }
+
+    // Simulation
+
+    void SphFluid::ComputeDensities(std::size_t begin, std::size_t end) {
+        const float* px = m_PositionX.data();
+        const float* py = m_PositionY.data();
+        const float* pz = m_PositionZ.data();
+        const float h = m_Settings.smoothingRadius;
+        const float h2 = h * h;
+        const float h6 = h2 * h2 * h2;
+        const float poly6 = 315.0f / (64.0f * Constants::PI * (h6 * h2 * h));
+
+        std::uint32_t ranges[54];
+        std::size_t rangeCount = 0;
+        std::int32_t lastCell[3] = {0, 0, 0};
+        bool haveRanges = false;
+        for (std::size_t i = begin; i < end; ++i) {
+            const float xi = px[i], yi = py[i], zi = pz[i];
+            const std::int32_t cell[3] = {CellOf(xi), CellOf(yi), CellOf(zi)};
+            if (!haveRanges || !std::equal(cell, cell + 3, lastCell)) {
+                rangeCount = GatherNeighborRanges(cell[0], cell[1], cell[2], ranges);
+                std::copy(cell, cell + 3, lastCell);
+                haveRanges = true;
+            }
+
+            // Sum of (h^2 - r^2)^3 over the neighbors, including the particle itself
+            float sum = 0.0f;
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 x4 = _mm_set1_ps(xi), y4 = _mm_set1_ps(yi), z4 = _mm_set1_ps(zi);
+            const __m128 h24 = _mm_set1_ps(h2);
+            __m128 sum4 = _mm_setzero_ps();
+#endif
+            for (std::size_t range = 0; range < rangeCount; ++range) {
+                std::size_t j = ranges[2 * range];
+                const std::size_t rangeEnd = ranges[2 * range + 1];
+#if defined(MATHENGINE_SIMD_SSE2)
+                for (; j + 4 <= rangeEnd; j += 4) {
+                    const __m128 dx = _mm_sub_ps(_mm_loadu_ps(px + j), x4);
+                    const __m128 dy = _mm_sub_ps(_mm_loadu_ps(py + j), y4);
+                    const __m128 dz = _mm_sub_ps(_mm_loadu_ps(pz + j), z4);
+                    const __m128 r2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                    const __m128 t = _mm_sub_ps(h24, r2);
+                    sum4 = _mm_add_ps(sum4, _mm_and_ps(_mm_cmplt_ps(r2, h24), _mm_mul_ps(_mm_mul_ps(t, t), t)));
+                }
+#endif
+                for (; j < rangeEnd; ++j) {
+                    const float dx = px[j] - xi, dy = py[j] - yi, dz = pz[j] - zi;
+                    const float r2 = dx * dx + dy * dy + dz * dz;
+                    if (r2 < h2) {
+                        const float t = h2 - r2;
+                        sum += t * t * t;
+                    }
+                }
+            }
+#if defined(MATHENGINE_SIMD_SSE2)
+            sum += HorizontalSum(sum4);
+#endif
+
+            const float density = m_Settings.particleMass * poly6 * sum;
+            m_Density[i] = density;
+            m_InverseDensity[i] = 1.0f / density;
+            m_Pressure[i] = std::max(0.0f, m_Settings.stiffness * (density - m_Settings.restDensity));
+        }
+    }
+
+    void SphFluid::ComputeAccelerations(std::size_t begin, std::size_t end) {
+        const float* px = m_PositionX.data();
+        const float* py = m_PositionY.data();
+        const float* pz = m_PositionZ.data();
+        const float* vx = m_VelocityX.data();
+        const float* vy = m_VelocityY.data();
+        const float* vz = m_VelocityZ.data();
+        const float* pressure = m_Pressure.data();
+        const float* inverseDensity = m_InverseDensity.data();
+        const float h = m_Settings.smoothingRadius;
+        const float h2 = h * h;
+
+        // The spiky gradient and the viscosity Laplacian share the constant 45 / (pi h^6)
+        const float kernel = 45.0f / (Constants::PI * (h2 * h2 * h2));
+        const float pressureScale = -0.5f * m_Settings.particleMass * kernel;
+        const float viscosityScale = m_Settings.viscosity * m_Settings.particleMass * kernel;
+
+        std::uint32_t ranges[54];
+        std::size_t rangeCount = 0;
+        std::int32_t lastCell[3] = {0, 0, 0};
+        bool haveRanges = false;
+        for (std::size_t i = begin; i < end; ++i) {
+            const float xi = px[i], yi = py[i], zi = pz[i];
+            const float vxi = vx[i], vyi = vy[i], vzi = vz[i];
+            const float pi = pressure[i];
+            const std::int32_t cell[3] = {CellOf(xi), CellOf(yi), CellOf(zi)};
+            if (!haveRanges || !std::equal(cell, cell + 3, lastCell)) {
+                rangeCount = GatherNeighborRanges(cell[0], cell[1], cell[2], ranges);
+                std::copy(cell, cell + 3, lastCell);
+                haveRanges = true;
+            }
+
+            // Pressure: sum of (pi + pj) / rhoj * (h - r)^2 / r * d, with d pointing to the neighbor
+            // Viscosity: sum of (vj - vi) / rhoj * (h - r)
+            float pressureX = 0.0f, pressureY = 0.0f, pressureZ = 0.0f;
+            float viscosityX = 0.0f, viscosityY = 0.0f, viscosityZ = 0.0f;
+#if defined(MATHENGINE_SIMD_SSE2)
+            const __m128 x4 = _mm_set1_ps(xi), y4 = _mm_set1_ps(yi), z4 = _mm_set1_ps(zi);
+            const __m128 vx4 = _mm_set1_ps(vxi), vy4 = _mm_set1_ps(vyi), vz4 = _mm_set1_ps(vzi);
+            const __m128 pi4 = _mm_set1_ps(pi);
+            const __m128 h4 = _mm_set1_ps(h);
+            const __m128 h24 = _mm_set1_ps(h2);
+            const __m128 zero = _mm_setzero_ps();
+            __m128 pressureX4 = zero, pressureY4 = zero, pressureZ4 = zero;
+            __m128 viscosityX4 = zero, viscosityY4 = zero, viscosityZ4 = zero;
+#endif
+            for (std::size_t range = 0; range < rangeCount; ++range) {
+                std::size_t j = ranges[2 * range];
+                const std::size_t rangeEnd = ranges[2 * range + 1];
+#if defined(MATHENGINE_SIMD_SSE2)
+                for (; j + 4 <= rangeEnd; j += 4) {
+                    const __m128 dx = _mm_sub_ps(_mm_loadu_ps(px + j), x4);
+                    const __m128 dy = _mm_sub_ps(_mm_loadu_ps(py + j), y4);
+                    const __m128 dz = _mm_sub_ps(_mm_loadu_ps(pz + j), z4);
+                    const __m128 r2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+                    // The particle itself and coincident particles (r = 0) are masked out
+                    const __m128 mask = _mm_and_ps(_mm_cmplt_ps(r2, h24), _mm_cmpgt_ps(r2, zero));
+                    if (_mm_movemask_ps(mask) == 0) {
+                        continue;
+                    }
+                    const __m128 r = _mm_sqrt_ps(r2);
+                    const __m128 q = _mm_sub_ps(h4, r);
+                    const __m128 inverseDensityJ = _mm_loadu_ps(inverseDensity + j);
+                    const __m128 pressureTerm = _mm_and_ps(mask, _mm_div_ps(
+                        _mm_mul_ps(_mm_mul_ps(_mm_add_ps(pi4, _mm_loadu_ps(pressure + j)), inverseDensityJ), _mm_mul_ps(q, q)), r));
+                    const __m128 viscosityTerm = _mm_and_ps(mask, _mm_mul_ps(inverseDensityJ, q));
+                    pressureX4 = _mm_add_ps(pressureX4, _mm_mul_ps(pressureTerm, dx));
+                    pressureY4 = _mm_add_ps(pressureY4, _mm_mul_ps(pressureTerm, dy));
+                    pressureZ4 = _mm_add_ps(pressureZ4, _mm_mul_ps(pressureTerm, dz));
+                    viscosityX4 = _mm_add_ps(viscosityX4, _mm_mul_ps(viscosityTerm, _mm_sub_ps(_mm_loadu_ps(vx + j), vx4)));
+                    viscosityY4 = _mm_add_ps(viscosityY4, _mm_mul_ps(viscosityTerm, _mm_sub_ps(_mm_loadu_ps(vy + j), vy4)));
+                    viscosityZ4 = _mm_add_ps(viscosityZ4, _mm_mul_ps(viscosityTerm, _mm_sub_ps(_mm_loadu_ps(vz + j), vz4)));
+                }
+#endif
+                for (; j < rangeEnd; ++j) {
+                    const float dx = px[j] - xi, dy = py[j] - yi, dz = pz[j] - zi;
+                    const float r2 = dx * dx + dy * dy + dz * dz;
+                    if (!(r2 < h2 && r2 > 0.0f)) {
+                        continue;
+                    }
+                    const float r = std::sqrt(r2);
+                    const float q = h - r;
+                    const float pressureTerm = ((pi + pressure[j]) * inverseDensity[j] * (q * q)) / r;
+                    const float viscosityTerm = inverseDensity[j] * q;
+                    pressureX += pressureTerm * dx;
+                    pressureY += pressureTerm * dy;
+                    pressureZ += pressureTerm * dz;
+                    viscosityX += viscosityTerm * (vx[j] - vxi);
+                    viscosityY += viscosityTerm * (vy[j] - vyi);
+                    viscosityZ += viscosityTerm * (vz[j] - vzi);
+                }
+            }
+#if defined(MATHENGINE_SIMD_SSE2)
+            pressureX += HorizontalSum(pressureX4);
+            pressureY += HorizontalSum(pressureY4);
+            pressureZ += HorizontalSum(pressureZ4);
+            viscosityX += HorizontalSum(viscosityX4);
+            viscosityY += HorizontalSum(viscosityY4);
+            viscosityZ += HorizontalSum(viscosityZ4);
+#endif
+
+            const float inverseDensityI = inverseDensity[i];
+            m_AccelerationX[i] = (pressureScale * pressureX + viscosityScale * viscosityX) * inverseDensityI + m_Settings.gravity.x;
+            m_AccelerationY[i] = (pressureScale * pressureY + viscosityScale * viscosityY) * inverseDensityI + m_Settings.gravity.y;
+            m_AccelerationZ[i] = (pressureScale * pressureZ + viscosityScale * viscosityZ) * inverseDensityI + m_Settings.gravity.z;
+        }
+    }
+
+    void SphFluid::Integrate(float deltaTime, std::size_t begin, std::size_t end) {
+        const float restitution = m_Settings.boundaryRestitution;
+        auto advance = [deltaTime, restitution](float& position, float& velocity, float acceleration, float low, float high) {
+            velocity += acceleration * deltaTime;
+            position += velocity * deltaTime;
+            if (position < low) {
+                position = low;
+                velocity = velocity < 0.0f ? -velocity * restitution : velocity;
+            } else if (position > high) {
+                position = high;
+                velocity = velocity > 0.0f ? -velocity * restitution : velocity;
+            }
+        };
+        for (std::size_t i = begin; i < end; ++i) {
+            advance(m_PositionX[i], m_VelocityX[i], m_AccelerationX[i], m_BoundsMin.x, m_BoundsMax.x);
+            advance(m_PositionY[i], m_VelocityY[i], m_AccelerationY[i], m_BoundsMin.y, m_BoundsMax.y);
+            advance(m_PositionZ[i], m_VelocityZ[i], m_AccelerationZ[i], m_BoundsMin.z, m_BoundsMax.z);
+        }
+    }
+
+    void SphFluid::Step(float deltaTime, WorkerPool* pool) {
+        MATH_TRACE_SCOPE("SphFluid::Step");
+        if (!(deltaTime >= 0.0f)) {
+            throw std::invalid_argument("Time step must not be negative");
+        }
+        const std::size_t count = GetCount();
+        if (count == 0) {
+            return;
+        }
+
+        BuildHash(pool);
+        m_InverseDensity.resize(count);
+        m_AccelerationX.resize(count);
+        m_AccelerationY.resize(count);
+        m_AccelerationZ.resize(count);
+
+        // Each pass reads what the previous pass wrote for the neighbors, so the passes are
+        // separate parallel loops
+        RunChunks(pool, count, [this](std::size_t begin, std::size_t end) { ComputeDensities(begin, end); });
+        RunChunks(pool, count, [this](std::size_t begin, std::size_t end) { ComputeAccelerations(begin, end); });
+        RunChunks(pool, count, [this, deltaTime](std::size_t begin, std::size_t end) { Integrate(deltaTime, begin, end); });
+    }
+
+} // namespace Math
@@ -0,0 +1,478 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef TAGGED_MATRIX4D_H
+#define TAGGED_MATRIX4D_H
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Matrix4D.h"
+#include "Vector3D.h"
+#include "Constants.h"
+
+namespace Math {
+
+/**
+ * @brief Structural kind of a 4x4 transformation matrix.
+ *
+ * The kinds are ordered from most to least specialized; every kind is also a valid
+ * instance of the kinds after it, and the product of two matrices is (at most) the
+ * larger of their two kinds.
+ */
+enum class Matrix4DKind : std::uint8_t {
+    /** Exactly the identity matrix */
+    Identity = 0,
+    /** Identity 3x3 block plus a translation column */
+    Translation = 1,
+    /** Arbitrary 3x3 block plus a translation column, last row (0, 0, 0, 1) */
+    Affine = 2,
+    /** Any matrix, including projections */
+    Projective = 3
+};
+
+/**
+ * @class TaggedMatrix4D
+ * @brief A Matrix4D paired with its structural kind.
+ *
+ * The kind is recorded by the factory functions and propagated through multiplication
+ * and inversion, so each operation can use the cheapest kernel for its operands without
+ * examining all 16 elements at runtime. For example, translation × affine is three
+ * additions and the inverse of an affine matrix only needs a 3x3 inverse.
+ *
+ * The wrapper is optional: the underlying matrix is always available through
+ * the public matrix member for APIs that take a plain Matrix4D.
+ */
+struct TaggedMatrix4D {
+    /** The wrapped matrix */
+    Matrix4D matrix;
+
+    /** The structural kind of the wrapped matrix */
+    Matrix4DKind kind;
+
+    /**
+     * @brief Default constructor - creates a tagged identity matrix.
+     */
+    constexpr TaggedMatrix4D()
+        : matrix(), kind(Matrix4DKind::Identity) {}
+
+    /**
+     * @brief Constructor from a matrix whose kind is already known.
+     *
+     * The kind is trusted as-is. Passing a kind that is more specialized than the matrix
+     * really is will make the fast kernels produce wrong results.
+     *
+     * @param matrix The matrix to wrap
+     * @param kind The structural kind of the matrix
+     */
+    constexpr TaggedMatrix4D(const Matrix4D& matrix, Matrix4DKind kind)
+        : matrix(matrix), kind(kind) {}
+
+    /**
+     * @brief Constructor from an untagged matrix; the kind is found by inspecting its elements.
+     *
+     * @param matrix The matrix to wrap
+     */
+    explicit constexpr TaggedMatrix4D(const Matrix4D& matrix)
+        : matrix(matrix), kind(Classify(matrix)) {}
+
+    /**
+     * @brief Determines the most specialized kind that describes a matrix exactly.
+     *
+     * @param m The matrix to classify
+     * @return The structural kind of the matrix
+     */
+    [[nodiscard]] static constexpr Matrix4DKind Classify(const Matrix4D& m) {
+        if (m.m30 != 0.0f || m.m31 != 0.0f || m.m32 != 0.0f || m.m33 != 1.0f) {
+            return Matrix4DKind::Projective;
+        }
+        if (m.m00 != 1.0f || m.m01 != 0.0f || m.m02 != 0.0f ||
+            m.m10 != 0.0f || m.m11 != 1.0f || m.m12 != 0.0f ||
+            m.m20 != 0.0f || m.m21 != 0.0f || m.m22 != 1.0f) {
+            return Matrix4DKind::Affine;
+        }
+        if (m.m03 != 0.0f || m.m13 != 0.0f || m.m23 != 0.0f) {
+            return Matrix4DKind::Translation;
+        }
+        return Matrix4DKind::Identity;
+    }
+
+    // Factory functions
+
+    /**
+     * @brief Creates a tagged identity matrix.
+     *
+     * @return Identity matrix tagged as Identity
+     */
+    [[nodiscard]] static constexpr TaggedMatrix4D Identity() {
+        return TaggedMatrix4D();
+    }
+
+    /**
+     * @brief Creates a tagged translation matrix.
+     *
+     * @param x Translation along X axis
+     * @param y Translation along Y axis
+     * @param z Translation along Z axis
+     * @return Translation matrix tagged as Translation
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateTranslation(float x, float y, float z) {
+        return TaggedMatrix4D(Matrix4D::CreateTranslation(x, y, z), Matrix4DKind::Translation);
+    }
+
+    /**
+     * @brief Creates a tagged translation matrix.
+     *
+     * @param translation Vector with translation values for each axis
+     * @return Translation matrix tagged as Translation
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateTranslation(const Vector3D& translation) {
+        return CreateTranslation(translation.x, translation.y, translation.z);
+    }
+
+    /**
+     * @brief Creates a tagged scaling matrix.
+     *
+     * @param scaleX Scale factor along X axis
+     * @param scaleY Scale factor along Y axis
+     * @param scaleZ Scale factor along Z axis
+     * @return Scaling matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateScale(float scaleX, float scaleY, float scaleZ) {
+        return TaggedMatrix4D(Matrix4D::CreateScale(scaleX, scaleY, scaleZ), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Creates a tagged scaling matrix.
+     *
+     * @param scale Vector with scale factors for each axis
+     * @return Scaling matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateScale(const Vector3D& scale) {
+        return CreateScale(scale.x, scale.y, scale.z);
+    }
+
+    /**
+     * @brief Creates a tagged uniform scaling matrix.
+     *
+     * @param scale Uniform scale factor for all axes
+     * @return Scaling matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateScale(float scale) {
+        return CreateScale(scale, scale, scale);
+    }
+
+    /**
+     * @brief Creates a tagged rotation matrix around the X axis.
+     *
+     * @param angleRadians Rotation angle in radians
+     * @return Rotation matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateRotationX(float angleRadians) {
+        return TaggedMatrix4D(Matrix4D::CreateRotationX(angleRadians), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Creates a tagged rotation matrix around the Y axis.
+     *
+     * @param angleRadians Rotation angle in radians
+     * @return Rotation matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateRotationY(float angleRadians) {
+        return TaggedMatrix4D(Matrix4D::CreateRotationY(angleRadians), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Creates a tagged rotation matrix around the Z axis.
+     *
+     * @param angleRadians Rotation angle in radians
+     * @return Rotation matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateRotationZ(float angleRadians) {
+        return TaggedMatrix4D(Matrix4D::CreateRotationZ(angleRadians), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Creates a tagged rotation matrix around an arbitrary axis.
+     *
+     * @param axis Normalized rotation axis
+     * @param angleRadians Rotation angle in radians
+     * @return Rotation matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateRotation(const Vector3D& axis, float angleRadians) {
+        return TaggedMatrix4D(Matrix4D::CreateRotation(axis, angleRadians), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Creates a tagged transformation matrix from position, axis-angle rotation and scale.
+     *
+     * @param position Translation vector
+     * @param rotationAxis Normalized rotation axis
+     * @param rotationAngleRadians Rotation angle in radians
+     * @param scale Scale vector
+     * @return Transformation matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateTransformation(
+        const Vector3D& position,
+        const Vector3D& rotationAxis,
+        float rotationAngleRadians,
+        const Vector3D& scale
+    ) {
+        return CreateTranslation(position) *
+               CreateRotation(rotationAxis, rotationAngleRadians) *
+               CreateScale(scale);
+    }
+
+    /**
+     * @brief Creates a tagged view matrix looking at a target.
+     *
+     * @param eye Position of the camera
+     * @param target Position to look at
+     * @param up Up vector (typically Vector3D(0, 1, 0))
+     * @return View matrix tagged as Affine
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateLookAt(const Vector3D& eye, const Vector3D& target, const Vector3D& up) {
+        return TaggedMatrix4D(Matrix4D::CreateLookAt(eye, target, up), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Creates a tagged perspective projection matrix.
+     *
+     * @param fovYRadians Vertical field of view in radians
+     * @param aspectRatio Width divided by height of the viewport
+     * @param nearPlane Distance to the near clipping plane (must be positive)
+     * @param farPlane Distance to the far clipping plane (must be greater than nearPlane)
+     * @return Projection matrix tagged as Projective
+     * @throws std::invalid_argument if nearPlane <= 0 or farPlane <= nearPlane
+     */
+    [[nodiscard]] static TaggedMatrix4D CreatePerspective(float fovYRadians, float aspectRatio, float nearPlane, float farPlane) {
+        return TaggedMatrix4D(Matrix4D::CreatePerspective(fovYRadians, aspectRatio, nearPlane, farPlane),
+                              Matrix4DKind::Projective);
+    }
+
+    /**
+     * @brief Creates a tagged orthographic projection matrix.
+     *
+     * Matrix4D::CreateOrthographic stores its offsets in the last row, so the result
+     * is tagged as Projective.
+     *
+     * @param left Left coordinate of the viewport
+     * @param right Right coordinate of the viewport
+     * @param bottom Bottom coordinate of the viewport
+     * @param top Top coordinate of the viewport
+     * @param nearPlane Distance to the near clipping plane
+     * @param farPlane Distance to the far clipping plane
+     * @return Projection matrix tagged as Projective
+     * @throws std::invalid_argument if left = right, bottom = top, or nearPlane = farPlane
+     */
+    [[nodiscard]] static TaggedMatrix4D CreateOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) {
+        return TaggedMatrix4D(Matrix4D::CreateOrthographic(left, right, bottom, top, nearPlane, farPlane),
+                              Matrix4DKind::Projective);
+    }
+
+    // Operations
+
+    /**
+     * @brief Multiplies two tagged matrices, dispatching on their kinds.
+     *
+     * - Identity × M and M × Identity return M unchanged
+     * - Translation × Translation adds the translations (3 additions)
+     * - Translation × Affine offsets the affine translation column (3 additions)
+     * - Affine × Translation transforms the translation by the 3x3 block
+     * - Affine × Affine skips the constant last row
+     * - Anything involving a projective matrix uses the full 4x4 product
+     *
+     * @param other The matrix to multiply with (applied first)
+     * @return The tagged product this * other
+     */
+    [[nodiscard]] constexpr TaggedMatrix4D operator*(const TaggedMatrix4D& other) const {
+        if (kind == Matrix4DKind::Identity) {
+            return other;
+        }
+        if (other.kind == Matrix4DKind::Identity) {
+            return *this;
+        }
+        if (kind == Matrix4DKind::Projective || other.kind == Matrix4DKind::Projective) {
+            return TaggedMatrix4D(matrix * other.matrix, Matrix4DKind::Projective);
+        }
+
+        const Matrix4D& a = matrix;
+        const Matrix4D& b = other.matrix;
+
+        if (kind == Matrix4DKind::Translation) {
+            // T(t) * M: only the translation column of M changes
+            Matrix4D result = b;
+            result.m03 += a.m03;
+            result.m13 += a.m13;
+            result.m23 += a.m23;
+            return TaggedMatrix4D(result, other.kind);
+        }
+
+        if (other.kind == Matrix4DKind::Translation) {
+            // A * T(t): translation becomes A's 3x3 block applied to t, plus A's translation
+            Matrix4D result = a;
+            result.m03 = a.m00 * b.m03 + a.m01 * b.m13 + a.m02 * b.m23 + a.m03;
+            result.m13 = a.m10 * b.m03 + a.m11 * b.m13 + a.m12 * b.m23 + a.m13;
+            result.m23 = a.m20 * b.m03 + a.m21 * b.m13 + a.m22 * b.m23 + a.m23;
+            return TaggedMatrix4D(result, Matrix4DKind::Affine);
+        }
+
+        // Affine * Affine: the last row is (0, 0, 0, 1) on both sides
+        return TaggedMatrix4D(Matrix4D(
+            a.m00 * b.m00 + a.m01 * b.m10 + a.m02 * b.m20,
+            a.m00 * b.m01 + a.m01 * b.m11 + a.m02 * b.m21,
+            a.m00 * b.m02 + a.m01 * b.m12 + a.m02 * b.m22,
+            a.m00 * b.m03 + a.m01 * b.m13 + a.m02 * b.m23 + a.m03,
+
+            a.m10 * b.m00 + a.m11 * b.m10 + a.m12 * b.m20,
+            a.m10 * b.m01 + a.m11 * b.m11 + a.m12 * b.m21,
+            a.m10 * b.m02 + a.m11 * b.m12 + a.m12 * b.m22,
+            a.m10 * b.m03 + a.m11 * b.m13 + a.m12 * b.m23 + a.m13,
+
+            a.m20 * b.m00 + a.m21 * b.m10 + a.m22 * b.m20,
+            a.m20 * b.m01 + a.m21 * b.m11 + a.m22 * b.m21,
+            a.m20 * b.m02 + a.m21 * b.m12 + a.m22 * b.m22,
+            a.m20 * b.m03 + a.m21 * b.m13 + a.m22 * b.m23 + a.m23,
+
+            0.0f, 0.0f, 0.0f, 1.0f
+        ), Matrix4DKind::Affine);
+    }
+
+    /**
+     * @brief Multiplies this matrix by another and assigns the result to this matrix.
+     *
+     * @param other The matrix to multiply with
+     * @return Reference to this matrix after multiplication
+     */
+    TaggedMatrix4D& operator*=(const TaggedMatrix4D& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    /**
+     * @brief Calculates the inverse, dispatching on the kind.
+     *
+     * Identity and translation matrices are inverted exactly without any division;
+     * affine matrices only invert their 3x3 block; projective matrices fall back to
+     * Matrix4D::Inverse.
+     *
+     * @return The tagged inverse matrix (same kind as this matrix)
+     * @throws std::runtime_error if the matrix is not invertible
+     */
+    [[nodiscard]] TaggedMatrix4D Inverse() const {
+        switch (kind) {
+            case Matrix4DKind::Identity:
+                return *this;
+
+            case Matrix4DKind::Translation:
+                return TaggedMatrix4D(Matrix4D::CreateTranslation(-matrix.m03, -matrix.m13, -matrix.m23),
+                                      Matrix4DKind::Translation);
+
+            case Matrix4DKind::Affine: {
+                const Matrix4D& m = matrix;
+
+                // Cofactors of the 3x3 block
+                float c00 = m.m11 * m.m22 - m.m12 * m.m21;
+                float c01 = m.m12 * m.m20 - m.m10 * m.m22;
+                float c02 = m.m10 * m.m21 - m.m11 * m.m20;
+
+                float det = m.m00 * c00 + m.m01 * c01 + m.m02 * c02;
+                if (std::fabs(det) < Constants::EPSILON) {
+                    throw std::runtime_error("Matrix is not invertible (determinant is zero)");
+                }
+                float invDet = 1.0f / det;
+
+                // Inverse of the 3x3 block (transposed cofactors / det)
+                float i00 = c00 * invDet;
+                float i01 = (m.m02 * m.m21 - m.m01 * m.m22) * invDet;
+                float i02 = (m.m01 * m.m12 - m.m02 * m.m11) * invDet;
+                float i10 = c01 * invDet;
+                float i11 = (m.m00 * m.m22 - m.m02 * m.m20) * invDet;
+                float i12 = (m.m02 * m.m10 - m.m00 * m.m12) * invDet;
+                float i20 = c02 * invDet;
+                float i21 = (m.m01 * m.m20 - m.m00 * m.m21) * invDet;
+                float i22 = (m.m00 * m.m11 - m.m01 * m.m10) * invDet;
+
+                // Inverse translation is -R^-1 * t
+                return TaggedMatrix4D(Matrix4D(
+                    i00, i01, i02, -(i00 * m.m03 + i01 * m.m13 + i02 * m.m23),
+                    i10, i11, i12, -(i10 * m.m03 + i11 * m.m13 + i12 * m.m23),
+                    i20, i21, i22, -(i20 * m.m03 + i21 * m.m13 + i22 * m.m23),
+                    0.0f, 0.0f, 0.0f, 1.0f
+                ), Matrix4DKind::Affine);
+            }
+
+            case Matrix4DKind::Projective:
+            default:
+                return TaggedMatrix4D(matrix.Inverse(), Matrix4DKind::Projective);
+        }
+    }
+
+    /**
+     * @brief Transforms a point (w=1), skipping the perspective divide for non-projective kinds.
+     *
+     * @param point The point to transform
+     * @return The transformed point
+     */
+    [[nodiscard]] Vector3D TransformPoint(const Vector3D& point) const {
+        switch (kind) {
+            case Matrix4DKind::Identity:
+                return point;
+
+            case Matrix4DKind::Translation:
+                return Vector3D(point.x + matrix.m03, point.y + matrix.m13, point.z + matrix.m23);
+
+            case Matrix4DKind::Affine:
+                return Vector3D(
+                    matrix.m00 * point.x + matrix.m01 * point.y + matrix.m02 * point.z + matrix.m03,
+                    matrix.m10 * point.x + matrix.m11 * point.y + matrix.m12 * point.z + matrix.m13,
+                    matrix.m20 * point.x + matrix.m21 * point.y + matrix.m22 * point.z + matrix.m23
+                );
+
+            case Matrix4DKind::Projective:
+            default:
+                return matrix.TransformPoint(point);
+        }
+    }
+
+    /**
+     * @brief Transforms a direction (w=0); translations leave it unchanged.
+     *
+     * @param vector The vector to transform
+     * @return The transformed vector
+     */
+    [[nodiscard]] Vector3D TransformVector(const Vector3D& vector) const {
+        if (kind == Matrix4DKind::Identity || kind == Matrix4DKind::Translation) {
+            return vector;
+        }
+        return matrix.TransformVector(vector);
+    }
+
+    /**
+     * @brief Checks whether the wrapped matrix equals another within a small epsilon.
+     *
+     * Only the matrices are compared; two equal matrices with different tags are equal.
+     *
+     * @param other The tagged matrix to compare with
+     * @return True if the matrices are approximately equal, false otherwise
+     */
+    bool operator==(const TaggedMatrix4D& other) const {
+        return matrix == other.matrix;
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The tagged matrix to compare with
+     * @return True if the matrices are not approximately equal, false otherwise
+     */
+    bool operator!=(const TaggedMatrix4D& other) const {
+        return !(*this == other);
+    }
+};
+
+} // namespace Math
+
+#endif // TAGGED_MATRIX4D_H
@@ -0,0 +1,212 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "Trace.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+namespace Math::Trace {
+
+    namespace {
+
+        struct ThreadBuffer {
+            RingBuffer events{ThreadBufferCapacity};
+            std::uint32_t threadId = 0;
+
+            /** Set when the recording thread exits; guarded by the registry mutex */
+            bool retired = false;
+        };
+
+        // Buffers of every live thread that recorded an event, plus retired buffers that still
+        // hold events; only locked when a thread records its first event or exits, and during export
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+            std::uint32_t nextThreadId = 1;
+
+            /** Dropped events of buffers removed from the registry */
+            std::size_t removedDropped = 0;
+        };
+
+        Registry& GetRegistry() {
+            static Registry registry;
+            return registry;
+        }
+
+        // Retires the thread's buffer when the thread exits, so a later thread can take it
+        // over or export can remove it once drained
+        struct ThreadBufferOwner {
+            std::shared_ptr<ThreadBuffer> buffer;
+
+            ThreadBufferOwner() {
+                Registry& registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (const std::shared_ptr<ThreadBuffer>& candidate : registry.buffers) {
+                    if (candidate->retired) {
+                        // The old producer has exited; the lock orders its writes before ours
+                        candidate->retired = false;
+                        buffer = candidate;
+                        return;
+                    }
+                }
+                buffer = std::make_shared<ThreadBuffer>();
+                buffer->threadId = registry.nextThreadId++;
+                registry.buffers.push_back(buffer);
+            }
+
+            ~ThreadBufferOwner() {
+                Registry& registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                buffer->retired = true;
+            }
+
+            ThreadBufferOwner(const ThreadBufferOwner&) = delete;
+            ThreadBufferOwner& operator=(const ThreadBufferOwner&) = delete;
+        };
+
+        ThreadBuffer& GetThreadBuffer() {
+            thread_local const ThreadBufferOwner owner;
+            return *owner.buffer;
+        }
+
+        void WriteEscaped(std::ostream& stream, const char* text) {
+            for (const char* c = text; *c != '\0'; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    stream << '\\';
+                }
+                stream << *c;
+            }
+        }
+
+    } // namespace
+
+    // RingBuffer
+
+    RingBuffer::RingBuffer(std::size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Ring buffer capacity must be positive");
+        }
+        std::size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+        m_Events = std::make_unique<Event[]>(rounded);
+        m_Mask = rounded - 1;
+    }
+
+    std::size_t RingBuffer::GetCapacity() const {
+        return m_Mask + 1;
+    }
+
+    bool RingBuffer::TryPush(const Event& event) {
+        const std::size_t head = m_Head.load(std::memory_order_relaxed);
+        const std::size_t tail = m_Tail.load(std::memory_order_acquire);
+        if (head - tail > m_Mask) {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_Events[head & m_Mask] = event;
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool RingBuffer::TryPop(Event& event) {
+        const std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const std::size_t head = m_Head.load(std::memory_order_acquire);
+        if (tail == head) {
+            return false;
+        }
+        event = m_Events[tail & m_Mask];
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool RingBuffer::IsEmpty() const {
+        return m_Tail.load(std::memory_order_relaxed) == m_Head.load(std::memory_order_acquire);
+    }
+
+    std::size_t RingBuffer::GetDroppedCount() const {
+        return m_Dropped.load(std::memory_order_relaxed);
+    }
+
+    // Recording
+
+    std::uint64_t Now() {
+        static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+    }
+
+    void Record(const char* name, std::uint64_t startNanoseconds, std::uint64_t durationNanoseconds) {
+        GetThreadBuffer().events.TryPush(Event{name, startNanoseconds, durationNanoseconds});
+    }
+
+    std::size_t GetDroppedEventCount() {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::size_t dropped = registry.removedDropped;
+        for (const std::shared_ptr<ThreadBuffer>& buffer : registry.buffers) {
+            dropped += buffer->events.GetDroppedCount();
+        }
+        return dropped;
+    }
+
+    // Export
+
+    void WriteChromeJson(std::ostream& stream) {
+        Registry& registry = GetRegistry();
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        std::size_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            buffers = registry.buffers;
+            dropped = registry.removedDropped;
+        }
+
+        // Timestamps and durations are in microseconds, written with nanosecond resolution
+        const std::ios_base::fmtflags flags = stream.flags();
+        const std::streamsize precision = stream.precision();
+        stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+        bool first = true;
+        for (const std::shared_ptr<ThreadBuffer>& buffer : buffers) {
+            Event event;
+            while (buffer->events.TryPop(event)) {
+                stream << (first ? "\n" : ",\n") << "{\"name\":\"";
+                WriteEscaped(stream, event.name);
+                stream << "\",\"ph\":\"X\",\"ts\":" << static_cast<double>(event.startNanoseconds) / 1000.0
+                       << ",\"dur\":" << static_cast<double>(event.durationNanoseconds) / 1000.0
+                       << ",\"pid\":1,\"tid\":" << buffer->threadId << "}";
+                first = false;
+            }
+            dropped += buffer->events.GetDroppedCount();
+        }
+        stream << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" << dropped << "}}\n";
+        stream.flags(flags);
+        stream.precision(precision);
+
+        // Retired buffers have no producer left, so once drained they can go
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::erase_if(registry.buffers, [&registry](const std::shared_ptr<ThreadBuffer>& buffer) {
+            if (!buffer->retired || !buffer->events.IsEmpty()) {
+                return false;
+            }
+            registry.removedDropped += buffer->events.GetDroppedCount();
+            return true;
+        });
+    }
+
+    void SaveChromeJson(const std::string& path) {
+        std::ofstream file(path);
+        WriteChromeJson(file);
+        if (!file) {
+            throw std::runtime_error("Cannot write trace file: " + path);
+        }
+    }
+
+} // namespace Math::Trace
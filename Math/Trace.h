@@ -0,0 +1,198 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+/**
+ * @file Trace.h
+ * @brief Scoped trace markers with per-thread buffering and Chrome trace export.
+ *
+ * The library marks its batch operations and hierarchy updates with MATH_TRACE_SCOPE.
+ * The markers are compiled in only when MATHENGINE_ENABLE_TRACING is defined (CMake option
+ * of the same name); otherwise the macro expands to nothing and costs nothing. In a tracing
+ * build, markers still do nothing but one relaxed atomic load until Trace::SetEnabled(true)
+ * is called.
+ *
+ * Every thread writes completed scopes into its own lock-free single-producer ring buffer,
+ * so recording never takes a lock. Trace::WriteChromeJson drains all buffers into the Chrome
+ * trace event format, which chrome://tracing and Perfetto open directly.
+ */
+
+#if defined(MATHENGINE_ENABLE_TRACING)
+#define MATH_TRACE_CONCAT_INNER(a, b) a##b
+#define MATH_TRACE_CONCAT(a, b) MATH_TRACE_CONCAT_INNER(a, b)
+/** Records the enclosing scope under a name with static storage duration (e.g. a string literal) */
+#define MATH_TRACE_SCOPE(name) const ::Math::Trace::ScopedEvent MATH_TRACE_CONCAT(mathTraceScope, __LINE__)(name)
+#else
+#define MATH_TRACE_SCOPE(name) ((void)0)
+#endif
+
+namespace Math::Trace {
+
+    /**
+     * @brief A completed scope.
+     */
+    struct Event {
+        /** Scope name; must outlive the trace */
+        const char* name = nullptr;
+
+        /** Start time in nanoseconds since the first trace timestamp of the process */
+        std::uint64_t startNanoseconds = 0;
+
+        std::uint64_t durationNanoseconds = 0;
+    };
+
+    /**
+     * @class RingBuffer
+     * @brief Fixed-capacity lock-free queue with one producer thread and one consumer thread.
+     *
+     * When the buffer is full new events are dropped and counted rather than overwriting
+     * events the consumer has not read yet.
+     */
+    class RingBuffer {
+    private:
+        std::unique_ptr<Event[]> m_Events;
+        std::size_t m_Mask;
+
+        /** Next slot to write; only advanced by the producer */
+        alignas(64) std::atomic<std::size_t> m_Head{0};
+
+        /** Next slot to read; only advanced by the consumer */
+        alignas(64) std::atomic<std::size_t> m_Tail{0};
+
+        alignas(64) std::atomic<std::size_t> m_Dropped{0};
+
+    public:
+        /**
+         * @brief Creates an empty buffer.
+         * @param capacity Minimum number of events; rounded up to a power of two
+         * @throws std::invalid_argument if capacity is 0
+         */
+        explicit RingBuffer(std::size_t capacity);
+
+        RingBuffer(const RingBuffer&) = delete;
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        /**
+         * @brief Gets the number of events the buffer holds.
+         */
+        [[nodiscard]] std::size_t GetCapacity() const;
+
+        /**
+         * @brief Appends an event. Producer thread only.
+         * @return false if the buffer was full and the event was dropped
+         */
+        bool TryPush(const Event& event);
+
+        /**
+         * @brief Removes the oldest event. Consumer thread only.
+         * @return false if the buffer was empty
+         */
+        bool TryPop(Event& event);
+
+        /**
+         * @brief Checks whether every pushed event has been popped. Consumer thread only.
+         */
+        [[nodiscard]] bool IsEmpty() const;
+
+        /**
+         * @brief Gets the number of events dropped because the buffer was full.
+         */
+        [[nodiscard]] std::size_t GetDroppedCount() const;
+    };
+
+    /** Events buffered per thread before new events are dropped */
+    inline constexpr std::size_t ThreadBufferCapacity = 16384;
+
+    namespace Detail {
+        inline std::atomic<bool> Enabled{false};
+    }
+
+    /**
+     * @brief Turns recording on or off for all threads. Off by default.
+     */
+    inline void SetEnabled(bool enabled) {
+        Detail::Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether recording is on.
+     */
+    [[nodiscard]] inline bool IsEnabled() {
+        return Detail::Enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the current trace timestamp in nanoseconds.
+     */
+    [[nodiscard]] std::uint64_t Now();
+
+    /**
+     * @brief Appends a completed scope to the calling thread's buffer.
+     *
+     * The buffer is created on the first call from each thread and outlives the thread, so
+     * events of finished worker threads can still be exported. Once its thread has exited,
+     * the buffer is taken over (with its thread id) by the next thread that starts recording,
+     * or removed by the export that drains it, so short-lived threads do not pile up buffers.
+     */
+    void Record(const char* name, std::uint64_t startNanoseconds, std::uint64_t durationNanoseconds);
+
+    /**
+     * @brief Gets the number of events dropped because a thread's buffer was full.
+     */
+    [[nodiscard]] std::size_t GetDroppedEventCount();
+
+    /**
+     * @brief Drains every thread buffer and writes the events as Chrome trace JSON.
+     *
+     * Must not be called from more than one thread at a time.
+     */
+    void WriteChromeJson(std::ostream& stream);
+
+    /**
+     * @brief Drains every thread buffer into a Chrome trace JSON file.
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void SaveChromeJson(const std::string& path);
+
+    /**
+     * @class ScopedEvent
+     * @brief Records the time between its construction and destruction, if recording is on.
+     *
+     * Usually created through MATH_TRACE_SCOPE.
+     */
+    class ScopedEvent {
+    private:
+        const char* m_Name;
+        std::uint64_t m_Start = 0;
+        bool m_Active;
+
+    public:
+        explicit ScopedEvent(const char* name) : m_Name(name), m_Active(IsEnabled()) {
+            if (m_Active) {
+                m_Start = Now();
+            }
+        }
+
+        ~ScopedEvent() {
+            if (m_Active) {
+                Record(m_Name, m_Start, Now() - m_Start);
+            }
+        }
+
+        ScopedEvent(const ScopedEvent&) = delete;
+        ScopedEvent& operator=(const ScopedEvent&) = delete;
+    };
+
+} // namespace Math::Trace
+
+#endif // TRACE_H
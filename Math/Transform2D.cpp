@@ -4,28 +4,55 @@
 
 #include "Transform2D.h"
 #include "Constants.h"
+#include "ScalarMath.h"
+#include "Trace.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <stdexcept>
 
 namespace Math {
 
-    // Private helper to update the transformation matrix
-    void Transform2D::UpdateMatrix() const {
-        if (m_IsDirty) {
-            // Create rotation matrix
-            float cosTheta = std::cos(m_Rotation);
-            float sinTheta = std::sin(m_Rotation);
-
-            // Build transformation matrix (scale, then rotate, then translate)
+    // Private helper to rebuild the transformation matrix
+    void Transform2D::UpdateMatrix() {
+        if (!HasAnyFlag(m_Flags, TransformFlags::Rotation)) {
+            // Axis-aligned: no trigonometry needed
             m_LocalMatrix = Matrix3D(
-                m_Scale.x * cosTheta, -m_Scale.y * sinTheta, m_Position.x,
-                m_Scale.x * sinTheta,  m_Scale.y * cosTheta, m_Position.y,
-                0.0f,                  0.0f,                 1.0f
+                m_Scale.x, 0.0f,      m_Position.x,
+                0.0f,      m_Scale.y, m_Position.y,
+                0.0f,      0.0f,      1.0f
             );
+            return;
+        }
+
+        // Create rotation matrix
+        float sinTheta, cosTheta;
+        Math::SinCos(m_Rotation, sinTheta, cosTheta);
+
+        // Build transformation matrix (scale, then rotate, then translate)
+        m_LocalMatrix = Matrix3D(
+            m_Scale.x * cosTheta, -m_Scale.y * sinTheta, m_Position.x,
+            m_Scale.x * sinTheta,  m_Scale.y * cosTheta, m_Position.y,
+            0.0f,                  0.0f,                 1.0f
+        );
+    }
 
-            m_IsDirty = false;
+    // Private helper to classify the components
+    void Transform2D::UpdateFlags() {
+        TransformFlags flags = TransformFlags::None;
+        if (m_Position.x != 0.0f || m_Position.y != 0.0f) {
+            flags = flags | TransformFlags::Translation;
+        }
+        if (m_Rotation != 0.0f) {
+            flags = flags | TransformFlags::Rotation;
+        }
+        if (m_Scale.x != 1.0f || m_Scale.y != 1.0f) {
+            flags = flags | TransformFlags::Scale;
         }
+        if (m_Scale.x != m_Scale.y) {
+            flags = flags | TransformFlags::NonUniformScale;
+        }
+        m_Flags = flags;
     }
 
     // Default constructor - creates identity transform
@@ -33,9 +60,11 @@ namespace Math {
         : m_Position(0.0f, 0.0f),
           m_Rotation(0.0f),
           m_Scale(1.0f, 1.0f),
-          m_IsDirty(true),
+          m_Flags(TransformFlags::None),
           m_Parent(nullptr)
     {
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     // Parameterized constructor with position, rotation, and scale
@@ -43,9 +72,11 @@ namespace Math {
         : m_Position(position),
           m_Rotation(rotation),
           m_Scale(scale),
-          m_IsDirty(true),
+          m_Flags(TransformFlags::None),
           m_Parent(nullptr)
     {
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     // Parameterized constructor with uniform scale
@@ -53,9 +84,11 @@ namespace Math {
         : m_Position(position),
           m_Rotation(rotation),
           m_Scale(uniformScale, uniformScale),
-          m_IsDirty(true),
+          m_Flags(TransformFlags::None),
           m_Parent(nullptr)
     {
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     // Static factory methods
@@ -110,27 +143,33 @@ namespace Math {
 
     void Transform2D::SetPosition(const Vector2D& position) {
         m_Position = position;
-        m_IsDirty = true;
+        UpdateFlags();
+        m_LocalMatrix.m02 = m_Position.x;
+        m_LocalMatrix.m12 = m_Position.y;
     }
 
     void Transform2D::SetRotationRad(float radians) {
         m_Rotation = radians;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::SetRotationDeg(float degrees) {
         m_Rotation = degrees * Constants::DEG_TO_RAD;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::SetScale(const Vector2D& scale) {
         m_Scale = scale;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::SetScale(float uniformScale) {
         m_Scale.x = m_Scale.y = uniformScale;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::SetParent(Transform2D* parent) {
@@ -161,52 +200,171 @@ namespace Math {
 
     void Transform2D::Translate(const Vector2D& translation) {
         m_Position += translation;
-        m_IsDirty = true;
+        UpdateFlags();
+        m_LocalMatrix.m02 = m_Position.x;
+        m_LocalMatrix.m12 = m_Position.y;
     }
 
     void Transform2D::RotateRad(float radians) {
         m_Rotation += radians;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::RotateDeg(float degrees) {
         m_Rotation += degrees * Constants::DEG_TO_RAD;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::Scale(const Vector2D& scale) {
         m_Scale.x *= scale.x;
         m_Scale.y *= scale.y;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     void Transform2D::Scale(float uniformScale) {
         m_Scale.x *= uniformScale;
         m_Scale.y *= uniformScale;
-        m_IsDirty = true;
+        UpdateFlags();
+        UpdateMatrix();
     }
 
     Vector2D Transform2D::TransformPoint(const Vector2D& point) const {
+        if (m_Parent == nullptr && !HasAnyFlag(m_Flags, TransformFlags::Rotation | TransformFlags::Scale)) {
+            // Translation-only (or identity) transform
+            return point + m_Position;
+        }
+
         Matrix3D worldMatrix = GetWorldMatrix();
 
         // Convert point to homogeneous coordinates, multiply by matrix, then convert back
         return Vector2D(
-            worldMatrix(0, 0) * point.x + worldMatrix(0, 1) * point.y + worldMatrix(0, 2),
-            worldMatrix(1, 0) * point.x + worldMatrix(1, 1) * point.y + worldMatrix(1, 2)
+            worldMatrix.m00 * point.x + worldMatrix.m01 * point.y + worldMatrix.m02,
+            worldMatrix.m10 * point.x + worldMatrix.m11 * point.y + worldMatrix.m12
         );
     }
 
 
     Vector2D Transform2D::TransformVector(const Vector2D& vector) const {
+        if (!HasAnyFlag(GetWorldFlags(), TransformFlags::Rotation | TransformFlags::Scale)) {
+            // Translations do not affect vectors
+            return vector;
+        }
+
         Matrix3D worldMatrix = GetWorldMatrix();
 
         // For vectors, we ignore translation (last column)
         return Vector2D(
-            worldMatrix(0, 0) * vector.x + worldMatrix(0, 1) * vector.y,
-            worldMatrix(1, 0) * vector.x + worldMatrix(1, 1) * vector.y
+            worldMatrix.m00 * vector.x + worldMatrix.m01 * vector.y,
+            worldMatrix.m10 * vector.x + worldMatrix.m11 * vector.y
         );
     }
 
+    void Transform2D::TransformPoints(std::span<const Vector2D> points, std::span<Vector2D> outPoints) const {
+        MATH_TRACE_SCOPE("Transform2D::TransformPoints");
+        if (points.size() != outPoints.size()) {
+            throw std::invalid_argument("Input and output spans must have the same size");
+        }
+
+        // Resolve the hierarchy once and keep the affine part in registers for the loop
+        const Matrix3D worldMatrix = GetWorldMatrix();
+        const float a = worldMatrix.m00, b = worldMatrix.m01, tx = worldMatrix.m02;
+        const float c = worldMatrix.m10, d = worldMatrix.m11, ty = worldMatrix.m12;
+
+        const std::size_t count = points.size();
+        if (!HasAnyFlag(GetWorldFlags(), TransformFlags::Rotation | TransformFlags::Scale)) {
+            const Vector2D translation(tx, ty);
+            for (std::size_t i = 0; i < count; ++i) {
+                outPoints[i] = points[i] + translation;
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x = points[i].x;
+            const float y = points[i].y;
+            outPoints[i] = Vector2D(a * x + b * y + tx, c * x + d * y + ty);
+        }
+    }
+
+    void Transform2D::TransformPoints(std::span<const float> xs, std::span<const float> ys,
+                                      std::span<float> outXs, std::span<float> outYs) const {
+        MATH_TRACE_SCOPE("Transform2D::TransformPoints (SoA)");
+        if (xs.size() != ys.size() || xs.size() != outXs.size() || xs.size() != outYs.size()) {
+            throw std::invalid_argument("Input and output spans must have the same size");
+        }
+
+        const Matrix3D worldMatrix = GetWorldMatrix();
+        const float a = worldMatrix.m00, b = worldMatrix.m01, tx = worldMatrix.m02;
+        const float c = worldMatrix.m10, d = worldMatrix.m11, ty = worldMatrix.m12;
+
+        const float* inX = xs.data();
+        const float* inY = ys.data();
+        float* outX = outXs.data();
+        float* outY = outYs.data();
+
+        const std::size_t count = xs.size();
+        if (!HasAnyFlag(GetWorldFlags(), TransformFlags::Rotation | TransformFlags::Scale)) {
+            for (std::size_t i = 0; i < count; ++i) {
+                outX[i] = inX[i] + tx;
+                outY[i] = inY[i] + ty;
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x = inX[i];
+            const float y = inY[i];
+            outX[i] = a * x + b * y + tx;
+            outY[i] = c * x + d * y + ty;
+        }
+    }
+
+    void Transform2D::TransformVectors(std::span<const Vector2D> vectors, std::span<Vector2D> outVectors) const {
+        MATH_TRACE_SCOPE("Transform2D::TransformVectors");
+        if (vectors.size() != outVectors.size()) {
+            throw std::invalid_argument("Input and output spans must have the same size");
+        }
+
+        const Matrix3D worldMatrix = GetWorldMatrix();
+        const float a = worldMatrix.m00, b = worldMatrix.m01;
+        const float c = worldMatrix.m10, d = worldMatrix.m11;
+
+        const std::size_t count = vectors.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x = vectors[i].x;
+            const float y = vectors[i].y;
+            outVectors[i] = Vector2D(a * x + b * y, c * x + d * y);
+        }
+    }
+
+    void Transform2D::TransformVectors(std::span<const float> xs, std::span<const float> ys,
+                                       std::span<float> outXs, std::span<float> outYs) const {
+        MATH_TRACE_SCOPE("Transform2D::TransformVectors (SoA)");
+        if (xs.size() != ys.size() || xs.size() != outXs.size() || xs.size() != outYs.size()) {
+            throw std::invalid_argument("Input and output spans must have the same size");
+        }
+
+        const Matrix3D worldMatrix = GetWorldMatrix();
+        const float a = worldMatrix.m00, b = worldMatrix.m01;
+        const float c = worldMatrix.m10, d = worldMatrix.m11;
+
+        const float* inX = xs.data();
+        const float* inY = ys.data();
+        float* outX = outXs.data();
+        float* outY = outYs.data();
+
+        const std::size_t count = xs.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x = inX[i];
+            const float y = inY[i];
+            outX[i] = a * x + b * y;
+            outY[i] = c * x + d * y;
+        }
+    }
+
 
     Vector2D Transform2D::TransformDirection(const Vector2D& direction) const {
         // Direction vectors are transformed the same way as regular vectors
@@ -235,26 +393,30 @@ namespace Math {
         // - Inverse rotation = -R (negative of original rotation)
         // - Inverse scale = 1/S (reciprocal of original scale)
 
-        float invRotation = -m_Rotation;
         Vector2D invScale(1.0f / m_Scale.x, 1.0f / m_Scale.y);
+        Transform2D inverse;
 
-        // Calculate the inverse position
-        float cosTheta = std::cos(invRotation);
-        float sinTheta = std::sin(invRotation);
+        if (!HasAnyFlag(m_Flags, TransformFlags::Rotation)) {
+            // Axis-aligned: R is the identity, so no trigonometry is needed
+            inverse = Transform2D(Vector2D(-m_Position.x * invScale.x, -m_Position.y * invScale.y), 0.0f, invScale);
+        } else {
+            float invRotation = -m_Rotation;
 
-        Vector2D invPosition(
-            -(cosTheta * m_Position.x - sinTheta * m_Position.y) * invScale.x,
-            -(sinTheta * m_Position.x + cosTheta * m_Position.y) * invScale.y
-        );
+            // Calculate the inverse position
+            float sinTheta, cosTheta;
+            Math::SinCos(invRotation, sinTheta, cosTheta);
 
-        // Create the inverse transform
-        Transform2D inverse(invPosition, invRotation, invScale);
+            Vector2D invPosition(
+                -(cosTheta * m_Position.x - sinTheta * m_Position.y) * invScale.x,
+                -(sinTheta * m_Position.x + cosTheta * m_Position.y) * invScale.y
+            );
+
+            // Create the inverse transform
+            inverse = Transform2D(invPosition, invRotation, invScale);
+        }
 
         // If there's a parent, we need to get the world transform's inverse
         if (m_Parent) {
-            // First get our world transform
-            Matrix3D worldMatrix = GetWorldMatrix();
-
             // For proper handling with parents, we should invert the world matrix
             // This is a simplified approach; a proper implementation would invert the full matrix
             Transform2D parentInverse = m_Parent->Inverse();
@@ -265,6 +427,32 @@ namespace Math {
     }
 
     Transform2D Transform2D::Compose(const Transform2D& other) const {
+        constexpr TransformFlags linearFlags = TransformFlags::Rotation | TransformFlags::Scale;
+
+        if (!HasAnyFlag(m_Flags, linearFlags)) {
+            // This is a pure translation: it only offsets the other transform
+            return Transform2D(other.m_Position + m_Position, other.m_Rotation, other.m_Scale);
+        }
+
+        if (!HasAnyFlag(other.m_Flags, linearFlags)) {
+            // The other is a pure translation: move our origin along our own axes
+            Matrix3D thisMat = GetLocalMatrix();
+            Vector2D position(
+                thisMat.m00 * other.m_Position.x + thisMat.m01 * other.m_Position.y + thisMat.m02,
+                thisMat.m10 * other.m_Position.x + thisMat.m11 * other.m_Position.y + thisMat.m12
+            );
+            return Transform2D(position, m_Rotation, m_Scale);
+        }
+
+        if (!HasAnyFlag(m_Flags | other.m_Flags, TransformFlags::Rotation)) {
+            // Both axis-aligned: scales multiply, no decomposition needed
+            Vector2D position(
+                m_Scale.x * other.m_Position.x + m_Position.x,
+                m_Scale.y * other.m_Position.y + m_Position.y
+            );
+            return Transform2D(position, 0.0f, Vector2D(m_Scale.x * other.m_Scale.x, m_Scale.y * other.m_Scale.y));
+        }
+
         // Get matrices for both transforms
         Matrix3D thisMat = GetLocalMatrix();
         Matrix3D otherMat = other.GetLocalMatrix();
@@ -284,7 +472,7 @@ namespace Math {
 
 
         // Extract rotation (atan2 of the normalized first column)
-        float rotation = std::atan2(resultMat(1, 0) / scaleX, resultMat(0, 0) / scaleX);
+        float rotation = Math::Atan2(resultMat(1, 0) / scaleX, resultMat(0, 0) / scaleX);
 
         return Transform2D(position, rotation, Vector2D(scaleX, scaleY));
     }
@@ -299,11 +487,14 @@ namespace Math {
     }
 
     Matrix3D Transform2D::GetLocalMatrix() const {
-        UpdateMatrix(); // Update matrix if needed
         return m_LocalMatrix;
     }
 
     Matrix3D Transform2D::GetWorldMatrix() const {
+        if (m_Parent && m_Flags == TransformFlags::None) {
+            // An identity child simply inherits its parent's world matrix
+            return m_Parent->GetWorldMatrix();
+        }
         if (m_Parent) {
             // If there's a parent, we need to multiply our local matrix by the parent's world matrix
             return m_Parent->GetWorldMatrix() * GetLocalMatrix();
@@ -322,6 +513,18 @@ namespace Math {
         );
     }
 
+    TransformFlags Transform2D::GetFlags() const {
+        return m_Flags;
+    }
+
+    TransformFlags Transform2D::GetWorldFlags() const {
+        TransformFlags flags = m_Flags;
+        for (const Transform2D* parent = m_Parent; parent != nullptr; parent = parent->m_Parent) {
+            flags = flags | parent->m_Flags;
+        }
+        return flags;
+    }
+
     // Utilities
 
     bool Transform2D::IsIdentity(float epsilon) const {
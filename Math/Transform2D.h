@@ -6,12 +6,59 @@
 #define TRANSFORM2D_H
 
 #include <cmath>
+#include <cstdint>
+#include <span>
 #include "Vector2D.h"
 #include "Matrix2D.h"
 #include "Matrix3D.h"
 
 namespace Math {
 
+    /**
+     * @brief Bit flags classifying which components of a transform differ from identity.
+     *
+     * A transform with no flags set is exactly the identity. Transform2D keeps its flags
+     * up to date in every setter, so operations can dispatch to a cheaper path
+     * (translation-only, axis-aligned scale, ...) without re-examining the components.
+     * The classification uses exact comparisons: a rotation of 1e-9 radians is still a rotation.
+     */
+    enum class TransformFlags : std::uint8_t {
+        /** No component differs from identity */
+        None = 0,
+        /** The position is not (0, 0) */
+        Translation = 1 << 0,
+        /** The rotation is not 0 */
+        Rotation = 1 << 1,
+        /** The scale is not (1, 1) */
+        Scale = 1 << 2,
+        /** The x and y scales differ */
+        NonUniformScale = 1 << 3
+    };
+
+    /**
+     * @brief Combines two sets of transform flags.
+     */
+    constexpr TransformFlags operator|(TransformFlags a, TransformFlags b) {
+        return static_cast<TransformFlags>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+    }
+
+    /**
+     * @brief Intersects two sets of transform flags.
+     */
+    constexpr TransformFlags operator&(TransformFlags a, TransformFlags b) {
+        return static_cast<TransformFlags>(static_cast<std::uint8_t>(a) & static_cast<std::uint8_t>(b));
+    }
+
+    /**
+     * @brief Checks whether any of the given flags are set.
+     * @param flags The flags to test
+     * @param mask The flags to look for
+     * @return true if at least one flag of mask is set in flags
+     */
+    constexpr bool HasAnyFlag(TransformFlags flags, TransformFlags mask) {
+        return (flags & mask) != TransformFlags::None;
+    }
+
     /**
      * @class Transform2D
      * @brief Represents a 2D transformation with position, rotation, and scale.
@@ -24,6 +71,16 @@ namespace Math {
      * It provides methods for transforming points and vectors between spaces,
      * composing transformations, and converting to/from matrices.
      * It also supports parent-child hierarchies for nested transformations.
+     *
+     * Each transform carries TransformFlags describing which components are non-identity;
+     * matrix updates, composition, inversion and point transformation use them to skip
+     * work (e.g. no trigonometry for unrotated transforms, plain additions for translations).
+     *
+     * The local matrix is updated eagerly by the setters rather than lazily on first read,
+     * so const member functions never write to the object. Any number of threads may
+     * therefore read the same transforms (including whole parent chains through
+     * GetWorldMatrix) concurrently without locking, as long as no thread modifies them
+     * at the same time. Position-only setters just patch the translation column.
      */
     class Transform2D {
     private:
@@ -36,20 +93,25 @@ namespace Math {
         /** The scale component (x and y scales) */
         Vector2D m_Scale;
 
-        /** Cached local transformation matrix */
-        mutable Matrix3D m_LocalMatrix;
+        /** Local transformation matrix, kept in sync with the components by every setter */
+        Matrix3D m_LocalMatrix;
 
-        /** Flag indicating whether the cached matrix needs updating */
-        mutable bool m_IsDirty;
+        /** Classification of the non-identity components, maintained by the setters */
+        TransformFlags m_Flags;
 
         /** Pointer to parent transform (optional for hierarchy) */
         Transform2D* m_Parent;
 
     private:
         /**
-         * @brief Updates the internal transformation matrix if it's marked as dirty.
+         * @brief Rebuilds the local transformation matrix from position, rotation and scale.
+         */
+        void UpdateMatrix();
+
+        /**
+         * @brief Recomputes the classification flags from the current components.
          */
-        void UpdateMatrix() const;
+        void UpdateFlags();
 
     public:
         /**
@@ -248,6 +310,53 @@ namespace Math {
          */
         Vector2D TransformDirection(const Vector2D& direction) const;
 
+        /**
+         * @brief Transforms an array of points from local space to this transform's space.
+         *
+         * The world matrix is resolved once for the whole batch, so the parent chain is
+         * walked a single time regardless of the number of points. The output may alias
+         * the input for in-place transformation.
+         *
+         * @param points The points in local space
+         * @param outPoints Destination for the transformed points (same size as points)
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        void TransformPoints(std::span<const Vector2D> points, std::span<Vector2D> outPoints) const;
+
+        /**
+         * @brief Transforms points stored as separate x and y arrays (structure of arrays).
+         *
+         * @param xs X coordinates of the points in local space
+         * @param ys Y coordinates of the points in local space
+         * @param outXs Destination for the transformed x coordinates
+         * @param outYs Destination for the transformed y coordinates
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        void TransformPoints(std::span<const float> xs, std::span<const float> ys,
+                             std::span<float> outXs, std::span<float> outYs) const;
+
+        /**
+         * @brief Transforms an array of vectors from local space to this transform's space.
+         * Vectors are not affected by translation, only rotation and scale.
+         *
+         * @param vectors The vectors in local space
+         * @param outVectors Destination for the transformed vectors (same size as vectors)
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        void TransformVectors(std::span<const Vector2D> vectors, std::span<Vector2D> outVectors) const;
+
+        /**
+         * @brief Transforms vectors stored as separate x and y arrays (structure of arrays).
+         *
+         * @param xs X components of the vectors in local space
+         * @param ys Y components of the vectors in local space
+         * @param outXs Destination for the transformed x components
+         * @param outYs Destination for the transformed y components
+         * @throws std::invalid_argument if the spans differ in size
+         */
+        void TransformVectors(std::span<const float> xs, std::span<const float> ys,
+                              std::span<float> outXs, std::span<float> outYs) const;
+
         /**
          * @brief Transforms a point from this transform's space back to local space.
          * @param point The point in this transform's space
@@ -307,6 +416,22 @@ namespace Math {
          */
         Matrix2D ToMatrix2D() const;
 
+        /**
+         * @brief Gets the classification flags of this transform (excluding parent).
+         * @return Flags describing which local components differ from identity
+         */
+        TransformFlags GetFlags() const;
+
+        /**
+         * @brief Gets the classification flags of the world transform (including parents).
+         *
+         * The result is the union of the flags along the parent chain, which is a
+         * conservative classification of the world matrix.
+         *
+         * @return Flags describing which world components may differ from identity
+         */
+        TransformFlags GetWorldFlags() const;
+
         // Utilities
 
         /**
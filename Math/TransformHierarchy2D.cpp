@@ -0,0 +1,567 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "TransformHierarchy2D.h"
+#include "ScalarMath.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        // Builds a TRS matrix (scale, then rotate, then translate), skipping trigonometry when unrotated
+        Matrix3D BuildLocalMatrix(const Vector2D& position, float rotation, const Vector2D& scale) {
+            if (rotation == 0.0f) {
+                return Matrix3D(
+                    scale.x, 0.0f,    position.x,
+                    0.0f,    scale.y, position.y,
+                    0.0f,    0.0f,    1.0f
+                );
+            }
+
+            float sinTheta, cosTheta;
+            Math::SinCos(rotation, sinTheta, cosTheta);
+            return Matrix3D(
+                scale.x * cosTheta, -scale.y * sinTheta, position.x,
+                scale.x * sinTheta,  scale.y * cosTheta, position.y,
+                0.0f,                0.0f,               1.0f
+            );
+        }
+
+        // Inverts a matrix whose last row is (0, 0, 1)
+        Matrix3D InverseAffine(const Matrix3D& matrix) {
+            const float det = matrix.m00 * matrix.m11 - matrix.m01 * matrix.m10;
+            if (det == 0.0f) {
+                throw std::runtime_error("Cannot preserve the world transform under a parent with zero scale");
+            }
+            const float invDet = 1.0f / det;
+            const float i00 = matrix.m11 * invDet;
+            const float i01 = -matrix.m01 * invDet;
+            const float i10 = -matrix.m10 * invDet;
+            const float i11 = matrix.m00 * invDet;
+            return Matrix3D(
+                i00,  i01,  -(i00 * matrix.m02 + i01 * matrix.m12),
+                i10,  i11,  -(i10 * matrix.m02 + i11 * matrix.m12),
+                0.0f, 0.0f, 1.0f
+            );
+        }
+
+        // Splits a TRS matrix into position, rotation and scale; a reflection goes into scale.y
+        void DecomposeLocalMatrix(const Matrix3D& matrix, Vector2D& position, float& rotation, Vector2D& scale) {
+            position = Vector2D(matrix.m02, matrix.m12);
+            scale.x = std::sqrt(matrix.m00 * matrix.m00 + matrix.m10 * matrix.m10);
+            scale.y = std::sqrt(matrix.m01 * matrix.m01 + matrix.m11 * matrix.m11);
+            if (matrix.m00 * matrix.m11 - matrix.m01 * matrix.m10 < 0.0f) {
+                scale.y = -scale.y;
+            }
+            rotation = Math::Atan2(matrix.m10, matrix.m00);
+        }
+
+        // Reorders values[first, end) so that values[first + i] = old values[order[i]]
+        template <typename T>
+        void ApplyOrder(std::vector<T>& values, const std::vector<std::uint32_t>& order, std::uint32_t first) {
+            std::vector<T> reordered;
+            reordered.reserve(order.size());
+            for (std::uint32_t oldIndex : order) {
+                reordered.push_back(values[oldIndex]);
+            }
+            std::copy(reordered.begin(), reordered.end(), values.begin() + first);
+        }
+
+    } // namespace
+
+    std::uint32_t TransformHierarchy2D::IndexOf(Transform2DHandle handle) const {
+        if (!handle.IsValid() || handle.id >= m_HandleToIndex.size() ||
+            m_HandleToIndex[handle.id] == InvalidIndex) {
+            throw std::invalid_argument("Transform handle is not part of this hierarchy");
+        }
+        return m_HandleToIndex[handle.id];
+    }
+
+    bool TransformHierarchy2D::WouldCreateCycle(std::uint32_t index, std::uint32_t parentIndex) const {
+        for (std::uint32_t ancestor = parentIndex; ancestor != InvalidIndex; ancestor = m_Parents[ancestor]) {
+            if (ancestor == index) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TransformHierarchy2D::MarkLocalDirty(std::uint32_t index) {
+        // An edit must not clear Overdue, or a transform edited every frame could be deferred forever
+        m_LocalDirty[index] = std::max(m_LocalDirty[index], std::uint8_t{1});
+    }
+
+    void TransformHierarchy2D::RebuildLocalMatrix(std::uint32_t index) {
+        m_LocalMatrices[index] = BuildLocalMatrix(m_Positions[index], m_Rotations[index], m_Scales[index]);
+    }
+
+    Matrix3D TransformHierarchy2D::ComputeWorldMatrix(std::uint32_t index) const {
+        // Local matrices are only rebuilt by an update, so dirty ones come from the hot data
+        auto localOf = [this](std::uint32_t i) {
+            return m_LocalDirty[i] != 0 ? BuildLocalMatrix(m_Positions[i], m_Rotations[i], m_Scales[i]) : m_LocalMatrices[i];
+        };
+        Matrix3D world = localOf(index);
+        for (std::uint32_t ancestor = m_Parents[index]; ancestor != InvalidIndex; ancestor = m_Parents[ancestor]) {
+            world = localOf(ancestor) * world;
+        }
+        return world;
+    }
+
+    void TransformHierarchy2D::InheritSchedules(std::span<const Transform2DReparent> operations) {
+        const std::uint32_t count = static_cast<std::uint32_t>(m_Positions.size());
+        std::uint32_t first = count;
+        for (const Transform2DReparent& operation : operations) {
+            first = std::min(first, IndexOf(operation.child));
+        }
+        if (first >= count) {
+            return;
+        }
+
+        // Descendants follow their ancestors in dense storage, so parents are final before their children
+        std::vector<std::uint8_t> inSubtree(count - first, 0);
+        for (const Transform2DReparent& operation : operations) {
+            inSubtree[IndexOf(operation.child) - first] = 1;
+        }
+        for (std::uint32_t i = first; i < count; ++i) {
+            const std::uint32_t parent = m_Parents[i];
+            if (inSubtree[i - first] || (parent != InvalidIndex && parent >= first && inSubtree[parent - first])) {
+                inSubtree[i - first] = 1;
+                m_Schedules[i] = parent == InvalidIndex ? UpdateSchedule() : m_Schedules[parent];
+            }
+        }
+    }
+
+    void TransformHierarchy2D::Reorder(std::uint32_t first) {
+        MATH_TRACE_SCOPE("TransformHierarchy2D::Reorder");
+        const std::uint32_t count = static_cast<std::uint32_t>(m_Positions.size());
+        if (first >= count) {
+            return;
+        }
+
+        // Emit every entry after its unplaced ancestors, keeping the existing order otherwise
+        std::vector<std::uint32_t> order;
+        order.reserve(count - first);
+        std::vector<std::uint8_t> placed(count - first, 0);
+        std::vector<std::uint32_t> chain;
+
+        for (std::uint32_t i = first; i < count; ++i) {
+            chain.clear();
+            std::uint32_t node = i;
+            while (node != InvalidIndex && node >= first && !placed[node - first]) {
+                if (chain.size() > count - first) {
+                    throw std::logic_error("Transform hierarchy contains a cycle");
+                }
+                chain.push_back(node);
+                node = m_Parents[node];
+            }
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+                placed[*it - first] = 1;
+                order.push_back(*it);
+            }
+        }
+
+        // Map old dense indices to new ones
+        std::vector<std::uint32_t> newIndexOf(count - first);
+        for (std::uint32_t i = 0; i < order.size(); ++i) {
+            newIndexOf[order[i] - first] = first + i;
+        }
+
+        ApplyOrder(m_Positions, order, first);
+        ApplyOrder(m_Rotations, order, first);
+        ApplyOrder(m_Scales, order, first);
+        ApplyOrder(m_LocalMatrices, order, first);
+        ApplyOrder(m_WorldMatrices, order, first);
+        ApplyOrder(m_Parents, order, first);
+        ApplyOrder(m_LocalDirty, order, first);
+        ApplyOrder(m_Schedules, order, first);
+        ApplyOrder(m_IndexToHandle, order, first);
+
+        for (std::uint32_t i = first; i < count; ++i) {
+            std::uint32_t& parent = m_Parents[i];
+            if (parent != InvalidIndex && parent >= first) {
+                parent = newIndexOf[parent - first];
+            }
+            m_HandleToIndex[m_IndexToHandle[i]] = i;
+        }
+    }
+
+    void TransformHierarchy2D::Reserve(std::size_t capacity) {
+        m_Positions.reserve(capacity);
+        m_Rotations.reserve(capacity);
+        m_Scales.reserve(capacity);
+        m_LocalMatrices.reserve(capacity);
+        m_WorldMatrices.reserve(capacity);
+        m_Parents.reserve(capacity);
+        m_LocalDirty.reserve(capacity);
+        m_WorldChanged.reserve(capacity);
+        m_Schedules.reserve(capacity);
+        m_HandleToIndex.reserve(capacity);
+        m_IndexToHandle.reserve(capacity);
+    }
+
+    Transform2DHandle TransformHierarchy2D::Create(const Vector2D& position, float rotation,
+                                                   const Vector2D& scale, Transform2DHandle parent) {
+        std::uint32_t parentIndex = parent.IsValid() ? IndexOf(parent) : InvalidIndex;
+
+        std::uint32_t id;
+        if (!m_FreeHandles.empty()) {
+            id = m_FreeHandles.back();
+            m_FreeHandles.pop_back();
+        } else {
+            id = static_cast<std::uint32_t>(m_HandleToIndex.size());
+            m_HandleToIndex.push_back(InvalidIndex);
+        }
+
+        // Appending keeps the order valid: the parent already precedes the new entry
+        std::uint32_t index = static_cast<std::uint32_t>(m_Positions.size());
+        m_Positions.push_back(position);
+        m_Rotations.push_back(rotation);
+        m_Scales.push_back(scale);
+        m_LocalMatrices.push_back(BuildLocalMatrix(position, rotation, scale));
+        m_WorldMatrices.push_back(Matrix3D::Identity());
+        m_Parents.push_back(parentIndex);
+        m_LocalDirty.push_back(1);
+        m_WorldChanged.push_back(0);
+        m_Schedules.push_back(parentIndex == InvalidIndex ? UpdateSchedule() : m_Schedules[parentIndex]);
+        m_IndexToHandle.push_back(id);
+        m_HandleToIndex[id] = index;
+
+        return Transform2DHandle{id};
+    }
+
+    void TransformHierarchy2D::Destroy(Transform2DHandle handle) {
+        const std::uint32_t index = IndexOf(handle);
+
+        m_Positions.erase(m_Positions.begin() + index);
+        m_Rotations.erase(m_Rotations.begin() + index);
+        m_Scales.erase(m_Scales.begin() + index);
+        m_LocalMatrices.erase(m_LocalMatrices.begin() + index);
+        m_WorldMatrices.erase(m_WorldMatrices.begin() + index);
+        m_Parents.erase(m_Parents.begin() + index);
+        m_LocalDirty.erase(m_LocalDirty.begin() + index);
+        m_WorldChanged.erase(m_WorldChanged.begin() + index);
+        m_Schedules.erase(m_Schedules.begin() + index);
+        m_IndexToHandle.erase(m_IndexToHandle.begin() + index);
+
+        m_HandleToIndex[handle.id] = InvalidIndex;
+        m_FreeHandles.push_back(handle.id);
+
+        const std::uint32_t count = static_cast<std::uint32_t>(m_Positions.size());
+        for (std::uint32_t i = index; i < count; ++i) {
+            std::uint32_t& parent = m_Parents[i];
+            if (parent == index) {
+                // Orphaned children become roots; their world matrix changes
+                parent = InvalidIndex;
+                MarkLocalDirty(i);
+            } else if (parent != InvalidIndex && parent > index) {
+                --parent;
+            }
+            m_HandleToIndex[m_IndexToHandle[i]] = i;
+        }
+    }
+
+    bool TransformHierarchy2D::Contains(Transform2DHandle handle) const {
+        return handle.IsValid() && handle.id < m_HandleToIndex.size() &&
+               m_HandleToIndex[handle.id] != InvalidIndex;
+    }
+
+    std::size_t TransformHierarchy2D::Size() const {
+        return m_Positions.size();
+    }
+
+    std::size_t TransformHierarchy2D::GetIndex(Transform2DHandle handle) const {
+        return IndexOf(handle);
+    }
+
+    Transform2DHandle TransformHierarchy2D::GetHandle(std::size_t index) const {
+        return Transform2DHandle{m_IndexToHandle[index]};
+    }
+
+    // Setters and Getters
+
+    void TransformHierarchy2D::SetPosition(Transform2DHandle handle, const Vector2D& position) {
+        const std::uint32_t index = IndexOf(handle);
+        m_Positions[index] = position;
+        MarkLocalDirty(index);
+    }
+
+    void TransformHierarchy2D::SetRotationRad(Transform2DHandle handle, float radians) {
+        const std::uint32_t index = IndexOf(handle);
+        m_Rotations[index] = radians;
+        MarkLocalDirty(index);
+    }
+
+    void TransformHierarchy2D::SetScale(Transform2DHandle handle, const Vector2D& scale) {
+        const std::uint32_t index = IndexOf(handle);
+        m_Scales[index] = scale;
+        MarkLocalDirty(index);
+    }
+
+    void TransformHierarchy2D::Translate(Transform2DHandle handle, const Vector2D& translation) {
+        const std::uint32_t index = IndexOf(handle);
+        m_Positions[index] += translation;
+        MarkLocalDirty(index);
+    }
+
+    void TransformHierarchy2D::SetParent(Transform2DHandle handle, Transform2DHandle parent) {
+        const std::uint32_t index = IndexOf(handle);
+        const std::uint32_t parentIndex = parent.IsValid() ? IndexOf(parent) : InvalidIndex;
+
+        // Reject links that would make the transform its own ancestor
+        if (WouldCreateCycle(index, parentIndex)) {
+            throw std::invalid_argument("Setting this parent would create a cycle");
+        }
+
+        m_Parents[index] = parentIndex;
+        MarkLocalDirty(index);
+
+        if (parentIndex != InvalidIndex && parentIndex > index) {
+            Reorder(index);
+        }
+        const Transform2DReparent operation{handle, parent};
+        InheritSchedules(std::span<const Transform2DReparent>(&operation, 1));
+    }
+
+    void TransformHierarchy2D::SetParents(std::span<const Transform2DReparent> operations, bool preserveWorld) {
+        struct PreviousState {
+            std::uint32_t index;
+            std::uint32_t parent;
+            Vector2D position;
+            float rotation;
+            Vector2D scale;
+            std::uint8_t localDirty;
+        };
+        std::vector<PreviousState> previous;
+        previous.reserve(operations.size());
+
+        // Dense indices stay fixed until the final reorder, so links can be applied in place
+        std::uint32_t firstUnordered = InvalidIndex;
+        try {
+            for (const Transform2DReparent& operation : operations) {
+                const std::uint32_t index = IndexOf(operation.child);
+                const std::uint32_t parentIndex = operation.parent.IsValid() ? IndexOf(operation.parent) : InvalidIndex;
+                if (WouldCreateCycle(index, parentIndex)) {
+                    throw std::invalid_argument("Setting this parent would create a cycle");
+                }
+
+                previous.push_back({index, m_Parents[index], m_Positions[index], m_Rotations[index],
+                                    m_Scales[index], m_LocalDirty[index]});
+
+                if (preserveWorld) {
+                    // Stored world matrices may predate edits or be deferred by an update period,
+                    // so both sides are resolved from the current local values and links
+                    const Matrix3D world = ComputeWorldMatrix(index);
+                    const Matrix3D local = parentIndex == InvalidIndex
+                        ? world
+                        : InverseAffine(ComputeWorldMatrix(parentIndex)) * world;
+                    DecomposeLocalMatrix(local, m_Positions[index], m_Rotations[index], m_Scales[index]);
+                }
+
+                m_Parents[index] = parentIndex;
+                MarkLocalDirty(index);
+                if (parentIndex != InvalidIndex && parentIndex > index) {
+                    firstUnordered = std::min(firstUnordered, index);
+                }
+            }
+        } catch (...) {
+            for (auto it = previous.rbegin(); it != previous.rend(); ++it) {
+                m_Parents[it->index] = it->parent;
+                m_Positions[it->index] = it->position;
+                m_Rotations[it->index] = it->rotation;
+                m_Scales[it->index] = it->scale;
+                m_LocalDirty[it->index] = it->localDirty;
+            }
+            throw;
+        }
+
+        if (firstUnordered != InvalidIndex) {
+            Reorder(firstUnordered);
+        }
+        InheritSchedules(operations);
+    }
+
+    const Vector2D& TransformHierarchy2D::GetPosition(Transform2DHandle handle) const {
+        return m_Positions[IndexOf(handle)];
+    }
+
+    float TransformHierarchy2D::GetRotationRad(Transform2DHandle handle) const {
+        return m_Rotations[IndexOf(handle)];
+    }
+
+    const Vector2D& TransformHierarchy2D::GetScale(Transform2DHandle handle) const {
+        return m_Scales[IndexOf(handle)];
+    }
+
+    Transform2DHandle TransformHierarchy2D::GetParent(Transform2DHandle handle) const {
+        const std::uint32_t parent = m_Parents[IndexOf(handle)];
+        return parent == InvalidIndex ? Transform2DHandle() : Transform2DHandle{m_IndexToHandle[parent]};
+    }
+
+    const Matrix3D& TransformHierarchy2D::GetLocalMatrix(Transform2DHandle handle) const {
+        return m_LocalMatrices[IndexOf(handle)];
+    }
+
+    const Matrix3D& TransformHierarchy2D::GetWorldMatrix(Transform2DHandle handle) const {
+        return m_WorldMatrices[IndexOf(handle)];
+    }
+
+    // Bulk access
+
+    std::span<const Vector2D> TransformHierarchy2D::GetPositions() const {
+        return m_Positions;
+    }
+
+    std::span<Vector2D> TransformHierarchy2D::EditPositions() {
+        for (std::uint8_t& dirty : m_LocalDirty) {
+            dirty = std::max(dirty, std::uint8_t{1});
+        }
+        return m_Positions;
+    }
+
+    std::span<const float> TransformHierarchy2D::GetRotations() const {
+        return m_Rotations;
+    }
+
+    std::span<const Vector2D> TransformHierarchy2D::GetScales() const {
+        return m_Scales;
+    }
+
+    std::span<const Matrix3D> TransformHierarchy2D::GetWorldMatrices() const {
+        return m_WorldMatrices;
+    }
+
+    // Update scheduling
+
+    void TransformHierarchy2D::SetUpdatePeriod(Transform2DHandle handle, std::uint32_t period) {
+        const std::uint32_t index = IndexOf(handle);
+        if (period == 0) {
+            throw std::invalid_argument("Update period must be at least 1");
+        }
+
+        // Descendants follow their ancestors in dense storage
+        const std::uint32_t count = static_cast<std::uint32_t>(m_Positions.size());
+        std::vector<std::uint8_t> inSubtree(count - index, 0);
+        const UpdateSchedule schedule{period, handle.id % period};
+        inSubtree[0] = 1;
+        m_Schedules[index] = schedule;
+        for (std::uint32_t i = index + 1; i < count; ++i) {
+            const std::uint32_t parent = m_Parents[i];
+            if (parent != InvalidIndex && parent >= index && inSubtree[parent - index]) {
+                inSubtree[i - index] = 1;
+                m_Schedules[i] = schedule;
+            }
+        }
+    }
+
+    std::uint32_t TransformHierarchy2D::GetUpdatePeriod(Transform2DHandle handle) const {
+        return m_Schedules[IndexOf(handle)].period;
+    }
+
+    void TransformHierarchy2D::SetUpdatePeriodsByDistance(const Vector2D& viewer, std::span<const float> bandDistances) {
+        const std::size_t count = m_Positions.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint32_t parent = m_Parents[i];
+            if (parent != InvalidIndex) {
+                m_Schedules[i] = m_Schedules[parent];
+                continue;
+            }
+
+            // A root's local position is its world position
+            const float distance = m_Positions[i].Distance(viewer);
+            std::uint32_t band = 0;
+            while (band < bandDistances.size() && band < 31 && distance >= bandDistances[band]) {
+                ++band;
+            }
+            const std::uint32_t period = 1u << band;
+            m_Schedules[i] = UpdateSchedule{period, m_IndexToHandle[i] % period};
+        }
+    }
+
+    void TransformHierarchy2D::RebaseOrigin(const Vector2D& newOrigin) {
+        MATH_TRACE_SCOPE("TransformHierarchy2D::RebaseOrigin");
+        const std::size_t count = m_Positions.size();
+
+        // A world matrix W becomes T(-newOrigin) * W, which only changes its translation
+        for (std::size_t i = 0; i < count; ++i) {
+            m_WorldMatrices[i].m02 -= newOrigin.x;
+            m_WorldMatrices[i].m12 -= newOrigin.y;
+        }
+
+        // Only roots are positioned in world space
+        for (std::size_t i = 0; i < count; ++i) {
+            if (m_Parents[i] == InvalidIndex) {
+                m_Positions[i] -= newOrigin;
+                m_LocalMatrices[i].m02 -= newOrigin.x;
+                m_LocalMatrices[i].m12 -= newOrigin.y;
+            }
+        }
+    }
+
+    void TransformHierarchy2D::UpdateWorldMatrices() {
+        MATH_TRACE_SCOPE("TransformHierarchy2D::UpdateWorldMatrices");
+        const std::size_t count = m_Positions.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const bool localChanged = m_LocalDirty[i] != 0;
+            if (localChanged) {
+                RebuildLocalMatrix(static_cast<std::uint32_t>(i));
+                m_LocalDirty[i] = 0;
+            }
+
+            // Parents precede children, so the parent's world matrix is already resolved
+            const std::uint32_t parent = m_Parents[i];
+            const bool parentChanged = parent != InvalidIndex && m_WorldChanged[parent] != 0;
+            m_WorldChanged[i] = (localChanged || parentChanged) ? 1 : 0;
+
+            if (m_WorldChanged[i]) {
+                m_WorldMatrices[i] = parent == InvalidIndex
+                    ? m_LocalMatrices[i]
+                    : m_WorldMatrices[parent] * m_LocalMatrices[i];
+            }
+        }
+    }
+
+    std::size_t TransformHierarchy2D::UpdateWorldMatrices(std::uint64_t frame, std::size_t periodicBudget) {
+        MATH_TRACE_SCOPE("TransformHierarchy2D::UpdateWorldMatrices(frame)");
+        const std::size_t count = m_Positions.size();
+        std::size_t updated = 0;
+        std::size_t periodicUpdated = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint32_t parent = m_Parents[i];
+            const bool localChanged = m_LocalDirty[i] != 0;
+            const bool parentChanged = parent != InvalidIndex && m_WorldChanged[parent] != 0;
+            if (!localChanged && !parentChanged) {
+                m_WorldChanged[i] = 0;
+                continue;
+            }
+
+            const UpdateSchedule schedule = m_Schedules[i];
+            if (schedule.period > 1) {
+                const bool due = m_LocalDirty[i] == Overdue || (frame + schedule.phase) % schedule.period == 0;
+                if (!due || periodicUpdated >= periodicBudget) {
+                    // Keep the update pending; the local matrix is rebuilt when it runs
+                    m_LocalDirty[i] = due ? Overdue : std::uint8_t{1};
+                    m_WorldChanged[i] = 0;
+                    continue;
+                }
+                ++periodicUpdated;
+            }
+
+            if (localChanged) {
+                RebuildLocalMatrix(static_cast<std::uint32_t>(i));
+                m_LocalDirty[i] = 0;
+            }
+            m_WorldChanged[i] = 1;
+            m_WorldMatrices[i] = parent == InvalidIndex
+                ? m_LocalMatrices[i]
+                : m_WorldMatrices[parent] * m_LocalMatrices[i];
+            ++updated;
+        }
+        return updated;
+    }
+
+} // namespace Math
@@ -0,0 +1,458 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef TRANSFORM_HIERARCHY2D_H
+#define TRANSFORM_HIERARCHY2D_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Vector2D.h"
+#include "Matrix3D.h"
+
+namespace Math {
+
+    /**
+     * @brief Stable handle to a transform stored in a TransformHierarchy2D.
+     *
+     * Handles stay valid while the hierarchy reorders its storage; they are only
+     * invalidated by destroying the transform they refer to.
+     */
+    struct Transform2DHandle {
+        /** Value used for handles that do not refer to any transform */
+        static constexpr std::uint32_t InvalidId = 0xFFFFFFFFu;
+
+        /** Identifier of the transform inside its hierarchy */
+        std::uint32_t id = InvalidId;
+
+        /**
+         * @brief Checks whether the handle refers to a transform.
+         * @return true if the handle is not the invalid handle
+         */
+        [[nodiscard]] constexpr bool IsValid() const {
+            return id != InvalidId;
+        }
+
+        constexpr bool operator==(const Transform2DHandle& other) const {
+            return id == other.id;
+        }
+
+        constexpr bool operator!=(const Transform2DHandle& other) const {
+            return id != other.id;
+        }
+    };
+
+    /**
+     * @brief One re-parent operation of TransformHierarchy2D::SetParents.
+     */
+    struct Transform2DReparent {
+        /** The transform to move */
+        Transform2DHandle child;
+
+        /** Its new parent, or an invalid handle to make it a root */
+        Transform2DHandle parent;
+    };
+
+    /**
+     * @class TransformHierarchy2D
+     * @brief Data-oriented storage for many 2D transforms and their parent links.
+     *
+     * Where Transform2D keeps its components, cached matrix and parent pointer in one
+     * object (around 72 bytes), this container splits them into separate arrays:
+     * - Hot data: positions, rotations and scales, each in its own array
+     * - Cold data: local and world matrices, parent links and dirty flags
+     *
+     * A loop that only moves objects therefore streams through 8 bytes per transform
+     * instead of the whole object. Transforms are addressed through stable
+     * Transform2DHandle values; internally they are kept in a dense array sorted so that
+     * every parent precedes its children, which lets UpdateWorldMatrices resolve the
+     * whole hierarchy in a single forward pass.
+     *
+     * World matrices are only valid after UpdateWorldMatrices has been called following
+     * the last modification.
+     *
+     * Distant or offscreen subtrees can be given an update period with SetUpdatePeriod or
+     * SetUpdatePeriodsByDistance. The frame-based UpdateWorldMatrices overload then only
+     * resolves them every few frames, spreads subtrees with the same period over different
+     * frames, and can cap the number of periodic updates per frame.
+     */
+    class TransformHierarchy2D {
+    private:
+        /** Value used for parent links of root transforms */
+        static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+        // Hot data (dense order)
+
+        /** Local positions */
+        std::vector<Vector2D> m_Positions;
+
+        /** Local rotations in radians */
+        std::vector<float> m_Rotations;
+
+        /** Local scales */
+        std::vector<Vector2D> m_Scales;
+
+        // Cold data (dense order)
+
+        /** Local matrices built from the hot data */
+        std::vector<Matrix3D> m_LocalMatrices;
+
+        /** World matrices resolved by UpdateWorldMatrices */
+        std::vector<Matrix3D> m_WorldMatrices;
+
+        /** Dense index of each transform's parent, or InvalidIndex for roots */
+        std::vector<std::uint32_t> m_Parents;
+
+        /** Non-zero when the local matrix must be rebuilt from the hot data */
+        std::vector<std::uint8_t> m_LocalDirty;
+
+        /** Scratch flags marking world matrices that changed during an update */
+        std::vector<std::uint8_t> m_WorldChanged;
+
+        /**
+         * @brief When a transform is resolved by the frame-based update.
+         */
+        struct UpdateSchedule {
+            /** Number of frames between updates; 1 updates every frame */
+            std::uint32_t period = 1;
+
+            /** Offset that spreads subtrees with the same period over different frames */
+            std::uint32_t phase = 0;
+        };
+
+        /** Update schedule of each transform, shared by its subtree */
+        std::vector<UpdateSchedule> m_Schedules;
+
+        // Handle indirection
+
+        /** Dense index for each handle id, or InvalidIndex for free ids */
+        std::vector<std::uint32_t> m_HandleToIndex;
+
+        /** Handle id for each dense index */
+        std::vector<std::uint32_t> m_IndexToHandle;
+
+        /** Handle ids available for reuse */
+        std::vector<std::uint32_t> m_FreeHandles;
+
+        /** m_LocalDirty value of a transform whose update was deferred by the frame budget */
+        static constexpr std::uint8_t Overdue = 2;
+
+    private:
+        /**
+         * @brief Gets the dense index of a handle.
+         * @throws std::invalid_argument if the handle does not refer to a live transform
+         */
+        std::uint32_t IndexOf(Transform2DHandle handle) const;
+
+        /**
+         * @brief Checks whether a link from index to a new parent would create a cycle.
+         */
+        bool WouldCreateCycle(std::uint32_t index, std::uint32_t parentIndex) const;
+
+        /**
+         * @brief Flags the local values at a dense index as changed, keeping an Overdue mark.
+         */
+        void MarkLocalDirty(std::uint32_t index);
+
+        /**
+         * @brief Computes the world matrix at a dense index from the current local values and links.
+         *
+         * Unlike m_WorldMatrices, the result includes edits made since the last update.
+         */
+        [[nodiscard]] Matrix3D ComputeWorldMatrix(std::uint32_t index) const;
+
+        /**
+         * @brief Rebuilds the local matrix of the transform at a dense index.
+         */
+        void RebuildLocalMatrix(std::uint32_t index);
+
+        /**
+         * @brief Gives re-parented transforms and their subtrees the schedule of their new parent.
+         *
+         * Transforms that became roots get the default schedule (period 1).
+         */
+        void InheritSchedules(std::span<const Transform2DReparent> operations);
+
+        /**
+         * @brief Re-sorts the dense storage from a given index so parents precede children.
+         *
+         * Entries before first must already be in a valid order; they are left untouched.
+         *
+         * @param first Dense index from which the order may be invalid
+         */
+        void Reorder(std::uint32_t first);
+
+    public:
+        /**
+         * @brief Creates an empty hierarchy.
+         */
+        TransformHierarchy2D() = default;
+
+        /**
+         * @brief Reserves storage for a number of transforms.
+         * @param capacity Number of transforms to reserve space for
+         */
+        void Reserve(std::size_t capacity);
+
+        /**
+         * @brief Creates a new transform.
+         * @param position Initial local position
+         * @param rotation Initial local rotation in radians (default = 0)
+         * @param scale Initial local scale (default = (1,1))
+         * @param parent Parent transform (default = none, creates a root)
+         * @return Handle to the new transform
+         * @throws std::invalid_argument if parent is valid but not part of this hierarchy
+         */
+        Transform2DHandle Create(const Vector2D& position = Vector2D(0.0f, 0.0f), float rotation = 0.0f,
+                                 const Vector2D& scale = Vector2D(1.0f, 1.0f),
+                                 Transform2DHandle parent = Transform2DHandle());
+
+        /**
+         * @brief Destroys a transform. Its children become roots.
+         *
+         * The dense order of the remaining transforms is preserved.
+         *
+         * @param handle The transform to destroy
+         * @throws std::invalid_argument if the handle is not part of this hierarchy
+         */
+        void Destroy(Transform2DHandle handle);
+
+        /**
+         * @brief Checks whether a handle refers to a live transform of this hierarchy.
+         * @param handle The handle to check
+         * @return true if the transform exists
+         */
+        [[nodiscard]] bool Contains(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the number of transforms in the hierarchy.
+         * @return Number of live transforms
+         */
+        [[nodiscard]] std::size_t Size() const;
+
+        /**
+         * @brief Gets the current dense index of a transform.
+         *
+         * Dense indices address the arrays returned by GetPositions and similar accessors.
+         * They change when transforms are destroyed or re-parented.
+         *
+         * @param handle The transform
+         * @return Its index in dense storage
+         * @throws std::invalid_argument if the handle is not part of this hierarchy
+         */
+        [[nodiscard]] std::size_t GetIndex(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the handle of the transform stored at a dense index.
+         * @param index Dense index (less than Size())
+         * @return Handle of the transform at that index
+         */
+        [[nodiscard]] Transform2DHandle GetHandle(std::size_t index) const;
+
+        // Setters and Getters
+
+        /**
+         * @brief Sets the local position of a transform.
+         * @param handle The transform
+         * @param position New local position
+         */
+        void SetPosition(Transform2DHandle handle, const Vector2D& position);
+
+        /**
+         * @brief Sets the local rotation of a transform in radians.
+         * @param handle The transform
+         * @param radians New local rotation in radians
+         */
+        void SetRotationRad(Transform2DHandle handle, float radians);
+
+        /**
+         * @brief Sets the local scale of a transform.
+         * @param handle The transform
+         * @param scale New local scale
+         */
+        void SetScale(Transform2DHandle handle, const Vector2D& scale);
+
+        /**
+         * @brief Moves a transform by the given offset.
+         * @param handle The transform
+         * @param translation Offset added to the local position
+         */
+        void Translate(Transform2DHandle handle, const Vector2D& translation);
+
+        /**
+         * @brief Sets the parent of a transform, reordering storage if required.
+         *
+         * The transform and its subtree take the update period of the new parent, or period 1
+         * as a root.
+         *
+         * @param handle The transform
+         * @param parent The new parent, or an invalid handle to make it a root
+         * @throws std::invalid_argument if the link would create a cycle
+         */
+        void SetParent(Transform2DHandle handle, Transform2DHandle parent);
+
+        /**
+         * @brief Applies many re-parent operations, reordering storage at most once.
+         *
+         * Operations are applied in sequence, so later ones see the links made by earlier
+         * ones; the whole subtree below each child moves with it. Storage is re-sorted once at
+         * the end, starting from the first transform whose order was invalidated. As with
+         * SetParent, each moved subtree takes the update period of its new parent.
+         *
+         * With preserveWorld, each child's local position, rotation and scale are recomputed
+         * so that its world matrix stays the same under the new parent. Both world matrices
+         * are computed from the current local values, so edits since the last update are
+         * kept. This is exact unless a non-uniformly scaled parent is rotated relative to
+         * the child, which would need shear.
+         *
+         * If an operation fails, none of the batch is applied.
+         *
+         * @param operations The operations to apply
+         * @param preserveWorld Keep world transforms instead of local ones (default = false)
+         * @throws std::invalid_argument if a handle is not part of this hierarchy or a link
+         *         would create a cycle
+         * @throws std::runtime_error if preserveWorld is set and a new parent has zero scale
+         */
+        void SetParents(std::span<const Transform2DReparent> operations, bool preserveWorld = false);
+
+        /**
+         * @brief Gets the local position of a transform.
+         */
+        [[nodiscard]] const Vector2D& GetPosition(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the local rotation of a transform in radians.
+         */
+        [[nodiscard]] float GetRotationRad(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the local scale of a transform.
+         */
+        [[nodiscard]] const Vector2D& GetScale(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the parent of a transform.
+         * @return The parent handle, or an invalid handle for roots
+         */
+        [[nodiscard]] Transform2DHandle GetParent(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the local matrix of a transform, as of the last update.
+         */
+        [[nodiscard]] const Matrix3D& GetLocalMatrix(Transform2DHandle handle) const;
+
+        /**
+         * @brief Gets the world matrix of a transform, as of the last update.
+         */
+        [[nodiscard]] const Matrix3D& GetWorldMatrix(Transform2DHandle handle) const;
+
+        // Bulk access
+
+        /**
+         * @brief Gets all local positions in dense order.
+         * @return Read-only view of the position array
+         */
+        [[nodiscard]] std::span<const Vector2D> GetPositions() const;
+
+        /**
+         * @brief Gets all local positions in dense order for bulk editing.
+         *
+         * Every transform is marked as needing a matrix rebuild; only the position array
+         * and one byte per transform are touched.
+         *
+         * @return Mutable view of the position array
+         */
+        [[nodiscard]] std::span<Vector2D> EditPositions();
+
+        /**
+         * @brief Gets all local rotations in dense order.
+         * @return Read-only view of the rotation array
+         */
+        [[nodiscard]] std::span<const float> GetRotations() const;
+
+        /**
+         * @brief Gets all local scales in dense order.
+         * @return Read-only view of the scale array
+         */
+        [[nodiscard]] std::span<const Vector2D> GetScales() const;
+
+        /**
+         * @brief Gets all world matrices in dense order, as of the last update.
+         * @return Read-only view of the world matrix array
+         */
+        [[nodiscard]] std::span<const Matrix3D> GetWorldMatrices() const;
+
+        /**
+         * @brief Moves the world origin to a new point, e.g. to keep float precision near the camera.
+         *
+         * Every world position p becomes p - newOrigin. Root positions and the translation of
+         * every cached local and world matrix are offset in one pass over dense storage;
+         * nothing is marked dirty, so the next UpdateWorldMatrices only does the work already
+         * pending. Children keep their local state, since it is relative to their parent.
+         *
+         * @param newOrigin Position of the new origin in current world coordinates
+         */
+        void RebaseOrigin(const Vector2D& newOrigin);
+
+        // Update scheduling
+
+        /**
+         * @brief Sets how often a subtree is resolved by the frame-based update.
+         *
+         * The transform and all of its current descendants get the period; transforms created
+         * or re-parented under them later inherit it. Each subtree is offset by its root handle, so subtrees
+         * sharing a period are updated on different frames.
+         *
+         * @param handle Root of the subtree
+         * @param period Number of frames between updates; 1 updates every frame
+         * @throws std::invalid_argument if the handle is not part of this hierarchy or period is 0
+         */
+        void SetUpdatePeriod(Transform2DHandle handle, std::uint32_t period);
+
+        /**
+         * @brief Gets the update period of a transform.
+         */
+        [[nodiscard]] std::uint32_t GetUpdatePeriod(Transform2DHandle handle) const;
+
+        /**
+         * @brief Sets the update period of every root's subtree from the root's distance to a viewer.
+         *
+         * A root closer than bandDistances[0] is updated every frame, one closer than
+         * bandDistances[1] every 2 frames, then every 4, 8, ... frames. Replaces any period set
+         * with SetUpdatePeriod.
+         *
+         * @param viewer Viewer position in world space
+         * @param bandDistances Increasing distances at which the period doubles
+         */
+        void SetUpdatePeriodsByDistance(const Vector2D& viewer, std::span<const float> bandDistances);
+
+        /**
+         * @brief Resolves the local and world matrices of every modified transform.
+         *
+         * Runs one forward pass over dense storage; transforms whose local matrix and
+         * ancestors did not change are skipped. Update periods are ignored.
+         */
+        void UpdateWorldMatrices();
+
+        /**
+         * @brief Resolves modified transforms whose update period is due on this frame.
+         *
+         * Transforms with period 1 are always resolved. A modified transform with a longer
+         * period is resolved on the frames where it is due, and only while fewer than
+         * periodicBudget periodic transforms have been resolved this frame; otherwise its
+         * update is deferred. Deferred updates are kept and run on a later frame, budgeted
+         * ones on the next frame. Until then, the transform keeps its previous world matrix.
+         *
+         * @param frame Frame counter, increased by one every frame
+         * @param periodicBudget Maximum number of transforms with a period above 1 to resolve
+         * @return Number of world matrices that were recomputed
+         */
+        std::size_t UpdateWorldMatrices(std::uint64_t frame, std::size_t periodicBudget = SIZE_MAX);
+    };
+
+} // namespace Math
+
+#endif // TRANSFORM_HIERARCHY2D_H
@@ -5,6 +5,7 @@
 #ifndef VECTOR2D_H
 #define VECTOR2D_H
 #include <cmath>
+#include "ScalarMath.h"
 
 namespace Math {
     struct Vector2D {
@@ -172,7 +173,7 @@ namespace Math {
             if (lengths == 0) {
                 return 0; // Avoid division by zero
             }
-            return std::acos(dotProduct / lengths);
+            return Math::Acos(dotProduct / lengths);
         }
 
         /**
@@ -5,6 +5,8 @@
 #ifndef VECTOR3_H
 #define VECTOR3_H
 #include <cmath>
+#include "ScalarMath.h"
+#include <stdexcept>
 
 namespace Math {
     struct Vector3D {
@@ -163,7 +165,7 @@ namespace Math {
             if (lengths == 0) {
                 return 0; // Avoid division by zero
             }
-            return std::acos(dotProduct / lengths);
+            return Math::Acos(dotProduct / lengths);
         }
         /**
          * Calculates the distance between two 3D vectors.
@@ -0,0 +1,107 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "WorkerPool.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Math {
+
+    WorkerPool::WorkerPool(std::size_t threadCount) {
+        if (threadCount == 0) {
+            throw std::invalid_argument("Worker pool needs at least one thread");
+        }
+
+        m_Workers.reserve(threadCount - 1);
+        for (std::size_t i = 1; i < threadCount; ++i) {
+            m_Workers.emplace_back(&WorkerPool::WorkerLoop, this, i);
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_WorkReady.notify_all();
+        for (std::thread& worker : m_Workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t WorkerPool::GetThreadCount() const {
+        return m_Workers.size() + 1;
+    }
+
+    void WorkerPool::RunChunk(std::size_t index, std::size_t itemCount, std::size_t participants,
+                              ChunkFunction process) const {
+        const std::size_t begin = itemCount * index / participants;
+        const std::size_t end = itemCount * (index + 1) / participants;
+        if (begin < end) {
+            process(begin, end);
+        }
+    }
+
+    void WorkerPool::WorkerLoop(std::size_t index) {
+        std::uint64_t seenGeneration = 0;
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while (true) {
+            m_WorkReady.wait(lock, [&]() { return m_Stop || m_Generation != seenGeneration; });
+            if (m_Stop) {
+                return;
+            }
+            seenGeneration = m_Generation;
+            if (index >= m_Participants) {
+                continue;
+            }
+
+            const ChunkFunction process = *m_Task;
+            const std::size_t itemCount = m_ItemCount;
+            const std::size_t participants = m_Participants;
+
+            lock.unlock();
+            RunChunk(index, itemCount, participants, process);
+            lock.lock();
+
+            if (--m_Pending == 0) {
+                m_WorkDone.notify_one();
+            }
+        }
+    }
+
+    void WorkerPool::ParallelFor(std::size_t itemCount, std::size_t threadCount,
+                                 ChunkFunction process) {
+        if (threadCount == 0 || threadCount > GetThreadCount()) {
+            throw std::invalid_argument("Thread count must be between 1 and the size of the pool");
+        }
+
+        if (threadCount == 1) {
+            RunChunk(0, itemCount, 1, process);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Task = &process;
+            m_ItemCount = itemCount;
+            m_Participants = threadCount;
+            m_Pending = threadCount - 1;
+            ++m_Generation;
+        }
+        m_WorkReady.notify_all();
+
+        RunChunk(0, itemCount, threadCount, process);
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_WorkDone.wait(lock, [&]() { return m_Pending == 0; });
+        m_Task = nullptr;
+    }
+
+    void WorkerPool::ParallelForChunks(std::size_t itemCount, std::size_t minItemsPerThread,
+                                       ChunkFunction process) {
+        const std::size_t useful = itemCount / std::max<std::size_t>(1, minItemsPerThread);
+        ParallelFor(itemCount, std::clamp<std::size_t>(useful, 1, GetThreadCount()), process);
+    }
+
+} // namespace Math
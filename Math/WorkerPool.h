@@ -0,0 +1,136 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Math {
+
+    /**
+     * @class ChunkFunction
+     * @brief Non-owning reference to a callable that processes a [begin, end) item range.
+     *
+     * Unlike std::function it never allocates, however much the callable captures. The
+     * callable must outlive the reference; WorkerPool only holds it during a call.
+     */
+    class ChunkFunction {
+    private:
+        const void* m_Callable;
+        void (*m_Invoke)(const void*, std::size_t, std::size_t);
+
+    public:
+        template <typename Callable>
+            requires(!std::is_same_v<std::remove_cvref_t<Callable>, ChunkFunction> &&
+                     std::is_invocable_v<const Callable&, std::size_t, std::size_t>)
+        ChunkFunction(const Callable& callable)
+            : m_Callable(&callable), m_Invoke([](const void* target, std::size_t begin, std::size_t end) {
+                  (*static_cast<const Callable*>(target))(begin, end);
+              }) {}
+
+        void operator()(std::size_t begin, std::size_t end) const {
+            m_Invoke(m_Callable, begin, end);
+        }
+    };
+
+    /**
+     * @class WorkerPool
+     * @brief Persistent threads that split a range of items between them.
+     *
+     * Threads are created once, so a ParallelFor call only pays for waking the workers and
+     * waiting for the slowest one. The simulation modules take an optional pool to update
+     * their data in chunks; the benchmarks use one to measure thread scaling.
+     *
+     * ParallelFor must not be called from more than one thread at a time, nor from inside a
+     * task. Tasks must not throw.
+     */
+    class WorkerPool {
+    private:
+        std::vector<std::thread> m_Workers;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_WorkReady;
+        std::condition_variable m_WorkDone;
+
+        /** Current task, valid while a ParallelFor call is running */
+        const ChunkFunction* m_Task = nullptr;
+        std::size_t m_ItemCount = 0;
+
+        /** Number of threads (including the caller) taking part in the current task */
+        std::size_t m_Participants = 0;
+
+        /** Workers that have not finished the current task yet */
+        std::size_t m_Pending = 0;
+
+        /** Incremented for every task so workers can tell a new task from a spurious wakeup */
+        std::uint64_t m_Generation = 0;
+
+        bool m_Stop = false;
+
+        void WorkerLoop(std::size_t index);
+
+        /**
+         * @brief Runs the share of the current task that belongs to a participant.
+         */
+        void RunChunk(std::size_t index, std::size_t itemCount, std::size_t participants,
+                      ChunkFunction process) const;
+
+    public:
+        /**
+         * @brief Starts the workers.
+         * @param threadCount Total number of threads, including the thread calling ParallelFor
+         * @throws std::invalid_argument if threadCount is 0
+         */
+        explicit WorkerPool(std::size_t threadCount);
+
+        /**
+         * @brief Stops and joins the workers.
+         */
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /**
+         * @brief Gets the total number of threads, including the calling thread.
+         */
+        [[nodiscard]] std::size_t GetThreadCount() const;
+
+        /**
+         * @brief Splits [0, itemCount) into contiguous chunks and processes them in parallel.
+         *
+         * The calling thread processes the first chunk. Returns once every chunk is done.
+         *
+         * @param itemCount Number of items to process
+         * @param threadCount Number of threads to use, including the calling thread
+         * @param process Called once per chunk with the chunk's [begin, end) item range
+         * @throws std::invalid_argument if threadCount is 0 or larger than GetThreadCount()
+         */
+        void ParallelFor(std::size_t itemCount, std::size_t threadCount,
+                         ChunkFunction process);
+
+        /**
+         * @brief Splits [0, itemCount) between as many threads as have at least minItemsPerThread items.
+         *
+         * Small batches run on the calling thread only, where waking workers would cost more
+         * than it saves.
+         *
+         * @param itemCount Number of items to process
+         * @param minItemsPerThread Smallest chunk worth handing to another thread
+         * @param process Called once per chunk with the chunk's [begin, end) item range
+         */
+        void ParallelForChunks(std::size_t itemCount, std::size_t minItemsPerThread,
+                               ChunkFunction process);
+    };
+
+} // namespace Math
+
+#endif // WORKER_POOL_H
@@ -0,0 +1,512 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "WorkloadTrace.h"
+#include "Matrix3D.h"
+#include "Matrix4D.h"
+#include "Transform2D.h"
+#include "Trace.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+namespace Math {
+
+    namespace {
+
+        constexpr std::uint8_t Magic[4] = {'M', 'W', 'T', 'R'};
+        constexpr std::uint16_t Version = 1;
+        constexpr std::size_t HeaderSize = 8;
+
+        template <std::size_t N>
+        double Sum(const std::array<float, N>& values) {
+            double sum = 0.0;
+            for (float value : values) {
+                sum += value;
+            }
+            return sum;
+        }
+
+        // Float arguments of each operation
+        constexpr std::size_t ValueCount(TraceOp op) {
+            switch (op) {
+                case TraceOp::CreateTransform:        return 5;
+                case TraceOp::SetPosition:            return 2;
+                case TraceOp::SetRotation:            return 1;
+                case TraceOp::SetScale:               return 2;
+                case TraceOp::Translate:              return 2;
+                case TraceOp::Rotate:                 return 1;
+                case TraceOp::TransformPoint:         return 2;
+                case TraceOp::InverseTransformPoint:  return 2;
+                case TraceOp::MultiplyMatrix3D:       return 18;
+                case TraceOp::MultiplyMatrix4D:       return 32;
+                case TraceOp::InverseMatrix4D:        return 16;
+                case TraceOp::TransformPointMatrix4D: return 19;
+                default:                              return 0;
+            }
+        }
+
+        // Transform ids read before the float arguments: target, then parent
+        constexpr std::size_t IdCount(TraceOp op) {
+            switch (op) {
+                case TraceOp::CreateTransform:
+                case TraceOp::SetParent:
+                    return 2;
+                case TraceOp::MultiplyMatrix3D:
+                case TraceOp::MultiplyMatrix4D:
+                case TraceOp::InverseMatrix4D:
+                case TraceOp::TransformPointMatrix4D:
+                    return 0;
+                default:
+                    return 1;
+            }
+        }
+
+        class Reader {
+        private:
+            const std::vector<std::uint8_t>& m_Data;
+            std::size_t m_Offset;
+
+        public:
+            Reader(const std::vector<std::uint8_t>& data, std::size_t offset) : m_Data(data), m_Offset(offset) {}
+
+            bool AtEnd() const {
+                return m_Offset == m_Data.size();
+            }
+
+            std::uint8_t ReadByte() {
+                if (m_Offset >= m_Data.size()) {
+                    throw std::invalid_argument("Workload trace is truncated");
+                }
+                return m_Data[m_Offset++];
+            }
+
+            std::uint32_t ReadId() {
+                std::uint32_t value = 0;
+                for (int shift = 0; shift < 35; shift += 7) {
+                    const std::uint8_t byte = ReadByte();
+                    // The fifth byte holds the top 4 bits; anything above them does not fit
+                    if (shift == 28 && (byte & 0x70) != 0) {
+                        break;
+                    }
+                    value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) {
+                        return value;
+                    }
+                }
+                throw std::invalid_argument("Workload trace contains an invalid transform id");
+            }
+
+            float ReadFloat() {
+                std::uint32_t bits = 0;
+                for (int i = 0; i < 4; ++i) {
+                    bits |= static_cast<std::uint32_t>(ReadByte()) << (8 * i);
+                }
+                return std::bit_cast<float>(bits);
+            }
+        };
+
+    } // namespace
+
+    // WorkloadRecorder
+
+    WorkloadRecorder::WorkloadRecorder() {
+        m_Data.assign(std::begin(Magic), std::end(Magic));
+        m_Data.push_back(static_cast<std::uint8_t>(Version & 0xFF));
+        m_Data.push_back(static_cast<std::uint8_t>(Version >> 8));
+        m_Data.push_back(0);
+        m_Data.push_back(0);
+    }
+
+    void WorkloadRecorder::WriteOp(TraceOp op) {
+        m_Data.push_back(static_cast<std::uint8_t>(op));
+        ++m_OperationCount;
+    }
+
+    void WorkloadRecorder::WriteId(std::uint32_t id) {
+        while (id >= 0x80) {
+            m_Data.push_back(static_cast<std::uint8_t>(id | 0x80));
+            id >>= 7;
+        }
+        m_Data.push_back(static_cast<std::uint8_t>(id));
+    }
+
+    void WorkloadRecorder::WriteFloat(float value) {
+        const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        for (int i = 0; i < 4; ++i) {
+            m_Data.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+        }
+    }
+
+    void WorkloadRecorder::WriteVector(const Vector2D& value) {
+        WriteFloat(value.x);
+        WriteFloat(value.y);
+    }
+
+    std::uint32_t WorkloadRecorder::IdOf(const Transform2D* transform) const {
+        if (transform == nullptr) {
+            return 0;
+        }
+        const auto it = m_Ids.find(transform);
+        if (it == m_Ids.end()) {
+            throw std::invalid_argument("Transform is not registered with the workload recorder");
+        }
+        return it->second;
+    }
+
+    void WorkloadRecorder::RegisterTransform(const Transform2D& transform) {
+        if (m_Ids.contains(&transform)) {
+            throw std::invalid_argument("Transform is already registered with the workload recorder");
+        }
+        const std::uint32_t parent = IdOf(transform.GetParent());
+        const std::uint32_t id = m_NextId++;
+        m_Ids.emplace(&transform, id);
+
+        WriteOp(TraceOp::CreateTransform);
+        WriteId(id);
+        WriteId(parent);
+        WriteVector(transform.GetPosition());
+        WriteFloat(transform.GetRotationRad());
+        WriteVector(transform.GetScale());
+    }
+
+    void WorkloadRecorder::UnregisterTransform(const Transform2D& transform) {
+        const std::uint32_t id = IdOf(&transform);
+        m_Ids.erase(&transform);
+
+        WriteOp(TraceOp::DestroyTransform);
+        WriteId(id);
+    }
+
+    void WorkloadRecorder::SetParent(Transform2D& transform, Transform2D* parent) {
+        const std::uint32_t id = IdOf(&transform);
+        const std::uint32_t parentId = IdOf(parent);
+        transform.SetParent(parent);
+
+        WriteOp(TraceOp::SetParent);
+        WriteId(id);
+        WriteId(parentId);
+    }
+
+    void WorkloadRecorder::SetPosition(Transform2D& transform, const Vector2D& position) {
+        const std::uint32_t id = IdOf(&transform);
+        transform.SetPosition(position);
+
+        WriteOp(TraceOp::SetPosition);
+        WriteId(id);
+        WriteVector(position);
+    }
+
+    void WorkloadRecorder::SetRotationRad(Transform2D& transform, float radians) {
+        const std::uint32_t id = IdOf(&transform);
+        transform.SetRotationRad(radians);
+
+        WriteOp(TraceOp::SetRotation);
+        WriteId(id);
+        WriteFloat(radians);
+    }
+
+    void WorkloadRecorder::SetScale(Transform2D& transform, const Vector2D& scale) {
+        const std::uint32_t id = IdOf(&transform);
+        transform.SetScale(scale);
+
+        WriteOp(TraceOp::SetScale);
+        WriteId(id);
+        WriteVector(scale);
+    }
+
+    void WorkloadRecorder::Translate(Transform2D& transform, const Vector2D& translation) {
+        const std::uint32_t id = IdOf(&transform);
+        transform.Translate(translation);
+
+        WriteOp(TraceOp::Translate);
+        WriteId(id);
+        WriteVector(translation);
+    }
+
+    void WorkloadRecorder::RotateRad(Transform2D& transform, float radians) {
+        const std::uint32_t id = IdOf(&transform);
+        transform.RotateRad(radians);
+
+        WriteOp(TraceOp::Rotate);
+        WriteId(id);
+        WriteFloat(radians);
+    }
+
+    Matrix3D WorkloadRecorder::GetWorldMatrix(const Transform2D& transform) {
+        const std::uint32_t id = IdOf(&transform);
+        const Matrix3D result = transform.GetWorldMatrix();
+
+        WriteOp(TraceOp::GetWorldMatrix);
+        WriteId(id);
+        m_Checksum += Sum(result.ToArray());
+        return result;
+    }
+
+    Vector2D WorkloadRecorder::TransformPoint(const Transform2D& transform, const Vector2D& point) {
+        const std::uint32_t id = IdOf(&transform);
+        const Vector2D result = transform.TransformPoint(point);
+
+        WriteOp(TraceOp::TransformPoint);
+        WriteId(id);
+        WriteVector(point);
+        m_Checksum += static_cast<double>(result.x) + result.y;
+        return result;
+    }
+
+    Vector2D WorkloadRecorder::InverseTransformPoint(const Transform2D& transform, const Vector2D& point) {
+        const std::uint32_t id = IdOf(&transform);
+        const Vector2D result = transform.InverseTransformPoint(point);
+
+        WriteOp(TraceOp::InverseTransformPoint);
+        WriteId(id);
+        WriteVector(point);
+        m_Checksum += static_cast<double>(result.x) + result.y;
+        return result;
+    }
+
+    Matrix3D WorkloadRecorder::Multiply(const Matrix3D& a, const Matrix3D& b) {
+        const Matrix3D result = a * b;
+
+        WriteOp(TraceOp::MultiplyMatrix3D);
+        for (float value : a.ToArray()) {
+            WriteFloat(value);
+        }
+        for (float value : b.ToArray()) {
+            WriteFloat(value);
+        }
+        m_Checksum += Sum(result.ToArray());
+        return result;
+    }
+
+    Matrix4D WorkloadRecorder::Multiply(const Matrix4D& a, const Matrix4D& b) {
+        const Matrix4D result = a * b;
+
+        WriteOp(TraceOp::MultiplyMatrix4D);
+        for (float value : a.ToArray()) {
+            WriteFloat(value);
+        }
+        for (float value : b.ToArray()) {
+            WriteFloat(value);
+        }
+        m_Checksum += Sum(result.ToArray());
+        return result;
+    }
+
+    Matrix4D WorkloadRecorder::Inverse(const Matrix4D& matrix) {
+        const Matrix4D result = matrix.Inverse();
+
+        WriteOp(TraceOp::InverseMatrix4D);
+        for (float value : matrix.ToArray()) {
+            WriteFloat(value);
+        }
+        m_Checksum += Sum(result.ToArray());
+        return result;
+    }
+
+    Vector3D WorkloadRecorder::TransformPoint(const Matrix4D& matrix, const Vector3D& point) {
+        const Vector3D result = matrix.TransformPoint(point);
+
+        WriteOp(TraceOp::TransformPointMatrix4D);
+        for (float value : matrix.ToArray()) {
+            WriteFloat(value);
+        }
+        WriteFloat(point.x);
+        WriteFloat(point.y);
+        WriteFloat(point.z);
+        m_Checksum += static_cast<double>(result.x) + result.y + result.z;
+        return result;
+    }
+
+    std::size_t WorkloadRecorder::GetOperationCount() const {
+        return m_OperationCount;
+    }
+
+    double WorkloadRecorder::GetChecksum() const {
+        return m_Checksum;
+    }
+
+    const std::vector<std::uint8_t>& WorkloadRecorder::GetData() const {
+        return m_Data;
+    }
+
+    void WorkloadRecorder::Save(const std::string& path) const {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(m_Data.data()), static_cast<std::streamsize>(m_Data.size()));
+        if (!file) {
+            throw std::runtime_error("Cannot write workload trace: " + path);
+        }
+    }
+
+    // WorkloadTrace
+
+    WorkloadTrace::WorkloadTrace(const std::vector<std::uint8_t>& data) {
+        if (data.size() < HeaderSize || !std::equal(std::begin(Magic), std::end(Magic), data.begin())) {
+            throw std::invalid_argument("Data is not a workload trace");
+        }
+        const std::uint16_t version = static_cast<std::uint16_t>(data[4] | (data[5] << 8));
+        if (version != Version) {
+            throw std::invalid_argument("Unsupported workload trace version " + std::to_string(version));
+        }
+
+        // Ids that are currently alive, to reject operations on unknown transforms
+        std::vector<bool> alive(1, false);
+        // Parent of every id as replayed (destroyed transforms keep their links), to reject cycles
+        std::vector<std::uint32_t> parentOf(1, 0);
+
+        Reader reader(data, HeaderSize);
+        while (!reader.AtEnd()) {
+            const std::uint8_t opByte = reader.ReadByte();
+            if (opByte >= static_cast<std::uint8_t>(TraceOp::Count)) {
+                throw std::invalid_argument("Workload trace contains an unknown operation");
+            }
+
+            Operation operation{static_cast<TraceOp>(opByte), 0, 0, static_cast<std::uint32_t>(m_Values.size())};
+            const std::size_t idCount = IdCount(operation.op);
+            if (idCount > 0) {
+                operation.id = reader.ReadId();
+            }
+            if (idCount > 1) {
+                operation.other = reader.ReadId();
+            }
+
+            if (operation.op == TraceOp::CreateTransform) {
+                // The recorder numbers transforms 1, 2, 3... in creation order and never reuses an id
+                if (operation.id != alive.size()) {
+                    throw std::invalid_argument("Workload trace creates a transform out of order");
+                }
+                alive.push_back(false);
+                parentOf.push_back(0);
+            } else if (idCount > 0 && (operation.id >= alive.size() || !alive[operation.id])) {
+                throw std::invalid_argument("Workload trace uses an unknown transform");
+            }
+            if (operation.other != 0 && (operation.other >= alive.size() || !alive[operation.other])) {
+                throw std::invalid_argument("Workload trace uses an unknown parent transform");
+            }
+            if (operation.op == TraceOp::CreateTransform || operation.op == TraceOp::SetParent) {
+                for (std::uint32_t ancestor = operation.other; ancestor != 0; ancestor = parentOf[ancestor]) {
+                    if (ancestor == operation.id) {
+                        throw std::invalid_argument("Workload trace parents a transform to itself or a descendant");
+                    }
+                }
+                parentOf[operation.id] = operation.other;
+            }
+
+            for (std::size_t i = 0; i < ValueCount(operation.op); ++i) {
+                m_Values.push_back(reader.ReadFloat());
+            }
+
+            if (operation.op == TraceOp::CreateTransform) {
+                alive[operation.id] = true;
+            } else if (operation.op == TraceOp::DestroyTransform) {
+                alive[operation.id] = false;
+            }
+            m_Operations.push_back(operation);
+        }
+
+        m_IdCount = static_cast<std::uint32_t>(alive.size());
+    }
+
+    WorkloadTrace WorkloadTrace::Load(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Cannot read workload trace: " + path);
+        }
+        const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return WorkloadTrace(data);
+    }
+
+    std::size_t WorkloadTrace::GetOperationCount() const {
+        return m_Operations.size();
+    }
+
+    double WorkloadTrace::Replay() const {
+        MATH_TRACE_SCOPE("WorkloadTrace::Replay");
+        std::vector<std::unique_ptr<Transform2D>> transforms(m_IdCount);
+        double checksum = 0.0;
+
+        for (const Operation& operation : m_Operations) {
+            const float* v = m_Values.data() + operation.firstValue;
+            Transform2D* target = operation.id != 0 ? transforms[operation.id].get() : nullptr;
+
+            switch (operation.op) {
+                case TraceOp::CreateTransform:
+                    transforms[operation.id] = std::make_unique<Transform2D>(Vector2D(v[0], v[1]), v[2], Vector2D(v[3], v[4]));
+                    transforms[operation.id]->SetParent(operation.other != 0 ? transforms[operation.other].get() : nullptr);
+                    break;
+                case TraceOp::DestroyTransform:
+                    // Kept alive until the end, see Replay()
+                    break;
+                case TraceOp::SetPosition:
+                    target->SetPosition(Vector2D(v[0], v[1]));
+                    break;
+                case TraceOp::SetRotation:
+                    target->SetRotationRad(v[0]);
+                    break;
+                case TraceOp::SetScale:
+                    target->SetScale(Vector2D(v[0], v[1]));
+                    break;
+                case TraceOp::Translate:
+                    target->Translate(Vector2D(v[0], v[1]));
+                    break;
+                case TraceOp::Rotate:
+                    target->RotateRad(v[0]);
+                    break;
+                case TraceOp::SetParent:
+                    target->SetParent(operation.other != 0 ? transforms[operation.other].get() : nullptr);
+                    break;
+                case TraceOp::GetWorldMatrix:
+                    checksum += Sum(target->GetWorldMatrix().ToArray());
+                    break;
+                case TraceOp::TransformPoint: {
+                    const Vector2D result = target->TransformPoint(Vector2D(v[0], v[1]));
+                    checksum += static_cast<double>(result.x) + result.y;
+                    break;
+                }
+                case TraceOp::InverseTransformPoint: {
+                    const Vector2D result = target->InverseTransformPoint(Vector2D(v[0], v[1]));
+                    checksum += static_cast<double>(result.x) + result.y;
+                    break;
+                }
+                case TraceOp::MultiplyMatrix3D: {
+                    std::array<float, 9> a;
+                    std::array<float, 9> b;
+                    std::copy(v, v + 9, a.begin());
+                    std::copy(v + 9, v + 18, b.begin());
+                    checksum += Sum((Matrix3D(a) * Matrix3D(b)).ToArray());
+                    break;
+                }
+                case TraceOp::MultiplyMatrix4D: {
+                    std::array<float, 16> a;
+                    std::array<float, 16> b;
+                    std::copy(v, v + 16, a.begin());
+                    std::copy(v + 16, v + 32, b.begin());
+                    checksum += Sum((Matrix4D(a) * Matrix4D(b)).ToArray());
+                    break;
+                }
+                case TraceOp::InverseMatrix4D: {
+                    std::array<float, 16> m;
+                    std::copy(v, v + 16, m.begin());
+                    checksum += Sum(Matrix4D(m).Inverse().ToArray());
+                    break;
+                }
+                case TraceOp::TransformPointMatrix4D: {
+                    std::array<float, 16> m;
+                    std::copy(v, v + 16, m.begin());
+                    const Vector3D result = Matrix4D(m).TransformPoint(Vector3D(v[16], v[17], v[18]));
+                    checksum += static_cast<double>(result.x) + result.y + result.z;
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        return checksum;
+    }
+
+} // namespace Math
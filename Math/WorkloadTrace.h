@@ -0,0 +1,228 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef WORKLOAD_TRACE_H
+#define WORKLOAD_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "MathFwd.h"
+
+namespace Math {
+
+    /**
+     * @brief Operations stored in a workload trace.
+     */
+    enum class TraceOp : std::uint8_t {
+        CreateTransform,        ///< id, parent, position, rotation, scale
+        DestroyTransform,       ///< id
+        SetPosition,            ///< id, position
+        SetRotation,            ///< id, radians
+        SetScale,               ///< id, scale
+        Translate,              ///< id, translation
+        Rotate,                 ///< id, radians
+        SetParent,              ///< id, parent
+        GetWorldMatrix,         ///< id
+        TransformPoint,         ///< id, point
+        InverseTransformPoint,  ///< id, point
+        MultiplyMatrix3D,       ///< two 3x3 matrices
+        MultiplyMatrix4D,       ///< two 4x4 matrices
+        InverseMatrix4D,        ///< one 4x4 matrix
+        TransformPointMatrix4D, ///< one 4x4 matrix, point
+        Count
+    };
+
+    /**
+     * @class WorkloadRecorder
+     * @brief Captures a sequence of transform edits, hierarchy changes and queries as a binary trace.
+     *
+     * Application code routes the calls it wants to capture through the recorder, which
+     * performs the call on the real object and appends it to the trace, so the trace cannot
+     * diverge from what actually ran. Transforms are identified by a small integer assigned
+     * by RegisterTransform; their addresses are not stored.
+     *
+     * Trace format: the magic "MWTR", a 16-bit little-endian version and 16 reserved bits,
+     * followed by one record per operation: the TraceOp byte, transform ids as LEB128
+     * varints (0 means no transform) and floats as 4 little-endian bytes.
+     *
+     * The recorder is not thread-safe; use one recorder per thread.
+     */
+    class WorkloadRecorder {
+    private:
+        std::vector<std::uint8_t> m_Data;
+        std::unordered_map<const Transform2D*, std::uint32_t> m_Ids;
+        std::uint32_t m_NextId = 1;
+        std::size_t m_OperationCount = 0;
+        double m_Checksum = 0.0;
+
+        void WriteOp(TraceOp op);
+        void WriteId(std::uint32_t id);
+        void WriteFloat(float value);
+        void WriteVector(const Vector2D& value);
+
+        /**
+         * @brief Gets the id of a registered transform, or 0 for nullptr.
+         * @throws std::invalid_argument if the transform was not registered
+         */
+        std::uint32_t IdOf(const Transform2D* transform) const;
+
+    public:
+        /**
+         * @brief Creates an empty trace.
+         */
+        WorkloadRecorder();
+
+        // Lifetime and hierarchy
+
+        /**
+         * @brief Starts tracking a transform and records its current local state and parent.
+         * @param transform The transform; its parent, if any, must already be registered
+         * @throws std::invalid_argument if the transform is already registered or its parent is not
+         */
+        void RegisterTransform(const Transform2D& transform);
+
+        /**
+         * @brief Stops tracking a transform, e.g. right before it is destroyed.
+         * @throws std::invalid_argument if the transform is not registered
+         */
+        void UnregisterTransform(const Transform2D& transform);
+
+        /**
+         * @brief Calls transform.SetParent(parent) and records it.
+         * @throws std::invalid_argument if either transform is not registered
+         */
+        void SetParent(Transform2D& transform, Transform2D* parent);
+
+        // Edits
+
+        /** @brief Calls transform.SetPosition(position) and records it. */
+        void SetPosition(Transform2D& transform, const Vector2D& position);
+
+        /** @brief Calls transform.SetRotationRad(radians) and records it. */
+        void SetRotationRad(Transform2D& transform, float radians);
+
+        /** @brief Calls transform.SetScale(scale) and records it. */
+        void SetScale(Transform2D& transform, const Vector2D& scale);
+
+        /** @brief Calls transform.Translate(translation) and records it. */
+        void Translate(Transform2D& transform, const Vector2D& translation);
+
+        /** @brief Calls transform.RotateRad(radians) and records it. */
+        void RotateRad(Transform2D& transform, float radians);
+
+        // Queries
+
+        /** @brief Returns transform.GetWorldMatrix() and records the query. */
+        Matrix3D GetWorldMatrix(const Transform2D& transform);
+
+        /** @brief Returns transform.TransformPoint(point) and records the query. */
+        Vector2D TransformPoint(const Transform2D& transform, const Vector2D& point);
+
+        /** @brief Returns transform.InverseTransformPoint(point) and records the query. */
+        Vector2D InverseTransformPoint(const Transform2D& transform, const Vector2D& point);
+
+        /** @brief Returns a * b and records the operation. */
+        Matrix3D Multiply(const Matrix3D& a, const Matrix3D& b);
+
+        /** @brief Returns a * b and records the operation. */
+        Matrix4D Multiply(const Matrix4D& a, const Matrix4D& b);
+
+        /**
+         * @brief Returns matrix.Inverse() and records the operation.
+         * @throws std::runtime_error if the matrix is singular (nothing is recorded)
+         */
+        Matrix4D Inverse(const Matrix4D& matrix);
+
+        /** @brief Returns matrix.TransformPoint(point) and records the operation. */
+        Vector3D TransformPoint(const Matrix4D& matrix, const Vector3D& point);
+
+        // Output
+
+        /**
+         * @brief Gets the number of recorded operations.
+         */
+        [[nodiscard]] std::size_t GetOperationCount() const;
+
+        /**
+         * @brief Gets the sum of every query result so far.
+         *
+         * Replaying the trace produces the same checksum, which confirms the replay
+         * performed the same work.
+         */
+        [[nodiscard]] double GetChecksum() const;
+
+        /**
+         * @brief Gets the encoded trace.
+         */
+        [[nodiscard]] const std::vector<std::uint8_t>& GetData() const;
+
+        /**
+         * @brief Writes the trace to a file.
+         * @throws std::runtime_error if the file cannot be written
+         */
+        void Save(const std::string& path) const;
+    };
+
+    /**
+     * @class WorkloadTrace
+     * @brief A decoded workload trace that can be replayed against the library.
+     *
+     * The trace is decoded and validated once on construction, so Replay only spends time
+     * in the library calls themselves.
+     */
+    class WorkloadTrace {
+    private:
+        struct Operation {
+            TraceOp op;
+            std::uint32_t id;
+            std::uint32_t other;
+
+            /** Index of the first float argument in m_Values */
+            std::uint32_t firstValue;
+        };
+
+        std::vector<Operation> m_Operations;
+        std::vector<float> m_Values;
+
+        /** Number of transform slots Replay needs */
+        std::uint32_t m_IdCount = 0;
+
+    public:
+        /**
+         * @brief Decodes a trace.
+         * @param data Encoded trace, as produced by WorkloadRecorder
+         * @throws std::invalid_argument if the data is not a valid trace
+         */
+        explicit WorkloadTrace(const std::vector<std::uint8_t>& data);
+
+        /**
+         * @brief Reads and decodes a trace file.
+         * @throws std::runtime_error if the file cannot be read
+         * @throws std::invalid_argument if the file is not a valid trace
+         */
+        static WorkloadTrace Load(const std::string& path);
+
+        /**
+         * @brief Gets the number of operations in the trace.
+         */
+        [[nodiscard]] std::size_t GetOperationCount() const;
+
+        /**
+         * @brief Executes every operation against fresh Transform2D objects.
+         *
+         * Destroyed transforms are kept alive until the replay ends, so a child whose
+         * parent was unregistered without being detached never points to freed memory.
+         *
+         * @return The checksum of all query results, equal to WorkloadRecorder::GetChecksum()
+         */
+        double Replay() const;
+    };
+
+} // namespace Math
+
+#endif // WORKLOAD_TRACE_H
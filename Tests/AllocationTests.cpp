@@ -0,0 +1,284 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <charconv>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <streambuf>
+#include <vector>
+
+#include "AllocationTests.h"
+#include "AllocationTracker.h"
+#include "TestUtils.h"
+#include "../Math/ClothSolver.h"
+#include "../Math/CrowdSteering.h"
+#include "../Math/Format.h"
+#include "../Math/Matrix2D.h"
+#include "../Math/Matrix2DSimd.h"
+#include "../Math/Matrix3D.h"
+#include "../Math/Matrix4D.h"
+#include "../Math/ParticleSystem.h"
+#include "../Math/TaggedMatrix4D.h"
+#include "../Math/Trace.h"
+#include "../Math/Transform2D.h"
+#include "../Math/TransformHierarchy2D.h"
+#include "../Math/Vector2D.h"
+#include "../Math/Vector3D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    // Keeps results observable so the measured work is not optimized away
+    template <typename T>
+    void consume(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        const volatile unsigned char* sink = reinterpret_cast<const volatile unsigned char*>(&value);
+        (void)*sink;
+#endif
+    }
+
+    // Discards everything written to it without allocating
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int character) override {
+            return character;
+        }
+    };
+
+} // namespace
+
+bool RunAllocationTests() {
+    std::cout << "\n=== Allocation Tests ===\n";
+
+    runTest("Allocation Tracker Counts Allocations", []() {
+        // Direct calls, since optimizers may remove unused new-expressions
+        std::size_t single = countAllocations([]() {
+            ::operator delete(::operator new(sizeof(int)));
+        });
+        std::size_t array = countAllocations([]() {
+            ::operator delete[](::operator new[](64));
+        });
+        std::size_t aligned = countAllocations([]() {
+            ::operator delete(::operator new(64, std::align_val_t(64)), std::align_val_t(64));
+        });
+        std::size_t none = countAllocations([]() {
+            int value = 42;
+            consume(value);
+        });
+        return single == 1 && array == 1 && aligned == 1 && none == 0;
+    });
+
+    runTest("Allocation Free runTest", []() {
+        // runTest calls the test directly instead of through std::function
+        NullBuffer nullBuffer;
+        std::streambuf* const previous = std::cout.rdbuf(&nullBuffer);
+        std::size_t count = countAllocations([]() {
+            runTest("Nested Test", []() { return true; });
+        });
+        std::cout.rdbuf(previous);
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Matrix Multiply & Inverse", []() {
+        Math::Matrix2D a2(1.0f, 2.0f, 3.0f, 4.0f);
+        Math::Matrix3D a3 = Math::Matrix3D::RotationZ(0.5f);
+        Math::Matrix4D a4 = Math::Matrix4D::CreateTransformation(
+            Math::Vector3D(1.0f, 2.0f, 3.0f), Math::Vector3D(0.0f, 1.0f, 0.0f), 0.5f, Math::Vector3D(2.0f, 2.0f, 2.0f));
+        Math::TaggedMatrix4D tagged = Math::TaggedMatrix4D::CreateTranslation(Math::Vector3D(1.0f, 2.0f, 3.0f));
+
+        std::size_t count = countAllocations([&]() {
+            consume(a2 * a2);
+            consume(a2.Inverse());
+            consume(Math::Simd::Multiply(a2, a2));
+            consume(Math::Simd::Inverse(a2));
+            consume(a3 * a3);
+            consume(a3.Inverse());
+            consume(a4 * a4);
+            consume(a4.Inverse());
+            consume(tagged * tagged);
+        });
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Batch Transforms", []() {
+        Math::Transform2D transform(Math::Vector2D(1.0f, 2.0f), 0.5f, Math::Vector2D(2.0f, 3.0f));
+        Math::Matrix2D matrix(0.8f, -0.6f, 0.6f, 0.8f);
+        Math::Matrix4D matrix4D = Math::Matrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f);
+
+        std::vector<Math::Vector2D> points(67, Math::Vector2D(1.0f, -1.0f));
+        std::vector<Math::Vector2D> output(points.size());
+        std::vector<float> xs(67, 1.0f), ys(67, -1.0f), outXs(67), outYs(67);
+        std::vector<Math::Vector3D> points3D(67, Math::Vector3D(1.0f, 2.0f, -3.0f));
+        std::vector<Math::Vector3D> output3D(points3D.size());
+
+        std::size_t count = countAllocations([&]() {
+            transform.TransformPoints(points, output);
+            transform.TransformVectors(points, output);
+            transform.TransformPoints(xs, ys, outXs, outYs);
+            transform.TransformVectors(xs, ys, outXs, outYs);
+            Math::Simd::TransformVectors(matrix, points, output);
+            Math::Simd::TransformVectors(matrix, xs, ys, outXs, outYs);
+            matrix4D.TransformPoints(points3D, output3D);
+            matrix4D.TransformVectors(points3D, output3D);
+        });
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Hierarchy Update", []() {
+        Math::TransformHierarchy2D hierarchy;
+        hierarchy.Reserve(64);
+        Math::Transform2DHandle root = hierarchy.Create(Math::Vector2D(1.0f, 0.0f));
+        Math::Transform2DHandle parent = root;
+        for (int i = 0; i < 63; ++i) {
+            parent = hierarchy.Create(Math::Vector2D(1.0f, 0.0f), 0.1f, Math::Vector2D(1.0f, 1.0f), parent);
+        }
+        hierarchy.UpdateWorldMatrices();
+
+        Math::Transform2D parentTransform(Math::Vector2D(1.0f, 2.0f), 0.3f);
+        Math::Transform2D childTransform(Math::Vector2D(3.0f, 4.0f));
+        childTransform.SetParent(&parentTransform);
+
+        std::size_t count = countAllocations([&]() {
+            for (int frame = 0; frame < 4; ++frame) {
+                hierarchy.SetRotationRad(root, 0.1f * frame);
+                hierarchy.Translate(parent, Math::Vector2D(0.5f, 0.0f));
+                for (Math::Vector2D& position : hierarchy.EditPositions()) {
+                    position.y += 0.01f;
+                }
+                hierarchy.UpdateWorldMatrices();
+                hierarchy.RebaseOrigin(Math::Vector2D(0.5f, 0.0f));
+
+                parentTransform.RotateRad(0.1f);
+                consume(childTransform.GetWorldMatrix());
+            }
+        });
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Spatial Queries", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle handle = hierarchy.Create(Math::Vector2D(1.0f, 2.0f), 0.5f);
+        hierarchy.UpdateWorldMatrices();
+
+        Math::Transform2D transform(Math::Vector2D(1.0f, 2.0f), 0.5f, Math::Vector2D(2.0f, 3.0f));
+        Math::Matrix4D matrix = Math::Matrix4D::CreateLookAt(
+            Math::Vector3D(0.0f, 0.0f, 5.0f), Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(0.0f, 1.0f, 0.0f));
+        Math::Vector3D a(1.0f, 2.0f, 3.0f);
+        Math::Vector3D b(-3.0f, 0.5f, 2.0f);
+
+        std::size_t count = countAllocations([&]() {
+            consume(transform.TransformPoint(Math::Vector2D(3.0f, 4.0f)));
+            consume(transform.InverseTransformPoint(Math::Vector2D(3.0f, 4.0f)));
+            consume(hierarchy.GetWorldMatrix(handle));
+            consume(hierarchy.GetIndex(handle));
+            consume(matrix.TransformPoint(a));
+            consume(a.GetNormalized());
+            consume(a.Cross(b));
+            consume(a.Dot(b));
+            consume(Math::Vector2D(3.0f, 4.0f).Normalize());
+        });
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Particle Update", []() {
+        Math::ParticleSystem system(4096);
+        Math::ParticleEmitter emitter;
+        emitter.extent = Math::Vector3D(1.0f, 1.0f, 1.0f);
+        emitter.minLifetime = 0.1f;
+        emitter.maxLifetime = 0.5f;
+        emitter.rate = 4000.0f;
+        const std::size_t emitterIndex = system.AddEmitter(emitter);
+        system.AddAttractor({Math::Vector3D(0.0f, 5.0f, 0.0f), 2.0f, 1.0f});
+        system.SetGravity(Math::Vector3D(0.0f, -9.81f, 0.0f));
+
+        std::size_t count = countAllocations([&]() {
+            system.Emit(emitterIndex, 1000);
+            for (int frame = 0; frame < 30; ++frame) {
+                system.Update(1.0f / 60.0f);
+            }
+        });
+        return count == 0 && system.GetCount() > 0;
+    });
+
+    runTest("Zero Allocations: Pooled Crowd Steering", []() {
+        // Enough agents for every thread of the pool to get a chunk
+        constexpr std::size_t AgentCount = 8192;
+        std::vector<float> x(AgentCount), y(AgentCount), vx(AgentCount, 1.0f), vy(AgentCount, 0.0f);
+        for (std::size_t i = 0; i < AgentCount; ++i) {
+            x[i] = static_cast<float>(i % 64);
+            y[i] = static_cast<float>(i / 64);
+        }
+        std::vector<float> fx(AgentCount), fy(AgentCount);
+        Math::CrowdSteering steering;
+        Math::WorkerPool pool(4);
+        const Math::SteeringAgents agents{x, y, vx, vy, {}, {}};
+
+        // The first call sizes the grid and sorted streams
+        steering.ComputeForces(agents, fx, fy, &pool);
+        std::size_t count = countAllocations([&]() {
+            for (int frame = 0; frame < 10; ++frame) {
+                steering.ComputeForces(agents, fx, fy, &pool);
+            }
+        });
+        consume(fx[0]);
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Pooled Cloth Step", []() {
+        // Enough particles and constraints for every color block to be split across the pool
+        Math::ClothSolver solver;
+        solver.AddCloth(Math::Vector3D(0.0f, 3.0f, 0.0f), Math::Vector3D(4.0f, 0.0f, 0.0f),
+                        Math::Vector3D(0.0f, 0.0f, 2.0f), 128, 65);
+        solver.SetInverseMass(0, 0.0f);
+        solver.SetInverseMass(127, 0.0f);
+        solver.AddSphereCollider({Math::Vector3D(2.0f, 1.0f, 1.0f), 0.75f});
+        Math::WorkerPool pool(4);
+
+        // The first step colors the constraints and sizes the sorted streams
+        solver.Step(1.0f / 60.0f, &pool);
+        std::size_t count = countAllocations([&]() {
+            for (int step = 0; step < 10; ++step) {
+                solver.Step(1.0f / 60.0f, &pool);
+            }
+        });
+        consume(solver.GetPositionsY()[0]);
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Text Formatting", []() {
+        Math::Matrix4D matrix = Math::Matrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f);
+        char buffer[Math::MaxFormattedSize<Math::Matrix4D>];
+
+        std::size_t count = countAllocations([&]() {
+            std::to_chars_result written = Math::ToChars(buffer, buffer + sizeof(buffer), matrix);
+            Math::Matrix4D parsed;
+            Math::FromChars(buffer, written.ptr, parsed);
+            consume(parsed);
+        });
+        return count == 0;
+    });
+
+    runTest("Zero Allocations: Trace Markers", []() {
+        // The first event of a thread creates its buffer; later events must not allocate
+        Math::Trace::SetEnabled(true);
+        {
+            Math::Trace::ScopedEvent warmUp("AllocationTest::WarmUp");
+        }
+        std::size_t count = countAllocations([]() {
+            for (int i = 0; i < 16; ++i) {
+                Math::Trace::ScopedEvent event("AllocationTest::Event");
+            }
+        });
+        Math::Trace::SetEnabled(false);
+        std::ostringstream discarded;
+        Math::Trace::WriteChromeJson(discarded);
+        return count == 0;
+    });
+
+    std::cout << "\n=== End of Allocation Tests ===\n";
+    return true;
+}
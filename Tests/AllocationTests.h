@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef ALLOCATION_TESTS_H
+#define ALLOCATION_TESTS_H
+
+// Function to run zero-allocation tests of hot operations
+bool RunAllocationTests();
+
+#endif // ALLOCATION_TESTS_H
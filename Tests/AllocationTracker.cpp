@@ -0,0 +1,88 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    // Constant-initialized, so counting works during static initialization as well
+    thread_local std::size_t t_AllocationCount = 0;
+
+    void* allocate(std::size_t size) {
+        ++t_AllocationCount;
+        if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        ++t_AllocationCount;
+        const std::size_t align = static_cast<std::size_t>(alignment);
+        // aligned_alloc needs the size to be a multiple of the alignment
+        const std::size_t rounded = (size + align - 1) / align * align;
+        if (void* pointer = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+} // namespace
+
+std::size_t allocationCount() {
+    return t_AllocationCount;
+}
+
+// Replacements of the global allocation functions. The nothrow forms are not replaced;
+// their default versions call the throwing ones below.
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
@@ -0,0 +1,25 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+#include <cstddef>
+
+// The test executable replaces the global operator new and delete (AllocationTracker.cpp)
+// to count heap allocations made by the calling thread, so tests can assert that hot
+// operations never allocate.
+
+// Number of allocations made by the calling thread since it started
+std::size_t allocationCount();
+
+// Runs a function and returns the number of heap allocations it made on the calling thread
+template <typename Func>
+std::size_t countAllocations(Func&& func) {
+    const std::size_t before = allocationCount();
+    func();
+    return allocationCount() - before;
+}
+
+#endif // ALLOCATION_TRACKER_H
@@ -0,0 +1,228 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "ClothSolverTests.h"
+#include "TestUtils.h"
+#include "../Math/ClothSolver.h"
+#include "../Math/Vector3D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    // Compares every position bit for bit
+    bool SamePositions(const Math::ClothSolver& a, const Math::ClothSolver& b) {
+        for (std::size_t i = 0; i < a.GetParticleCount(); ++i) {
+            if (std::bit_cast<std::uint32_t>(a.GetPositionsX()[i]) != std::bit_cast<std::uint32_t>(b.GetPositionsX()[i]) ||
+                std::bit_cast<std::uint32_t>(a.GetPositionsY()[i]) != std::bit_cast<std::uint32_t>(b.GetPositionsY()[i]) ||
+                std::bit_cast<std::uint32_t>(a.GetPositionsZ()[i]) != std::bit_cast<std::uint32_t>(b.GetPositionsZ()[i])) {
+                return false;
+            }
+        }
+        return a.GetParticleCount() == b.GetParticleCount();
+    }
+
+    // Hangs a horizontal cantilever rope from its first two particles and returns how far the free end drops
+    float RopeDroop(float bendingStiffness) {
+        Math::ClothSolver solver;
+        const std::uint32_t first = solver.AddRope(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(2.0f, 0.0f, 0.0f),
+                                                   10, 1.0f, bendingStiffness);
+        solver.SetInverseMass(first, 0.0f);
+        solver.SetInverseMass(first + 1, 0.0f);
+        solver.SetIterations(20);
+        for (int step = 0; step < 120; ++step) {
+            solver.Step(1.0f / 60.0f);
+        }
+        return -solver.GetPosition(first + 10).y;
+    }
+
+} // namespace
+
+bool RunClothSolverTests() {
+    std::cout << "\n=== ClothSolver Tests ===\n";
+
+    // Test the constraints are grouped into colors with no particle twice in a color
+    runTest("ClothSolver Coloring", []() {
+        Math::ClothSolver solver;
+        solver.AddCloth(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 0.0f, 0.0f),
+                        Math::Vector3D(0.0f, 0.0f, 1.0f), 12, 9);
+        // 11 * 9 + 12 * 8 structural links and 2 * 11 * 8 shear links
+        if (solver.GetDistanceConstraintCount() != 371 || solver.GetBendingConstraintCount() != 10 * 9 + 12 * 7) {
+            return false;
+        }
+
+        std::vector<std::vector<bool>> used;
+        std::uint32_t lastColor = 0;
+        for (std::size_t i = 0; i < solver.GetDistanceConstraintCount(); ++i) {
+            const Math::ClothDistanceConstraint constraint = solver.GetDistanceConstraint(i);
+            if (constraint.color < lastColor || !(constraint.restLength > 0.0f)) {
+                return false;
+            }
+            lastColor = constraint.color;
+            if (used.size() <= constraint.color) {
+                used.resize(constraint.color + 1, std::vector<bool>(solver.GetParticleCount(), false));
+            }
+            std::vector<bool>& particles = used[constraint.color];
+            if (particles[constraint.a] || particles[constraint.b]) {
+                return false;
+            }
+            particles[constraint.a] = particles[constraint.b] = true;
+        }
+        // A grid with diagonals needs at least 8 distance colors
+        return used.size() >= 8 && used.size() <= 12 && solver.GetColorCount() > used.size();
+    });
+
+    // Test a hanging rope keeps its segment lengths and its pinned end stays put
+    runTest("ClothSolver Hanging Rope", []() {
+        Math::ClothSolver solver;
+        const std::uint32_t first = solver.AddRope(Math::Vector3D(0.0f, 5.0f, 0.0f), Math::Vector3D(3.0f, 5.0f, 0.0f), 12);
+        solver.SetInverseMass(first, 0.0f);
+        solver.SetIterations(30);
+        for (int step = 0; step < 600; ++step) {
+            solver.Step(1.0f / 60.0f);
+        }
+
+        bool lengths = true;
+        for (std::uint32_t i = 0; i < 12; ++i) {
+            const float length = (solver.GetPosition(first + i + 1) - solver.GetPosition(first + i)).Length();
+            lengths = lengths && std::fabs(length - 0.25f) < 0.25f * 0.02f;
+        }
+        // Damped, the rope ends up hanging straight down
+        const Math::Vector3D end = solver.GetPosition(first + 12);
+        return lengths && solver.GetPosition(first).x == 0.0f && solver.GetPosition(first).y == 5.0f &&
+               std::fabs(end.x) < 0.1f && end.y < 2.1f;
+    });
+
+    // Test many ropes hanging from one pinned anchor, which needs more than 64 colors of each kind
+    runTest("ClothSolver Shared Anchor", []() {
+        constexpr std::uint32_t RopeCount = 70;
+        Math::ClothSolver solver;
+        const std::uint32_t anchor = solver.AddParticle(Math::Vector3D(0.0f, 5.0f, 0.0f), 0.0f);
+        std::vector<std::uint32_t> firsts;
+        for (std::uint32_t rope = 0; rope < RopeCount; ++rope) {
+            const float angle = static_cast<float>(rope) * 0.09f;
+            const Math::Vector3D direction(std::cos(angle), 0.0f, std::sin(angle));
+            const std::uint32_t first = solver.AddRope(Math::Vector3D(0.0f, 5.0f, 0.0f) + direction * 0.25f,
+                                                       Math::Vector3D(0.0f, 5.0f, 0.0f) + direction * 1.25f, 4);
+            solver.AddDistanceConstraint(anchor, first);
+            solver.AddBendingConstraint(anchor, first, first + 1, 0.1f);
+            firsts.push_back(first);
+        }
+        if (solver.GetColorCount() < 2 * RopeCount) {
+            return false;
+        }
+        solver.SetIterations(20);
+        for (int step = 0; step < 300; ++step) {
+            solver.Step(1.0f / 60.0f);
+        }
+
+        bool hanging = true;
+        for (const std::uint32_t first : firsts) {
+            const float length = (solver.GetPosition(first) - solver.GetPosition(anchor)).Length();
+            hanging = hanging && std::fabs(length - 0.25f) < 0.25f * 0.05f && solver.GetPosition(first + 4).y < 4.0f;
+        }
+        return hanging && solver.GetPosition(anchor).y == 5.0f;
+    });
+
+    // Test cloth dropped on a sphere resting on a floor does not pass through either
+    runTest("ClothSolver Collisions", []() {
+        Math::ClothSolver solver;
+        solver.AddCloth(Math::Vector3D(-1.5f, 2.0f, -1.5f), Math::Vector3D(3.0f, 0.0f, 0.0f),
+                        Math::Vector3D(0.0f, 0.0f, 3.0f), 25, 25);
+        const Math::ClothSphereCollider sphere{Math::Vector3D(0.0f, 0.5f, 0.0f), 0.5f};
+        solver.AddSphereCollider(sphere);
+        solver.AddPlaneCollider({Math::Vector3D(0.0f, 1.0f, 0.0f), 0.0f});
+        solver.SetCollisionMargin(0.02f);
+
+        bool outside = true;
+        float top = 0.0f;
+        for (int step = 0; step < 240; ++step) {
+            solver.Step(1.0f / 60.0f);
+            for (std::uint32_t i = 0; i < solver.GetParticleCount(); ++i) {
+                const Math::Vector3D position = solver.GetPosition(i);
+                outside = outside && position.y >= 0.0f && (position - sphere.center).Length() >= sphere.radius;
+            }
+            if (step == 59) {
+                top = solver.GetPosition(12 * 25 + 12).y;
+            }
+        }
+        // After a second the middle of the cloth lies on top of the sphere; without friction
+        // the cloth then slides off and ends up flat on the floor
+        return outside && top > 1.0f && top < 1.05f && solver.GetPosition(12 * 25 + 12).y < 0.05f;
+    });
+
+    // Test bending constraints stiffen a rope
+    runTest("ClothSolver Bending", []() {
+        const float limp = RopeDroop(0.0f);
+        const float stiff = RopeDroop(1.0f);
+        return limp > 1.0f && stiff < limp * 0.75f;
+    });
+
+    // Test results are identical on one thread or several
+    runTest("ClothSolver Thread Independent", []() {
+        Math::ClothSolver single;
+        Math::ClothSolver threaded;
+        Math::WorkerPool pool(4);
+        for (Math::ClothSolver* solver : {&single, &threaded}) {
+            solver->AddCloth(Math::Vector3D(0.0f, 3.0f, 0.0f), Math::Vector3D(4.0f, 0.0f, 0.0f),
+                             Math::Vector3D(0.0f, 0.0f, 2.0f), 128, 65);
+            solver->SetInverseMass(0, 0.0f);
+            solver->SetInverseMass(127, 0.0f);
+            solver->AddSphereCollider({Math::Vector3D(2.0f, 1.0f, 1.0f), 0.75f});
+            solver->SetIterations(4);
+        }
+        for (int step = 0; step < 10; ++step) {
+            single.Step(1.0f / 60.0f);
+            threaded.Step(1.0f / 60.0f, &pool);
+        }
+        return SamePositions(single, threaded) && single.GetPosition(0).y == 3.0f;
+    });
+
+    // Test invalid arguments are rejected
+    runTest("ClothSolver Invalid Arguments Throw", []() {
+        Math::ClothSolver solver;
+        const std::uint32_t a = solver.AddParticle(Math::Vector3D(0.0f, 0.0f, 0.0f));
+        int thrown = 0;
+        try {
+            solver.AddParticle(Math::Vector3D(0.0f, 0.0f, 0.0f), -1.0f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            solver.AddDistanceConstraint(a, a);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            solver.AddDistanceConstraint(a, 5);
+        } catch (const std::out_of_range&) {
+            ++thrown;
+        }
+        try {
+            solver.AddCloth(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 0.0f, 0.0f), Math::Vector3D(0.0f, 1.0f, 0.0f), 1, 4);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            solver.AddRope(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 0.0f, 0.0f), 4, 1.5f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            solver.SetIterations(0);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        return thrown == 6 && solver.GetParticleCount() == 1;
+    });
+
+    std::cout << "\n=== End of ClothSolver Tests ===\n";
+    return true;
+}
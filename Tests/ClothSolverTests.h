@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef CLOTH_SOLVER_TESTS_H
+#define CLOTH_SOLVER_TESTS_H
+
+// Function to run ClothSolver tests
+bool RunClothSolverTests();
+
+#endif // CLOTH_SOLVER_TESTS_H
@@ -0,0 +1,246 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "CrowdSteeringTests.h"
+#include "TestUtils.h"
+#include "../Math/CrowdSteering.h"
+#include "../Math/Vector2D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    struct Crowd {
+        std::vector<float> x, y, vx, vy, tx, ty;
+
+        Math::SteeringAgents View() const {
+            return {x, y, vx, vy, tx, ty};
+        }
+    };
+
+    // Agents scattered over a square with random velocities, all seeking the origin
+    Crowd MakeCrowd(std::size_t count, float extent) {
+        Crowd crowd;
+        std::uint32_t state = 7;
+        auto next = [&state]() {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<float>(state >> 8) / static_cast<float>(1u << 23) - 1.0f;
+        };
+        for (std::size_t i = 0; i < count; ++i) {
+            crowd.x.push_back(next() * extent);
+            crowd.y.push_back(next() * extent);
+            crowd.vx.push_back(next() * 3.0f);
+            crowd.vy.push_back(next() * 3.0f);
+            crowd.tx.push_back(0.0f);
+            crowd.ty.push_back(0.0f);
+        }
+        return crowd;
+    }
+
+    Math::Vector2D Steer(const Math::Vector2D& direction, const Math::Vector2D& velocity,
+                         const Math::SteeringSettings& settings) {
+        if (direction.Length() <= 0.0f) {
+            return Math::Vector2D(0.0f, 0.0f);
+        }
+        Math::Vector2D force = direction * (settings.maxSpeed / direction.Length()) - velocity;
+        if (force.Length() > settings.maxForce) {
+            force = force * (settings.maxForce / force.Length());
+        }
+        return force;
+    }
+
+    // Per-agent Vector2D steering with a brute-force neighbor loop
+    Math::Vector2D ReferenceForce(const Crowd& crowd, std::size_t i, const Math::SteeringSettings& settings) {
+        const Math::Vector2D position(crowd.x[i], crowd.y[i]);
+        const Math::Vector2D velocity(crowd.vx[i], crowd.vy[i]);
+        Math::Vector2D separation(0.0f, 0.0f), center(0.0f, 0.0f), heading(0.0f, 0.0f);
+        float count = 0.0f;
+        for (std::size_t j = 0; j < crowd.x.size(); ++j) {
+            const Math::Vector2D offset = position - Math::Vector2D(crowd.x[j], crowd.y[j]);
+            const float d2 = offset.x * offset.x + offset.y * offset.y;
+            if (d2 <= 0.0f) {
+                continue;
+            }
+            if (d2 < settings.neighborRadius * settings.neighborRadius) {
+                center += Math::Vector2D(crowd.x[j], crowd.y[j]);
+                heading += Math::Vector2D(crowd.vx[j], crowd.vy[j]);
+                count += 1.0f;
+            }
+            if (d2 < settings.separationRadius * settings.separationRadius) {
+                separation += offset * (1.0f / d2);
+            }
+        }
+        Math::Vector2D force = Steer(separation, velocity, settings) * settings.separationWeight;
+        if (count > 0.0f) {
+            force += Steer(heading * (1.0f / count), velocity, settings) * settings.alignmentWeight;
+            force += Steer(center * (1.0f / count) - position, velocity, settings) * settings.cohesionWeight;
+        }
+        force += Steer(Math::Vector2D(crowd.tx[i], crowd.ty[i]) - position, velocity, settings) * settings.seekWeight;
+        if (force.Length() > settings.maxForce) {
+            force = force * (settings.maxForce / force.Length());
+        }
+        return force;
+    }
+
+} // namespace
+
+bool RunCrowdSteeringTests() {
+    std::cout << "\n=== CrowdSteering Tests ===\n";
+
+    // Test radius queries against a brute-force search
+    runTest("NeighborGrid2D FindNeighbors", []() {
+        const Crowd crowd = MakeCrowd(500, 20.0f);
+        Math::NeighborGrid2D grid;
+        grid.Build(crowd.x, crowd.y, 2.0f);
+
+        std::vector<std::uint32_t> found;
+        for (std::size_t i = 0; i < crowd.x.size(); i += 37) {
+            const Math::Vector2D center(crowd.x[i], crowd.y[i]);
+            grid.FindNeighbors(center, 3.0f, found);
+            std::vector<std::uint32_t> expected;
+            for (std::size_t j = 0; j < crowd.x.size(); ++j) {
+                const float dx = crowd.x[j] - center.x;
+                const float dy = crowd.y[j] - center.y;
+                if (dx * dx + dy * dy <= 9.0f) {
+                    expected.push_back(static_cast<std::uint32_t>(j));
+                }
+            }
+            std::sort(found.begin(), found.end());
+            if (found != expected) {
+                return false;
+            }
+        }
+        return grid.GetOrder().size() == crowd.x.size();
+    });
+
+    // Test sparse points enlarge the cells instead of allocating a huge grid
+    runTest("NeighborGrid2D Sparse Points", []() {
+        const std::vector<float> xs = {0.0f, 1.0e6f, -1.0e6f};
+        const std::vector<float> ys = {0.0f, 1.0e6f, 5.0f};
+        Math::NeighborGrid2D grid;
+        grid.Build(xs, ys, 1.0f);
+
+        std::vector<std::uint32_t> found;
+        grid.FindNeighbors(Math::Vector2D(1.0e6f, 1.0e6f), 1.0f, found);
+        bool sparse = static_cast<std::size_t>(grid.GetColumns()) * grid.GetRows() <= 28 && grid.GetCellSize() >= 1.0f &&
+                      found == std::vector<std::uint32_t>{1};
+
+        // Points spanning the whole float range still get a small grid
+        grid.Build(std::vector<float>{-3.0e38f, 3.0e38f}, std::vector<float>{3.0e38f, -3.0e38f}, 1.0f);
+        grid.FindNeighbors(Math::Vector2D(3.0e38f, -3.0e38f), 1.0f, found);
+        return sparse && grid.GetColumns() * grid.GetRows() <= 24 && found == std::vector<std::uint32_t>{1};
+    });
+
+    // Test non-finite coordinates are rejected rather than sizing the grid
+    runTest("NeighborGrid2D Rejects Non-Finite Points", []() {
+        Math::NeighborGrid2D grid;
+        int thrown = 0;
+        for (const float bad : {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()}) {
+            try {
+                grid.Build(std::vector<float>{0.0f, bad}, std::vector<float>{0.0f, 1.0f}, 1.0f);
+            } catch (const std::invalid_argument&) {
+                ++thrown;
+            }
+        }
+        try {
+            grid.Build(std::vector<float>{0.0f}, std::vector<float>{0.0f, 1.0f}, 1.0f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        return thrown == 3;
+    });
+
+    // Test the batched forces against per-agent Vector2D steering
+    runTest("CrowdSteering Matches Reference", []() {
+        const Crowd crowd = MakeCrowd(700, 15.0f);
+        Math::CrowdSteering steering;
+        std::vector<float> fx(crowd.x.size()), fy(crowd.x.size());
+        steering.ComputeForces(crowd.View(), fx, fy);
+
+        for (std::size_t i = 0; i < crowd.x.size(); ++i) {
+            const Math::Vector2D expected = ReferenceForce(crowd, i, steering.GetSettings());
+            if (std::fabs(fx[i] - expected.x) > 1e-3f || std::fabs(fy[i] - expected.y) > 1e-3f) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Test the individual behaviors point the right way
+    runTest("CrowdSteering Behaviors", []() {
+        Math::SteeringSettings settings;
+        settings.alignmentWeight = 0.0f;
+        settings.cohesionWeight = 0.0f;
+        Math::CrowdSteering steering(settings);
+
+        // Two close agents at rest push apart; a far third agent only seeks its target
+        const std::vector<float> x = {0.0f, 0.5f, 50.0f};
+        const std::vector<float> y = {0.0f, 0.0f, 50.0f};
+        const std::vector<float> v = {0.0f, 0.0f, 0.0f};
+        const std::vector<float> tx = {0.0f, 0.5f, 60.0f};
+        const std::vector<float> ty = {0.0f, 0.0f, 50.0f};
+        std::vector<float> fx(3), fy(3);
+        steering.ComputeForces({x, y, v, v, tx, ty}, fx, fy);
+        const bool separates = fx[0] < 0.0f && fx[1] > 0.0f && floatEqual(fx[0], -fx[1]) && fy[0] == 0.0f;
+        const bool seeks = fx[2] > 0.0f && fy[2] == 0.0f;
+
+        // Cohesion alone pulls an agent towards its neighbors
+        settings.separationWeight = 0.0f;
+        settings.seekWeight = 0.0f;
+        settings.cohesionWeight = 1.0f;
+        steering.SetSettings(settings);
+        const std::vector<float> cx = {0.0f, 1.5f, 1.5f};
+        const std::vector<float> cy = {0.0f, 1.0f, -1.0f};
+        steering.ComputeForces({cx, cy, v, v, {}, {}}, fx, fy);
+        const bool coheres = fx[0] > 0.0f && floatEqual(fy[0], 0.0f) && fx[1] < 0.0f && fy[1] < 0.0f;
+        return separates && seeks && coheres;
+    });
+
+    // Test threaded computation matches the single-threaded result exactly
+    runTest("CrowdSteering Threaded", []() {
+        const Crowd crowd = MakeCrowd(5000, 40.0f);
+        Math::CrowdSteering steering;
+        std::vector<float> fx(crowd.x.size()), fy(crowd.x.size());
+        std::vector<float> threadedX(crowd.x.size()), threadedY(crowd.x.size());
+        steering.ComputeForces(crowd.View(), fx, fy);
+        Math::WorkerPool pool(4);
+        steering.ComputeForces(crowd.View(), threadedX, threadedY, &pool);
+        return fx == threadedX && fy == threadedY;
+    });
+
+    // Test argument validation and the empty crowd
+    runTest("CrowdSteering Invalid Arguments", []() {
+        Math::SteeringSettings settings;
+        settings.separationRadius = 3.0f;
+        bool threw = false;
+        try {
+            Math::CrowdSteering invalid(settings);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+
+        Math::CrowdSteering steering;
+        const Crowd crowd = MakeCrowd(4, 1.0f);
+        std::vector<float> tooShort(3);
+        bool threwSize = false;
+        try {
+            steering.ComputeForces(crowd.View(), tooShort, tooShort);
+        } catch (const std::invalid_argument&) {
+            threwSize = true;
+        }
+
+        steering.ComputeForces({}, {}, {});
+        return threw && threwSize && steering.GetGrid().GetOrder().empty();
+    });
+
+    std::cout << "\n=== End of CrowdSteering Tests ===\n";
+    return true;
+}
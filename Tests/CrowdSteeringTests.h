@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef CROWD_STEERING_TESTS_H
+#define CROWD_STEERING_TESTS_H
+
+// Function to run CrowdSteering tests
+bool RunCrowdSteeringTests();
+
+#endif // CROWD_STEERING_TESTS_H
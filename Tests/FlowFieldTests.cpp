@@ -0,0 +1,244 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "FlowFieldTests.h"
+#include "TestUtils.h"
+#include "../Math/FlowField.h"
+#include "../Math/Vector2D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    constexpr float Unreachable = std::numeric_limits<float>::infinity();
+
+    // Global 8-connected Dijkstra with the same step and corner rules as FlowField
+    std::vector<float> ReferenceIntegration(const Math::FlowField& field, const std::vector<std::uint32_t>& goals) {
+        const int width = static_cast<int>(field.GetWidth());
+        const int height = static_cast<int>(field.GetHeight());
+        auto passable = [&](int x, int y) {
+            return x >= 0 && y >= 0 && x < width && y < height &&
+                   field.GetCost(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y)) != Math::FlowField::Impassable;
+        };
+
+        std::vector<float> values(static_cast<std::size_t>(width) * height, Unreachable);
+        using Entry = std::pair<float, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        for (const std::uint32_t goal : goals) {
+            if (passable(static_cast<int>(goal) % width, static_cast<int>(goal) / width)) {
+                values[goal] = 0.0f;
+                queue.push({0.0f, static_cast<int>(goal)});
+            }
+        }
+        while (!queue.empty()) {
+            const auto [value, cell] = queue.top();
+            queue.pop();
+            if (value != values[cell]) {
+                continue;
+            }
+            const int x = cell % width;
+            const int y = cell / width;
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const bool diagonal = dx != 0 && dy != 0;
+                    if ((dx == 0 && dy == 0) || !passable(x + dx, y + dy) ||
+                        (diagonal && (!passable(x + dx, y) || !passable(x, y + dy)))) {
+                        continue;
+                    }
+                    const int neighbor = (y + dy) * width + x + dx;
+                    const float cost = static_cast<float>(field.GetCost(static_cast<std::uint32_t>(x + dx),
+                                                                        static_cast<std::uint32_t>(y + dy)));
+                    const float candidate = value + cost * (diagonal ? 1.41421356f : 1.0f);
+                    if (candidate < values[neighbor]) {
+                        values[neighbor] = candidate;
+                        queue.push({candidate, neighbor});
+                    }
+                }
+            }
+        }
+        return values;
+    }
+
+    // Scatters walls and expensive cells over the field
+    void Scatter(Math::FlowField& field, std::uint32_t& state, int count) {
+        for (int i = 0; i < count; ++i) {
+            state = state * 1664525u + 1013904223u;
+            const std::uint32_t x = (state >> 8) % field.GetWidth();
+            state = state * 1664525u + 1013904223u;
+            const std::uint32_t y = (state >> 8) % field.GetHeight();
+            state = state * 1664525u + 1013904223u;
+            const std::uint32_t kind = (state >> 8) % 4;
+            field.SetCost(x, y, kind == 0 ? Math::FlowField::Impassable : static_cast<std::uint8_t>(1 + kind * 3));
+        }
+    }
+
+    bool SameBits(std::span<const float> a, const std::vector<float>& b) {
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            if (std::bit_cast<std::uint32_t>(a[i]) != std::bit_cast<std::uint32_t>(b[i])) {
+                return false;
+            }
+        }
+        return a.size() == b.size();
+    }
+
+} // namespace
+
+bool RunFlowFieldTests() {
+    std::cout << "\n=== FlowField Tests ===\n";
+
+    // Test the tiled solve matches a global Dijkstra, with and without threads
+    runTest("FlowField Matches Dijkstra", []() {
+        Math::FlowField field(83, 61);
+        std::uint32_t state = 5;
+        Scatter(field, state, 1200);
+        field.SetCost(40, 30, 1);
+        field.AddGoal(40, 30);
+        field.AddGoal(2, 58);
+        field.Update();
+        const std::vector<float> expected = ReferenceIntegration(field, {30 * 83 + 40, 58 * 83 + 2});
+
+        Math::FlowField threaded(83, 61);
+        state = 5;
+        Scatter(threaded, state, 1200);
+        threaded.SetCost(40, 30, 1);
+        threaded.AddGoal(40, 30);
+        threaded.AddGoal(2, 58);
+        Math::WorkerPool pool(4);
+        threaded.Update(&pool);
+        return SameBits(field.GetIntegrationField(), expected) && SameBits(threaded.GetIntegrationField(), expected);
+    });
+
+    // Test directions lead downhill and are zero on goals, walls and unreachable cells
+    runTest("FlowField Directions", []() {
+        Math::FlowField field(20, 20);
+        // A closed box around (15, 15)
+        for (std::uint32_t i = 13; i <= 17; ++i) {
+            field.SetCost(i, 13, Math::FlowField::Impassable);
+            field.SetCost(i, 17, Math::FlowField::Impassable);
+            field.SetCost(13, i, Math::FlowField::Impassable);
+            field.SetCost(17, i, Math::FlowField::Impassable);
+        }
+        field.AddGoal(2, 3);
+        field.Update();
+
+        const bool straight = vector2DEqual(field.GetDirection(8, 3), Math::Vector2D(-1.0f, 0.0f));
+        const Math::Vector2D diagonal = field.GetDirection(7, 8);
+        const bool diagonalOk = floatEqual(diagonal.x, -0.70710678f) && floatEqual(diagonal.y, -0.70710678f);
+        const bool zeros = field.GetDirection(2, 3) == Math::Vector2D(0.0f, 0.0f) &&
+                           field.GetDirection(13, 15) == Math::Vector2D(0.0f, 0.0f) &&
+                           field.GetDirection(15, 15) == Math::Vector2D(0.0f, 0.0f);
+        const bool enclosed = field.GetIntegration(15, 15) == Unreachable && floatEqual(field.GetIntegration(2, 3), 0.0f);
+
+        // Following the directions from any reachable cell reaches the goal
+        bool arrives = true;
+        for (std::uint32_t start = 0; start < 20; start += 3) {
+            int x = 19, y = static_cast<int>(start);
+            for (int step = 0; step < 60 && !(x == 2 && y == 3); ++step) {
+                const Math::Vector2D direction = field.GetDirection(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y));
+                x += static_cast<int>(std::lround(direction.x / std::fabs(direction.x == 0.0f ? 1.0f : direction.x)));
+                y += static_cast<int>(std::lround(direction.y / std::fabs(direction.y == 0.0f ? 1.0f : direction.y)));
+            }
+            arrives = arrives && x == 2 && y == 3;
+        }
+        return straight && diagonalOk && zeros && enclosed && arrives;
+    });
+
+    // Test diagonal moves do not cut the corners of walls
+    runTest("FlowField Corner Cutting", []() {
+        Math::FlowField field(3, 3);
+        field.SetCost(1, 0, Math::FlowField::Impassable);
+        field.AddGoal(0, 0);
+        field.Update();
+        // (1, 1) may not reach (0, 0) diagonally past the wall at (1, 0)
+        return floatEqual(field.GetIntegration(1, 1), 2.0f) &&
+               vector2DEqual(field.GetDirection(1, 1), Math::Vector2D(-1.0f, 0.0f));
+    });
+
+    // Test incremental updates after cost edits match a full rebuild exactly, and that a local
+    // edit only re-solves the tiles around it
+    runTest("FlowField Incremental Updates", []() {
+        Math::FlowField field(160, 128);
+        std::uint32_t state = 9;
+        Scatter(field, state, 3000);
+        field.SetCost(5, 5, 1);
+        field.AddGoal(5, 5);
+        const std::size_t fullSolves = field.Update();
+
+        Math::WorkerPool pool(3);
+        bool matches = true;
+        for (int round = 0; round < 6; ++round) {
+            Scatter(field, state, 40);
+            field.SetCost(5, 5, 1);
+            // Open a wall and close a corridor cell in the same batch
+            field.SetCost(static_cast<std::uint32_t>(30 + round), 20, Math::FlowField::Impassable);
+            field.SetCost(static_cast<std::uint32_t>(30 + round), 20, 1);
+            field.SetCost(static_cast<std::uint32_t>(100 + round), 90, Math::FlowField::Impassable);
+            field.Update(round % 2 == 0 ? &pool : nullptr);
+
+            Math::FlowField rebuilt(160, 128);
+            for (std::uint32_t y = 0; y < 128; ++y) {
+                for (std::uint32_t x = 0; x < 160; ++x) {
+                    rebuilt.SetCost(x, y, field.GetCost(x, y));
+                }
+            }
+            rebuilt.AddGoal(5, 5);
+            rebuilt.Update();
+            const std::vector<float> expected(rebuilt.GetIntegrationField().begin(), rebuilt.GetIntegrationField().end());
+            matches = matches && SameBits(field.GetIntegrationField(), expected);
+            for (std::size_t i = 0; i < expected.size(); ++i) {
+                matches = matches && field.GetDirectionField()[i] == rebuilt.GetDirectionField()[i];
+            }
+        }
+
+        // A wall far from the goal only affects the few cells behind it
+        field.SetCost(150, 120, Math::FlowField::Impassable);
+        const std::size_t wallSolves = field.Update();
+        field.SetCost(150, 120, 1);
+        const std::size_t openSolves = field.Update();
+        return matches && wallSolves * 4 < fullSolves && openSolves * 4 < fullSolves;
+    });
+
+    // Test goals, world sampling and argument validation
+    runTest("FlowField Goals And Sampling", []() {
+        Math::FlowField field(10, 4, 2.0f, Math::Vector2D(-10.0f, 0.0f));
+        field.AddGoal(0, 0);
+        field.Update();
+        const bool sampled = vector2DEqual(field.Sample(Math::Vector2D(-5.0f, 1.0f)), Math::Vector2D(-1.0f, 0.0f)) &&
+                             field.Sample(Math::Vector2D(20.0f, 1.0f)) == Math::Vector2D(0.0f, 0.0f);
+
+        // Moving the goal rebuilds the field; a walled-in goal reaches nothing
+        field.ClearGoals();
+        field.AddGoal(9, 3);
+        field.Update();
+        const bool moved = floatEqual(field.GetIntegration(9, 0), 3.0f) && field.GetIntegration(9, 3) == 0.0f;
+        field.SetCost(9, 3, Math::FlowField::Impassable);
+        field.Update();
+        const bool blocked = field.GetIntegration(9, 0) == Unreachable;
+
+        bool threw = false;
+        try {
+            field.SetCost(10, 0, 1);
+        } catch (const std::out_of_range&) {
+            try {
+                field.SetCost(0, 0, 0);
+            } catch (const std::invalid_argument&) {
+                threw = true;
+            }
+        }
+        return sampled && moved && blocked && threw;
+    });
+
+    std::cout << "\n=== End of FlowField Tests ===\n";
+    return true;
+}
@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef FLOW_FIELD_TESTS_H
+#define FLOW_FIELD_TESTS_H
+
+// Function to run FlowField tests
+bool RunFlowFieldTests();
+
+#endif // FLOW_FIELD_TESTS_H
@@ -0,0 +1,180 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+#include "FormatTests.h"
+#include "TestUtils.h"
+#include "../Math/Format.h"
+#include "../Math/Vector2D.h"
+#include "../Math/Vector3D.h"
+#include "../Math/Matrix2D.h"
+#include "../Math/Matrix3D.h"
+#include "../Math/Matrix4D.h"
+#include "../Math/Transform2D.h"
+
+namespace {
+
+    // Formats a value into a stack buffer and returns the written text
+    template <typename T>
+    std::string_view Format(const T& value, char (&buffer)[Math::MaxFormattedSize<T>]) {
+        std::to_chars_result result = Math::ToChars(buffer, buffer + sizeof(buffer), value);
+        if (result.ec != std::errc()) {
+            return {};
+        }
+        return std::string_view(buffer, result.ptr - buffer);
+    }
+
+    // Compares floats bit for bit, so signed zeros and infinities must match exactly
+    bool SameBits(float a, float b) {
+        return std::bit_cast<std::uint32_t>(a) == std::bit_cast<std::uint32_t>(b);
+    }
+
+} // namespace
+
+// Text formatting and parsing tests
+bool RunFormatTests() {
+    std::cout << "\n=== Format Tests ===\n";
+
+    // Formatting tests
+    runTest("Format Vector Text", []() {
+        char buffer2[Math::MaxFormattedSize<Math::Vector2D>];
+        char buffer3[Math::MaxFormattedSize<Math::Vector3D>];
+        return Format(Math::Vector2D(1.5f, -2.0f), buffer2) == "(1.5, -2)" &&
+               Format(Math::Vector3D(0.1f, 0.0f, 1e20f), buffer3) == "(0.1, 0, 1e+20)";
+    });
+
+    runTest("Format Matrix Text", []() {
+        char buffer2[Math::MaxFormattedSize<Math::Matrix2D>];
+        char buffer3[Math::MaxFormattedSize<Math::Matrix3D>];
+        return Format(Math::Matrix2D(1.0f, 2.0f, 3.0f, 4.0f), buffer2) == "[1, 2; 3, 4]" &&
+               Format(Math::Matrix3D::Identity(), buffer3) == "[1, 0, 0; 0, 1, 0; 0, 0, 1]";
+    });
+
+    runTest("Format Transform2D Text", []() {
+        char buffer[Math::MaxFormattedSize<Math::Transform2D>];
+        Math::Transform2D transform(Math::Vector2D(3.0f, -4.0f), 0.25f, Math::Vector2D(2.0f, 0.5f));
+        return Format(transform, buffer) == "{(3, -4), 0.25, (2, 0.5)}";
+    });
+
+    runTest("Format Buffer Too Small", []() {
+        char buffer[8];
+        std::to_chars_result result = Math::ToChars(buffer, buffer + sizeof(buffer), Math::Vector2D(1.25f, 3.5f));
+        return result.ec == std::errc::value_too_large && result.ptr == buffer + sizeof(buffer);
+    });
+
+    runTest("Format Worst Case Fits", []() {
+        // Longest float text in every slot
+        const float worst = -std::numeric_limits<float>::min() * 1.0000001f;
+        Math::Matrix4D matrix(
+            worst, worst, worst, worst,
+            worst, worst, worst, worst,
+            worst, worst, worst, worst,
+            worst, worst, worst, worst
+        );
+        char buffer[Math::MaxFormattedSize<Math::Matrix4D>];
+        return !Format(matrix, buffer).empty();
+    });
+
+    // Parsing tests
+    runTest("Parse Vector and Matrix", []() {
+        constexpr std::string_view vectorText = "( 1.5 ,-2 )";
+        constexpr std::string_view matrixText = "[1, 2;\t3, 4] trailing";
+
+        Math::Vector2D vector;
+        Math::Matrix2D matrix;
+        std::from_chars_result vectorResult = Math::FromChars(vectorText.data(), vectorText.data() + vectorText.size(), vector);
+        std::from_chars_result matrixResult = Math::FromChars(matrixText.data(), matrixText.data() + matrixText.size(), matrix);
+
+        return vectorResult.ec == std::errc() && vectorResult.ptr == vectorText.data() + vectorText.size() &&
+               vector == Math::Vector2D(1.5f, -2.0f) &&
+               matrixResult.ec == std::errc() && std::string_view(matrixResult.ptr) == " trailing" &&
+               matrix == Math::Matrix2D(1.0f, 2.0f, 3.0f, 4.0f);
+    });
+
+    runTest("Parse Malformed Input", []() {
+        constexpr std::string_view inputs[] = {"", "(1, 2", "(1; 2)", "[1, 2, 3, 4]", "(1, x)", "{(1, 2), 0}"};
+
+        for (std::string_view text : inputs) {
+            Math::Matrix2D matrix(9.0f, 9.0f, 9.0f, 9.0f);
+            Math::Vector2D vector(9.0f, 9.0f);
+            Math::Transform2D transform;
+            std::from_chars_result m = Math::FromChars(text.data(), text.data() + text.size(), matrix);
+            std::from_chars_result v = Math::FromChars(text.data(), text.data() + text.size(), vector);
+            std::from_chars_result t = Math::FromChars(text.data(), text.data() + text.size(), transform);
+
+            // Failures report the start of the input and leave the destination untouched
+            if (m.ec == std::errc() || m.ptr != text.data() || matrix.m00 != 9.0f ||
+                v.ec == std::errc() || v.ptr != text.data() || vector.x != 9.0f ||
+                t.ec == std::errc() || t.ptr != text.data()) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Round-trip tests
+    runTest("Format Round Trip Is Exact", []() {
+        // Walk the float range with a stride that hits normals, subnormals and both signs
+        for (std::uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 0x00F0F0F1u) {
+            float value = std::bit_cast<float>(static_cast<std::uint32_t>(bits));
+            if (value != value) {
+                continue; // NaN payloads are not preserved by text
+            }
+
+            Math::Matrix3D matrix(
+                value, -value, 0.1f,
+                1.0f / 3.0f, value * 0.5f, -0.0f,
+                std::numeric_limits<float>::infinity(), std::numeric_limits<float>::denorm_min(), value
+            );
+            char buffer[Math::MaxFormattedSize<Math::Matrix3D>];
+            std::string_view text = Format(matrix, buffer);
+
+            Math::Matrix3D parsed;
+            std::from_chars_result result = Math::FromChars(text.data(), text.data() + text.size(), parsed);
+            if (text.empty() || result.ec != std::errc() || result.ptr != text.data() + text.size() ||
+                std::memcmp(&parsed, &matrix, sizeof(Math::Matrix3D)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    runTest("Format Round Trip All Types", []() {
+        Math::Vector3D vector(1.0f / 3.0f, -0.0f, 6.02214076e23f);
+        Math::Matrix4D matrix = Math::Matrix4D::CreatePerspective(1.1f, 16.0f / 9.0f, 0.1f, 1000.0f);
+        Math::Transform2D transform(Math::Vector2D(0.7f, -1e-7f), 2.0f / 3.0f, Math::Vector2D(1.1f, 3.3f));
+
+        char vectorBuffer[Math::MaxFormattedSize<Math::Vector3D>];
+        char matrixBuffer[Math::MaxFormattedSize<Math::Matrix4D>];
+        char transformBuffer[Math::MaxFormattedSize<Math::Transform2D>];
+        std::string_view vectorText = Format(vector, vectorBuffer);
+        std::string_view matrixText = Format(matrix, matrixBuffer);
+        std::string_view transformText = Format(transform, transformBuffer);
+
+        Math::Vector3D parsedVector;
+        Math::Matrix4D parsedMatrix;
+        Math::Transform2D parsedTransform;
+        bool parsed =
+            Math::FromChars(vectorText.data(), vectorText.data() + vectorText.size(), parsedVector).ec == std::errc() &&
+            Math::FromChars(matrixText.data(), matrixText.data() + matrixText.size(), parsedMatrix).ec == std::errc() &&
+            Math::FromChars(transformText.data(), transformText.data() + transformText.size(), parsedTransform).ec == std::errc();
+
+        return parsed &&
+               SameBits(parsedVector.x, vector.x) && SameBits(parsedVector.y, vector.y) && SameBits(parsedVector.z, vector.z) &&
+               std::memcmp(&parsedMatrix, &matrix, sizeof(Math::Matrix4D)) == 0 &&
+               parsedTransform.GetPosition() == transform.GetPosition() &&
+               SameBits(parsedTransform.GetRotationRad(), transform.GetRotationRad()) &&
+               parsedTransform.GetScale() == transform.GetScale() &&
+               parsedTransform.GetLocalMatrix() == transform.GetLocalMatrix();
+    });
+
+    std::cout << "\n=== End of Format Tests ===\n";
+    return true;
+}
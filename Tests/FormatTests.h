@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef FORMAT_TESTS_H
+#define FORMAT_TESTS_H
+
+// Function to run text formatting and parsing tests
+bool RunFormatTests();
+
+#endif // FORMAT_TESTS_H
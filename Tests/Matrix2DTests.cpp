@@ -3,10 +3,13 @@
 //
 
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 #include "Matrix2DTests.h"
 #include "TestUtils.h"
 #include "../Math/Matrix2D.h"
+#include "../Math/Matrix2DSimd.h"
 
 // Matrix2D tests
 bool RunMatrix2DTests() {
@@ -249,5 +252,70 @@ bool RunMatrix2DTests() {
         return matrix2DEqual(m, Math::Matrix2D(0.0f, -1.0f, 1.0f, 0.0f), 1e-5f);
     });
 
+    // SIMD tests
+    runTest("Matrix2D Simd Multiply", []() {
+        Math::Matrix2D a(1.0f, 2.0f, 3.0f, 4.0f);
+        Math::Matrix2D b(-0.5f, 1.5f, 2.0f, 0.25f);
+        return matrix2DEqual(Math::Simd::Multiply(a, b), a * b, 1e-6f) &&
+               matrix2DEqual(Math::Simd::Multiply(b, a), b * a, 1e-6f);
+    });
+
+    runTest("Matrix2D Simd Determinant & Transpose", []() {
+        Math::Matrix2D m(3.0f, -1.0f, 2.5f, 4.0f);
+        return floatEqual(Math::Simd::Determinant(m), m.Determinant()) &&
+               matrix2DEqual(Math::Simd::Transpose(m), m.Transpose());
+    });
+
+    runTest("Matrix2D Simd Inverse", []() {
+        Math::Matrix2D m(3.0f, -1.0f, 2.5f, 4.0f);
+        bool matches = matrix2DEqual(Math::Simd::Inverse(m), m.Inverse(), 1e-6f);
+
+        try {
+            (void)Math::Simd::Inverse(Math::Matrix2D(1.0f, 2.0f, 2.0f, 4.0f));
+        } catch (const std::runtime_error&) {
+            return matches;
+        }
+        return false;
+    });
+
+    runTest("Matrix2D Simd TransformVectors", []() {
+        Math::Matrix2D m(0.5f, -2.0f, 1.5f, 3.0f);
+
+        // Seven vectors exercise the four-wide loop, the pair loop and the scalar tail
+        std::vector<Math::Vector2D> vectors;
+        for (int i = 0; i < 7; ++i) {
+            vectors.emplace_back(static_cast<float>(i) - 3.0f, 0.5f * static_cast<float>(i));
+        }
+        std::vector<Math::Vector2D> result(vectors.size());
+        Math::Simd::TransformVectors(m, vectors, result);
+
+        std::vector<float> xs, ys;
+        for (const Math::Vector2D& v : vectors) {
+            xs.push_back(v.x);
+            ys.push_back(v.y);
+        }
+        std::vector<float> outXs(xs.size()), outYs(ys.size());
+        Math::Simd::TransformVectors(m, xs, ys, outXs, outYs);
+
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            Math::Vector2D expected = m * vectors[i];
+            if (!vector2DEqual(result[i], expected, 1e-5f) ||
+                !floatEqual(outXs[i], expected.x, 1e-5f) || !floatEqual(outYs[i], expected.y, 1e-5f)) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    runTest("Matrix2D Simd TransformVectors Size Mismatch", []() {
+        std::vector<Math::Vector2D> vectors(3), result(2);
+        try {
+            Math::Simd::TransformVectors(Math::Matrix2D::Identity(), vectors, result);
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    });
+
     return allPassed;
 }
\ No newline at end of file
@@ -334,6 +334,23 @@ bool RunMatrix3DTests() {
         return matrix3DEqual(identity, Math::Matrix3D::Identity(), 1e-5f);
     });
 
+    runTest("Matrix3D Constexpr Inverse", []() {
+        // 2D scale (2, 4) followed by a translation; the inverse is exact in floating point
+        constexpr Math::Matrix3D m(
+            2.0f, 0.0f, 4.0f,
+            0.0f, 4.0f, -8.0f,
+            0.0f, 0.0f, 1.0f
+        );
+        constexpr Math::Matrix3D inverse = m.Inverse();
+
+        static_assert(m.Determinant() == 8.0f);
+        static_assert(inverse.m00 == 0.5f && inverse.m11 == 0.25f && inverse.m22 == 1.0f);
+        static_assert(inverse.m02 == -2.0f && inverse.m12 == 2.0f);
+        static_assert(inverse.m01 == 0.0f && inverse.m20 == 0.0f);
+
+        return matrix3DEqual(m * inverse, Math::Matrix3D::Identity(), 1e-6f);
+    });
+
     runTest("Matrix3D IsInvertible", []() {
         Math::Matrix3D invertible(
             1.0f, 0.0f, 1.0f,
@@ -3,6 +3,8 @@
 //
 
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 #include "Matrix4DTests.h"
 #include "TestUtils.h"
@@ -600,6 +602,39 @@ bool RunMatrix4DTests() {
                transposed.m30 == 4.0f && transposed.m31 == 8.0f && transposed.m32 == 12.0f && transposed.m33 == 16.0f;
     });
 
+    runTest("Matrix4D TransformPoints/Vectors (Batch)", []() {
+        const Math::Matrix4D affine = Math::Matrix4D::CreateTransformation(
+            Math::Vector3D(1.0f, -2.0f, 3.0f), Math::Vector3D(0.0f, 1.0f, 1.0f), 0.7f, Math::Vector3D(2.0f, 1.0f, 0.5f));
+        const Math::Matrix4D projective = Math::Matrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f);
+
+        std::vector<Math::Vector3D> points;
+        for (int i = 0; i < 9; ++i) {
+            points.emplace_back(static_cast<float>(i) - 4.0f, 0.5f * static_cast<float>(i), -1.0f - static_cast<float>(i));
+        }
+
+        for (const Math::Matrix4D& m : {affine, projective}) {
+            std::vector<Math::Vector3D> transformedPoints(points.size());
+            std::vector<Math::Vector3D> transformedVectors(points.size());
+            m.TransformPoints(points, transformedPoints);
+            m.TransformVectors(points, transformedVectors);
+
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                if (!vector3DEqual(transformedPoints[i], m.TransformPoint(points[i])) ||
+                    !vector3DEqual(transformedVectors[i], m.TransformVector(points[i]))) {
+                    return false;
+                }
+            }
+        }
+
+        std::vector<Math::Vector3D> tooShort(points.size() - 1);
+        try {
+            affine.TransformPoints(points, tooShort);
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    });
+
     runTest("Matrix4D Determinant", []() {
         Math::Matrix4D identity = Math::Matrix4D::Identity();
 
@@ -633,6 +668,38 @@ bool RunMatrix4DTests() {
         return matrix4DEqual(product, Math::Matrix4D::Identity());
     });
 
+    runTest("Matrix4D Adjoint & Inverse (General)", []() {
+        Math::Matrix4D m(
+            2.0f, -1.0f, 0.5f, 3.0f,
+            1.0f, 4.0f, -2.0f, 0.0f,
+            0.0f, 1.5f, 3.0f, -1.0f,
+            -2.0f, 0.0f, 1.0f, 5.0f
+        );
+
+        // adj(M) * M = det(M) * I
+        Math::Matrix4D scaledIdentity = m.Adjoint() * m;
+        return matrix4DEqual(scaledIdentity, Math::Matrix4D::Identity() * m.Determinant(), 1e-3f) &&
+               matrix4DEqual(m * m.Inverse(), Math::Matrix4D::Identity(), 1e-5f);
+    });
+
+    runTest("Matrix4D Constexpr Inverse", []() {
+        // Scale (2, 4, 0.5) followed by a translation; the inverse is exact in floating point
+        constexpr Math::Matrix4D m(
+            2.0f, 0.0f, 0.0f, 6.0f,
+            0.0f, 4.0f, 0.0f, -8.0f,
+            0.0f, 0.0f, 0.5f, 1.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        );
+        constexpr Math::Matrix4D inverse = m.Inverse();
+
+        static_assert(m.Determinant() == 4.0f);
+        static_assert(inverse.m00 == 0.5f && inverse.m11 == 0.25f && inverse.m22 == 2.0f && inverse.m33 == 1.0f);
+        static_assert(inverse.m03 == -3.0f && inverse.m13 == 2.0f && inverse.m23 == -2.0f);
+        static_assert(inverse.m01 == 0.0f && inverse.m30 == 0.0f);
+
+        return matrix4DEqual(m * inverse, Math::Matrix4D::Identity());
+    });
+
     runTest("Matrix4D TryInverse", []() {
         Math::Matrix4D invertible(
             4.0f, 0.0f, 0.0f, 0.0f,
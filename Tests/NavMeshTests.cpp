@@ -0,0 +1,225 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "NavMeshTests.h"
+#include "TestUtils.h"
+#include "../Math/NavMesh.h"
+#include "../Math/Vector2D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    // A mesh of unit squares over a grid; cells marked '#' in the layout are left out.
+    // Row 0 of the layout is at the bottom (y = 0).
+    Math::NavMesh MakeGridMesh(const std::vector<const char*>& layout) {
+        const std::uint32_t rows = static_cast<std::uint32_t>(layout.size());
+        std::uint32_t columns = 0;
+        while (layout[0][columns] != '\0') {
+            ++columns;
+        }
+        std::vector<Math::Vector2D> vertices;
+        for (std::uint32_t y = 0; y <= rows; ++y) {
+            for (std::uint32_t x = 0; x <= columns; ++x) {
+                vertices.emplace_back(static_cast<float>(x), static_cast<float>(y));
+            }
+        }
+        std::vector<std::uint32_t> sizes, indices;
+        for (std::uint32_t y = 0; y < rows; ++y) {
+            for (std::uint32_t x = 0; x < columns; ++x) {
+                if (layout[y][x] == '#') {
+                    continue;
+                }
+                const std::uint32_t corner = y * (columns + 1) + x;
+                sizes.push_back(4);
+                indices.insert(indices.end(), {corner, corner + 1, corner + columns + 2, corner + columns + 1});
+            }
+        }
+        return Math::NavMesh(vertices, sizes, indices);
+    }
+
+    float PathLength(const std::vector<Math::Vector2D>& path) {
+        float length = 0.0f;
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            length += (path[i] - path[i - 1]).Length();
+        }
+        return length;
+    }
+
+} // namespace
+
+bool RunNavMeshTests() {
+    std::cout << "\n=== NavMesh Tests ===\n";
+
+    // Test adjacency through shared edges and point location
+    runTest("NavMesh Adjacency And Point Location", []() {
+        const Math::NavMesh mesh = MakeGridMesh({"..", ".#"});
+        // Polygons: 0 = cell (0, 0), 1 = cell (1, 0), 2 = cell (0, 1)
+        const std::span<const std::uint32_t> first = mesh.GetNeighbors(0);
+        const std::span<const std::uint32_t> second = mesh.GetNeighbors(1);
+        const bool adjacency = first[0] == Math::NavMesh::NoPolygon && first[1] == 1 && first[2] == 2 &&
+                               second[2] == Math::NavMesh::NoPolygon && second[3] == 0;
+        const bool located = mesh.FindPolygon(Math::Vector2D(0.5f, 0.5f)) == 0 &&
+                             mesh.FindPolygon(Math::Vector2D(1.5f, 0.5f)) == 1 &&
+                             mesh.FindPolygon(Math::Vector2D(0.5f, 1.9f)) == 2 &&
+                             mesh.FindPolygon(Math::Vector2D(2.0f, 0.0f)) == 1 &&
+                             mesh.FindPolygon(Math::Vector2D(1.5f, 1.5f)) == Math::NavMesh::NoPolygon &&
+                             mesh.FindPolygon(Math::Vector2D(-0.1f, 0.5f)) == Math::NavMesh::NoPolygon;
+        return mesh.GetPolygonCount() == 3 && adjacency && located;
+    });
+
+    // Test invalid polygons are rejected
+    runTest("NavMesh Invalid Polygons", []() {
+        const std::vector<Math::Vector2D> vertices = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}, {0.5f, 0.2f}};
+        auto rejects = [&](std::vector<std::uint32_t> sizes, std::vector<std::uint32_t> indices) {
+            try {
+                Math::NavMesh mesh(vertices, sizes, indices);
+            } catch (const std::invalid_argument&) {
+                return true;
+            }
+            return false;
+        };
+        return rejects({3}, {0, 2, 1}) &&                      // clockwise
+               rejects({4}, {0, 1, 4, 3}) &&                   // not convex (reflex at 4)
+               rejects({3}, {0, 1, 7}) &&                      // index out of range
+               rejects({2}, {0, 1}) &&                         // too few vertices
+               rejects({3, 3, 3}, {0, 1, 2, 0, 2, 3, 2, 0, 4}); // edge 0-2 used three times
+    });
+
+    // Test a path with a clear line of sight is a straight segment
+    runTest("NavMesh Straight Path", []() {
+        const Math::NavMesh mesh = MakeGridMesh({"....", "....", "...."});
+        Math::NavMeshQuery query(mesh);
+        std::vector<Math::Vector2D> path;
+        std::vector<std::uint32_t> corridor;
+        const bool found = query.FindPath(Math::Vector2D(0.2f, 0.3f), Math::Vector2D(3.7f, 2.6f), path, corridor);
+        return found && path.size() == 2 && corridor.size() >= 4 && corridor.front() == 0 && corridor.back() == 11;
+    });
+
+    // Test the path bends exactly around the corners of an obstacle
+    runTest("NavMesh Funnel Around Obstacle", []() {
+        const Math::NavMesh mesh = MakeGridMesh({
+            ".....",
+            "..#..",
+            "..#..",
+            "..#..",
+            ".....",
+        });
+        Math::NavMeshQuery query(mesh);
+        std::vector<Math::Vector2D> path;
+        std::vector<std::uint32_t> corridor;
+        // From left of the wall to right of it, slightly below the middle: the path goes
+        // under the wall, touching its two bottom corners
+        const bool found = query.FindPath(Math::Vector2D(1.5f, 2.4f), Math::Vector2D(3.5f, 2.4f), path, corridor);
+        const float expected = 2.0f * std::sqrt(0.25f + 1.4f * 1.4f) + 1.0f;
+        return found && path.size() == 4 && vector2DEqual(path[1], Math::Vector2D(2.0f, 1.0f)) &&
+               vector2DEqual(path[2], Math::Vector2D(3.0f, 1.0f)) && floatEqual(PathLength(path), expected);
+    });
+
+    // Test a winding corridor gives a path no longer than the portal midpoints and with
+    // every corner on a mesh vertex
+    runTest("NavMesh Winding Corridor", []() {
+        const Math::NavMesh mesh = MakeGridMesh({
+            ".....#....",
+            ".###.#.##.",
+            ".#...#..#.",
+            ".#.####.#.",
+            ".#......#.",
+            ".########.",
+            "..........",
+        });
+        Math::NavMeshQuery query(mesh);
+        std::vector<Math::Vector2D> path;
+        std::vector<std::uint32_t> corridor;
+        const Math::Vector2D start(2.5f, 2.5f);
+        const Math::Vector2D end(6.5f, 0.5f);
+        if (!query.FindPath(start, end, path, corridor)) {
+            return false;
+        }
+
+        std::vector<Math::Vector2D> midpoints = {start};
+        for (std::size_t i = 0; i + 1 < corridor.size(); ++i) {
+            const std::span<const std::uint32_t> neighbors = mesh.GetNeighbors(corridor[i]);
+            const std::span<const std::uint32_t> polygon = mesh.GetPolygon(corridor[i]);
+            for (std::size_t j = 0; j < neighbors.size(); ++j) {
+                if (neighbors[j] == corridor[i + 1]) {
+                    midpoints.push_back((mesh.GetVertices()[polygon[j]] + mesh.GetVertices()[polygon[(j + 1) % 4]]) * 0.5f);
+                }
+            }
+        }
+        midpoints.push_back(end);
+
+        bool cornersOnVertices = true;
+        for (std::size_t i = 1; i + 1 < path.size(); ++i) {
+            cornersOnVertices = cornersOnVertices && path[i].x == std::floor(path[i].x) && path[i].y == std::floor(path[i].y);
+        }
+        return path.size() > 2 && cornersOnVertices && PathLength(path) < PathLength(midpoints) &&
+               vector2DEqual(path.front(), start) && vector2DEqual(path.back(), end);
+    });
+
+    // Test unreachable and off-mesh requests fail, and queries can be reused after failing
+    runTest("NavMesh Unreachable", []() {
+        const Math::NavMesh mesh = MakeGridMesh({"..#..", "..#.."});
+        Math::NavMeshQuery query(mesh);
+        std::vector<Math::Vector2D> path;
+        std::vector<std::uint32_t> corridor;
+        const bool island = query.FindPath(Math::Vector2D(0.5f, 0.5f), Math::Vector2D(4.5f, 0.5f), path, corridor);
+        const bool offMesh = query.FindPath(Math::Vector2D(2.5f, 0.5f), Math::Vector2D(0.5f, 0.5f), path, corridor);
+        const bool reused = query.FindPath(Math::Vector2D(0.5f, 0.5f), Math::Vector2D(1.5f, 0.7f), path, corridor);
+        return !island && !offMesh && reused && path.size() == 2;
+    });
+
+    // Test batched requests match single queries, with and without threads
+    runTest("NavMesh Batch Paths", []() {
+        const Math::NavMesh mesh = MakeGridMesh({
+            "..........",
+            ".##.###.#.",
+            "....#.....",
+            ".#.##.##.#",
+            "......#...",
+            "#.###.#.#.",
+            "..........",
+        });
+        std::vector<Math::NavPathRequest> requests;
+        std::uint32_t state = 3;
+        for (int i = 0; i < 200; ++i) {
+            state = state * 1664525u + 1013904223u;
+            const float a = static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+            state = state * 1664525u + 1013904223u;
+            const float b = static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+            state = state * 1664525u + 1013904223u;
+            const float c = static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+            state = state * 1664525u + 1013904223u;
+            const float d = static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+            requests.push_back({Math::Vector2D(a * 10.0f, b * 7.0f), Math::Vector2D(c * 10.0f, d * 7.0f)});
+        }
+
+        std::vector<std::vector<Math::Vector2D>> single(requests.size()), threaded(requests.size());
+        const std::size_t found = mesh.FindPaths(requests, single);
+        Math::WorkerPool pool(4);
+        const std::size_t threadedFound = mesh.FindPaths(requests, threaded, &pool);
+
+        Math::NavMeshQuery query(mesh);
+        std::vector<Math::Vector2D> path;
+        std::vector<std::uint32_t> corridor;
+        std::size_t expectedFound = 0;
+        bool same = true;
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            expectedFound += query.FindPath(requests[i].start, requests[i].end, path, corridor) ? 1 : 0;
+            same = same && path.size() == single[i].size() && path.size() == threaded[i].size();
+            for (std::size_t j = 0; same && j < path.size(); ++j) {
+                same = path[j] == single[i][j] && path[j] == threaded[i][j];
+            }
+        }
+        return same && found == expectedFound && threadedFound == expectedFound && found > 50;
+    });
+
+    std::cout << "\n=== End of NavMesh Tests ===\n";
+    return true;
+}
@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef NAV_MESH_TESTS_H
+#define NAV_MESH_TESTS_H
+
+// Function to run NavMesh tests
+bool RunNavMeshTests();
+
+#endif // NAV_MESH_TESTS_H
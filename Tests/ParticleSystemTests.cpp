@@ -0,0 +1,211 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+#include "ParticleSystemTests.h"
+#include "TestUtils.h"
+#include "../Math/ParticleSystem.h"
+#include "../Math/Vector3D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    Math::ParticleEmitter MakeFountain() {
+        Math::ParticleEmitter emitter;
+        emitter.position = Math::Vector3D(1.0f, 2.0f, 3.0f);
+        emitter.extent = Math::Vector3D(0.5f, 0.0f, 0.25f);
+        emitter.velocity = Math::Vector3D(0.0f, 5.0f, 0.0f);
+        emitter.velocitySpread = Math::Vector3D(1.0f, 1.0f, 1.0f);
+        emitter.minLifetime = 1.0f;
+        emitter.maxLifetime = 2.0f;
+        return emitter;
+    }
+
+    // Compares every stream bit for bit
+    bool SameParticles(const Math::ParticleSystem& a, const Math::ParticleSystem& b) {
+        if (a.GetCount() != b.GetCount()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.GetCount(); ++i) {
+            if (std::bit_cast<std::uint32_t>(a.GetPositionsX()[i]) != std::bit_cast<std::uint32_t>(b.GetPositionsX()[i]) ||
+                std::bit_cast<std::uint32_t>(a.GetPositionsY()[i]) != std::bit_cast<std::uint32_t>(b.GetPositionsY()[i]) ||
+                std::bit_cast<std::uint32_t>(a.GetPositionsZ()[i]) != std::bit_cast<std::uint32_t>(b.GetPositionsZ()[i]) ||
+                std::bit_cast<std::uint32_t>(a.GetVelocitiesY()[i]) != std::bit_cast<std::uint32_t>(b.GetVelocitiesY()[i]) ||
+                a.GetAges()[i] != b.GetAges()[i] || a.GetLifetimes()[i] != b.GetLifetimes()[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+bool RunParticleSystemTests() {
+    std::cout << "\n=== ParticleSystem Tests ===\n";
+
+    // Test spawned particles stay within the emitter's ranges and the capacity
+    runTest("ParticleSystem Emit", []() {
+        Math::ParticleSystem system(100);
+        const std::size_t emitter = system.AddEmitter(MakeFountain());
+        const std::size_t spawned = system.Emit(emitter, 80) + system.Emit(emitter, 50);
+
+        bool inRange = true;
+        for (std::size_t i = 0; i < system.GetCount(); ++i) {
+            const Math::Vector3D position = system.GetPosition(i);
+            const Math::Vector3D velocity = system.GetVelocity(i);
+            const float lifetime = system.GetLifetimes()[i];
+            inRange = inRange && std::fabs(position.x - 1.0f) <= 0.5f && position.y == 2.0f &&
+                      std::fabs(position.z - 3.0f) <= 0.25f && std::fabs(velocity.y - 5.0f) <= 1.0f &&
+                      lifetime >= 1.0f && lifetime <= 2.0f && system.GetAges()[i] == 0.0f;
+        }
+        return spawned == 100 && system.GetCount() == 100 && system.GetDroppedSpawnCount() == 30 && inRange;
+    });
+
+    // Test semi-implicit Euler integration under gravity and drag
+    runTest("ParticleSystem Integration", []() {
+        Math::ParticleSystem system(4);
+        Math::ParticleEmitter emitter;
+        emitter.velocity = Math::Vector3D(2.0f, 0.0f, 0.0f);
+        emitter.minLifetime = emitter.maxLifetime = 100.0f;
+        system.Emit(system.AddEmitter(emitter), 1);
+        system.SetGravity(Math::Vector3D(0.0f, -10.0f, 0.0f));
+
+        // v(n) = -10 * dt * n, y(n) = sum of v(1..n) * dt
+        for (int step = 0; step < 10; ++step) {
+            system.Update(0.1f);
+        }
+        bool gravity = floatEqual(system.GetVelocity(0).y, -10.0f, 1e-4f) &&
+                       floatEqual(system.GetPosition(0).y, -5.5f, 1e-4f) &&
+                       floatEqual(system.GetPosition(0).x, 2.0f, 1e-4f) &&
+                       floatEqual(system.GetAges()[0], 1.0f, 1e-5f);
+
+        // Drag of 5/s at dt = 0.1 halves the velocity per step
+        system.SetGravity(Math::Vector3D(0.0f, 0.0f, 0.0f));
+        system.SetDrag(5.0f);
+        system.Update(0.1f);
+        bool drag = floatEqual(system.GetVelocity(0).x, 1.0f, 1e-5f);
+        return gravity && drag;
+    });
+
+    // Test attractors pull particles towards them
+    runTest("ParticleSystem Attractor", []() {
+        Math::ParticleSystem system(16);
+        Math::ParticleEmitter emitter;
+        emitter.extent = Math::Vector3D(1.0f, 1.0f, 1.0f);
+        emitter.minLifetime = emitter.maxLifetime = 10.0f;
+        system.Emit(system.AddEmitter(emitter), 16);
+        system.AddAttractor({Math::Vector3D(10.0f, 0.0f, 0.0f), 50.0f, 0.5f});
+        system.Update(0.01f);
+
+        for (std::size_t i = 0; i < system.GetCount(); ++i) {
+            if (!(system.GetVelocity(i).x > 0.0f)) {
+                return false;
+            }
+        }
+        system.GetAttractor(0).strength = -50.0f;
+        system.ClearAttractors();
+        return system.GetCount() == 16;
+    });
+
+    // Test expired particles are removed and the survivors keep their data
+    runTest("ParticleSystem Removes Expired Particles", []() {
+        Math::ParticleSystem system(1000);
+        Math::ParticleEmitter emitter = MakeFountain();
+        emitter.minLifetime = 0.05f;
+        emitter.maxLifetime = 0.35f;
+        system.Emit(system.AddEmitter(emitter), 1000);
+
+        std::size_t previous = system.GetCount();
+        bool shrinking = true;
+        for (int step = 0; step < 4; ++step) {
+            system.Update(0.1f);
+            shrinking = shrinking && system.GetCount() < previous;
+            previous = system.GetCount();
+            for (std::size_t i = 0; i < system.GetCount(); ++i) {
+                shrinking = shrinking && system.GetAges()[i] < system.GetLifetimes()[i];
+            }
+        }
+        return shrinking && system.GetCount() == 0;
+    });
+
+    // Test emitters spawn at their rate, carrying fractions between updates
+    runTest("ParticleSystem Emitter Rate", []() {
+        Math::ParticleSystem system(1000);
+        Math::ParticleEmitter emitter = MakeFountain();
+        emitter.rate = 30.0f;
+        emitter.minLifetime = emitter.maxLifetime = 100.0f;
+        system.AddEmitter(emitter);
+        for (int step = 0; step < 60; ++step) {
+            system.Update(1.0f / 60.0f);
+        }
+        // Rounding may leave the last fraction just short of a whole particle
+        return system.GetCount() == 30 || system.GetCount() == 29;
+    });
+
+    // Test the same seed reproduces the same particles, on one thread or several
+    runTest("ParticleSystem Deterministic & Thread Independent", []() {
+        constexpr std::size_t Count = 3 * Math::ParticleSystem::MinParticlesPerThread + 5;
+        Math::ParticleSystem single(Count, 7);
+        Math::ParticleSystem threaded(Count, 7);
+        Math::ParticleSystem otherSeed(Count, 8);
+        Math::WorkerPool pool(4);
+        for (Math::ParticleSystem* system : {&single, &threaded, &otherSeed}) {
+            system->Emit(system->AddEmitter(MakeFountain()), Count);
+            system->SetGravity(Math::Vector3D(0.0f, -9.81f, 0.0f));
+            system->SetDrag(0.1f);
+            system->AddAttractor({Math::Vector3D(0.0f, 4.0f, 0.0f), 3.0f, 0.5f});
+        }
+
+        for (int step = 0; step < 90; ++step) {
+            single.Update(1.0f / 60.0f);
+            threaded.Update(1.0f / 60.0f, &pool);
+            otherSeed.Update(1.0f / 60.0f);
+        }
+        return single.GetCount() > 0 && single.GetCount() < Count &&
+               SameParticles(single, threaded) && !SameParticles(single, otherSeed);
+    });
+
+    // Test invalid settings are rejected
+    runTest("ParticleSystem Invalid Settings Throw", []() {
+        Math::ParticleSystem system(10);
+        Math::ParticleEmitter emitter;
+        emitter.minLifetime = 2.0f;
+        emitter.maxLifetime = 1.0f;
+        int thrown = 0;
+        try {
+            system.AddEmitter(emitter);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            system.SetDrag(-1.0f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            system.Emit(0, 1);
+        } catch (const std::out_of_range&) {
+            ++thrown;
+        }
+        try {
+            system.Update(-0.1f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            system.Update(std::nanf(""));
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        return thrown == 5 && system.GetCount() == 0;
+    });
+
+    std::cout << "\n=== End of ParticleSystem Tests ===\n";
+    return true;
+}
@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef PARTICLE_SYSTEM_TESTS_H
+#define PARTICLE_SYSTEM_TESTS_H
+
+// Function to run ParticleSystem tests
+bool RunParticleSystemTests();
+
+#endif // PARTICLE_SYSTEM_TESTS_H
@@ -0,0 +1,140 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
+#include "ScalarMathTests.h"
+#include "TestUtils.h"
+#include "../Math/Constants.h"
+#include "../Math/Matrix3D.h"
+#include "../Math/Matrix4D.h"
+#include "../Math/ScalarMath.h"
+#include "../Math/Transform2D.h"
+#include "../Math/Vector2D.h"
+#include "../Math/Vector3D.h"
+
+namespace {
+
+    std::uint32_t Bits(float value) {
+        return std::bit_cast<std::uint32_t>(value);
+    }
+
+    // FNV-1a over the bit patterns of the results
+    class BitHash {
+    private:
+        std::uint64_t m_Hash = 14695981039346656037ull;
+
+    public:
+        void Add(float value) {
+            std::uint32_t bits = Bits(value);
+            for (int i = 0; i < 4; ++i) {
+                m_Hash = (m_Hash ^ (bits & 0xFF)) * 1099511628211ull;
+                bits >>= 8;
+            }
+        }
+
+        std::uint64_t Get() const {
+            return m_Hash;
+        }
+    };
+
+    // Checks a result against a double-precision reference, allowing one float ulp
+    bool WithinOneUlp(float result, double reference) {
+        const float rounded = static_cast<float>(reference);
+        return result == rounded
+            || result == std::nextafter(rounded, std::numeric_limits<float>::infinity())
+            || result == std::nextafter(rounded, -std::numeric_limits<float>::infinity());
+    }
+
+    // Inputs spread over about fifty periods; computed exactly, so they are the same everywhere
+    float Input(int i) {
+        return static_cast<float>(i - 10000) / 64.0f;
+    }
+
+} // namespace
+
+bool RunScalarMathTests() {
+    std::cout << "\n=== Scalar Math Tests ===\n";
+
+    runTest("Deterministic Sin & Cos Accuracy", []() {
+        for (int i = 0; i <= 20000; ++i) {
+            const float x = Input(i);
+            if (!WithinOneUlp(Math::Deterministic::Sin(x), std::sin(static_cast<double>(x)))
+                || !WithinOneUlp(Math::Deterministic::Cos(x), std::cos(static_cast<double>(x)))) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    runTest("Deterministic SinCos Matches Sin & Cos", []() {
+        for (int i = 0; i <= 20000; ++i) {
+            const float x = Input(i);
+            float sine, cosine;
+            Math::Deterministic::SinCos(x, sine, cosine);
+            if (Bits(sine) != Bits(Math::Deterministic::Sin(x)) || Bits(cosine) != Bits(Math::Deterministic::Cos(x))) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    runTest("Deterministic Tan, Acos & Atan2 Accuracy", []() {
+        for (int i = 0; i <= 2000; ++i) {
+            const float t = static_cast<float>(i) / 1000.0f - 1.0f;
+            const float angle = t * 1.5f;
+            if (!WithinOneUlp(Math::Deterministic::Tan(angle), std::tan(static_cast<double>(angle)))
+                || !WithinOneUlp(Math::Deterministic::Acos(t), std::acos(static_cast<double>(t)))) {
+                return false;
+            }
+            const float y = std::sin(static_cast<float>(i)) * 3.0f;
+            const float x = std::cos(static_cast<float>(i) * 1.7f) * 2.0f;
+            if (!WithinOneUlp(Math::Deterministic::Atan2(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x)))) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    runTest("Deterministic Special Values", []() {
+        const float inf = std::numeric_limits<float>::infinity();
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const float pi = Math::Constants::PI;
+        return Bits(Math::Deterministic::Sin(-0.0f)) == Bits(-0.0f)
+            && Math::Deterministic::Cos(0.0f) == 1.0f
+            && std::isnan(Math::Deterministic::Sin(inf))
+            && std::isnan(Math::Deterministic::Cos(nan))
+            && std::isnan(Math::Deterministic::Acos(1.5f))
+            && Math::Deterministic::Acos(1.0f) == 0.0f
+            && Math::Deterministic::Acos(-1.0f) == pi
+            && Bits(Math::Deterministic::Atan2(0.0f, 0.0f)) == Bits(0.0f)
+            && Bits(Math::Deterministic::Atan2(-0.0f, 1.0f)) == Bits(-0.0f)
+            && Math::Deterministic::Atan2(0.0f, -1.0f) == pi
+            && Math::Deterministic::Atan2(-0.0f, -1.0f) == -pi
+            && Math::Deterministic::Atan2(inf, inf) == pi / 4.0f
+            && Math::Deterministic::Atan2(1.0f, 0.0f) == pi / 2.0f
+            && std::isnan(Math::Deterministic::Atan2(nan, 1.0f));
+    });
+
+    runTest("Deterministic Results Are Bit-Identical", []() {
+        // The hash is the same on every platform; a change means results drifted
+        BitHash hash;
+        for (int i = 0; i <= 20000; ++i) {
+            const float x = Input(i);
+            hash.Add(Math::Deterministic::Sin(x));
+            hash.Add(Math::Deterministic::Cos(x));
+            hash.Add(Math::Deterministic::Tan(x));
+            hash.Add(Math::Deterministic::Acos(std::fmod(x, 1.0f)));
+            hash.Add(Math::Deterministic::Atan2(x, Input(20000 - i)));
+        }
+        return hash.Get() == 0xde72d8349735e3a7ull;
+    });
+
+    std::cout << "\n=== End of Scalar Math Tests ===\n";
+    return true;
+}
@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef SCALAR_MATH_TESTS_H
+#define SCALAR_MATH_TESTS_H
+
+// Function to run trigonometry and deterministic mode tests
+bool RunScalarMathTests();
+
+#endif // SCALAR_MATH_TESTS_H
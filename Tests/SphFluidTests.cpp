@@ -0,0 +1,218 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+#include "SphFluidTests.h"
+#include "TestUtils.h"
+#include "../Math/Constants.h"
+#include "../Math/SphFluid.h"
+#include "../Math/Vector3D.h"
+#include "../Math/WorkerPool.h"
+
+namespace {
+
+    // Deterministic values in [-1, 1)
+    float NextValue(std::uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 8388608.0f - 1.0f;
+    }
+
+    Math::SphSettings Weightless() {
+        Math::SphSettings settings;
+        settings.gravity = Math::Vector3D(0.0f, 0.0f, 0.0f);
+        return settings;
+    }
+
+    // Kinetic energy per unit mass, relative to the mean velocity
+    float RelativeKineticEnergy(const Math::SphFluid& fluid) {
+        Math::Vector3D mean(0.0f, 0.0f, 0.0f);
+        for (std::size_t i = 0; i < fluid.GetCount(); ++i) {
+            mean += fluid.GetVelocity(i);
+        }
+        mean *= 1.0f / static_cast<float>(fluid.GetCount());
+        float energy = 0.0f;
+        for (std::size_t i = 0; i < fluid.GetCount(); ++i) {
+            const Math::Vector3D relative = fluid.GetVelocity(i) - mean;
+            energy += 0.5f * relative.Dot(relative);
+        }
+        return energy;
+    }
+
+} // namespace
+
+bool RunSphFluidTests() {
+    std::cout << "\n=== SphFluid Tests ===\n";
+
+    // Test the default mass gives the rest density inside a lattice at the default spacing
+    runTest("SphFluid Rest Density", []() {
+        Math::SphFluid fluid(Math::Vector3D(-1.0f, -1.0f, -1.0f), Math::Vector3D(1.0f, 1.0f, 1.0f));
+        const std::size_t added = fluid.AddBlock(Math::Vector3D(-0.5f, -0.5f, -0.5f), Math::Vector3D(0.5f, 0.5f, 0.5f), 0.05f);
+        fluid.Step(0.0f);
+
+        bool nearRest = true;
+        for (std::size_t i = 0; i < fluid.GetCount(); ++i) {
+            const Math::Vector3D position = fluid.GetPosition(i);
+            if (std::fabs(position.x) < 0.35f && std::fabs(position.y) < 0.35f && std::fabs(position.z) < 0.35f) {
+                nearRest = nearRest && std::fabs(fluid.GetDensities()[i] - 1000.0f) < 20.0f;
+            }
+        }
+        return added == 21 * 21 * 21 && fluid.GetCount() == added && nearRest;
+    });
+
+    // Test hashed neighbor sums match a brute force sum over all pairs, including negative
+    // coordinates and cells that share buckets
+    runTest("SphFluid Density Matches Brute Force", []() {
+        Math::SphFluid fluid(Math::Vector3D(-2.0f, -2.0f, -2.0f), Math::Vector3D(2.0f, 2.0f, 2.0f), Weightless());
+        std::uint32_t state = 5;
+        for (int i = 0; i < 3000; ++i) {
+            fluid.AddParticle(Math::Vector3D(NextValue(state), NextValue(state), NextValue(state)) * 0.6f);
+        }
+        fluid.Step(0.0f);
+
+        const Math::SphSettings& settings = fluid.GetSettings();
+        const float h2 = settings.smoothingRadius * settings.smoothingRadius;
+        const float h6 = h2 * h2 * h2;
+        const float poly6 = 315.0f / (64.0f * Math::Constants::PI * (h6 * h2 * settings.smoothingRadius));
+        for (std::size_t i = 0; i < fluid.GetCount(); ++i) {
+            double sum = 0.0;
+            for (std::size_t j = 0; j < fluid.GetCount(); ++j) {
+                const Math::Vector3D d = fluid.GetPosition(j) - fluid.GetPosition(i);
+                const float r2 = d.Dot(d);
+                if (r2 < h2) {
+                    const double w = h2 - r2;
+                    sum += w * w * w;
+                }
+            }
+            const double expected = settings.particleMass * poly6 * sum;
+            if (std::fabs(fluid.GetDensities()[i] - expected) > 1e-4 * expected) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Test a compressed blob pushes itself apart
+    runTest("SphFluid Pressure Expands", []() {
+        Math::SphFluid fluid(Math::Vector3D(-1.0f, -1.0f, -1.0f), Math::Vector3D(1.0f, 1.0f, 1.0f), Weightless());
+        fluid.AddBlock(Math::Vector3D(-0.1f, -0.1f, -0.1f), Math::Vector3D(0.1f, 0.1f, 0.1f), 0.025f);
+        const float compressed = fluid.GetPosition(0).Length();
+        for (int step = 0; step < 50; ++step) {
+            fluid.Step(0.002f);
+        }
+        float extent = 0.0f;
+        for (std::size_t i = 0; i < fluid.GetCount(); ++i) {
+            extent = std::fmax(extent, fluid.GetPosition(i).Length());
+        }
+        return fluid.GetDensities()[0] > 0.0f && extent > 1.5f * compressed;
+    });
+
+    // Test viscosity damps the relative motion of the particles
+    runTest("SphFluid Viscosity Damps", []() {
+        float energies[2] = {};
+        for (int viscous = 0; viscous < 2; ++viscous) {
+            Math::SphSettings settings = Weightless();
+            settings.stiffness = 0.0f;
+            settings.viscosity = viscous != 0 ? 10.0f : 0.0f;
+            Math::SphFluid fluid(Math::Vector3D(-1.0f, -1.0f, -1.0f), Math::Vector3D(1.0f, 1.0f, 1.0f), settings);
+            std::uint32_t state = 9;
+            for (int i = 0; i < 1000; ++i) {
+                fluid.AddParticle(Math::Vector3D(NextValue(state), NextValue(state), NextValue(state)) * 0.25f,
+                                  Math::Vector3D(NextValue(state), NextValue(state), NextValue(state)) * 0.1f);
+            }
+            const float initial = RelativeKineticEnergy(fluid);
+            for (int step = 0; step < 20; ++step) {
+                fluid.Step(0.002f);
+            }
+            energies[viscous] = RelativeKineticEnergy(fluid) / initial;
+        }
+        return floatEqual(energies[0], 1.0f, 1e-3f) && energies[1] < 0.5f;
+    });
+
+    // Test a dam break flows out along the floor and stays inside the bounds
+    runTest("SphFluid Dam Break", []() {
+        const Math::Vector3D boundsMax(1.0f, 1.0f, 0.3f);
+        Math::SphFluid fluid(Math::Vector3D(0.0f, 0.0f, 0.0f), boundsMax);
+        fluid.AddBlock(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(0.3f, 0.6f, 0.3f), 0.05f);
+        for (int step = 0; step < 300; ++step) {
+            fluid.Step(0.003f);
+        }
+
+        float centerX = 0.0f, centerY = 0.0f;
+        bool inside = true;
+        for (std::size_t i = 0; i < fluid.GetCount(); ++i) {
+            const Math::Vector3D position = fluid.GetPosition(i);
+            inside = inside && std::isfinite(position.x) && position.x >= 0.0f && position.x <= boundsMax.x &&
+                     position.y >= 0.0f && position.y <= boundsMax.y && position.z >= 0.0f && position.z <= boundsMax.z;
+            centerX += position.x;
+            centerY += position.y;
+        }
+        centerX /= static_cast<float>(fluid.GetCount());
+        centerY /= static_cast<float>(fluid.GetCount());
+        return inside && centerX > 0.3f && centerY < 0.2f;
+    });
+
+    // Test results are identical on one thread or several
+    runTest("SphFluid Thread Independent", []() {
+        Math::SphFluid single(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 1.0f, 1.0f));
+        Math::SphFluid threaded(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 1.0f, 1.0f));
+        Math::WorkerPool pool(4);
+        for (Math::SphFluid* fluid : {&single, &threaded}) {
+            fluid->AddBlock(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(0.6f, 0.6f, 0.6f), 0.04f);
+        }
+        for (int step = 0; step < 10; ++step) {
+            single.Step(0.003f);
+            threaded.Step(0.003f, &pool);
+        }
+        for (std::size_t i = 0; i < single.GetCount(); ++i) {
+            if (std::bit_cast<std::uint32_t>(single.GetPositionsX()[i]) != std::bit_cast<std::uint32_t>(threaded.GetPositionsX()[i]) ||
+                std::bit_cast<std::uint32_t>(single.GetPositionsY()[i]) != std::bit_cast<std::uint32_t>(threaded.GetPositionsY()[i]) ||
+                std::bit_cast<std::uint32_t>(single.GetPositionsZ()[i]) != std::bit_cast<std::uint32_t>(threaded.GetPositionsZ()[i])) {
+                return false;
+            }
+        }
+        return single.GetCount() > 3 * Math::SphFluid::MinParticlesPerThread;
+    });
+
+    // Test invalid arguments are rejected
+    runTest("SphFluid Invalid Arguments Throw", []() {
+        int thrown = 0;
+        try {
+            Math::SphFluid fluid(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 0.0f, 1.0f));
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        Math::SphFluid fluid(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 1.0f, 1.0f));
+        Math::SphSettings settings;
+        settings.smoothingRadius = 0.0f;
+        try {
+            fluid.SetSettings(settings);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            fluid.AddBlock(Math::Vector3D(0.0f, 0.0f, 0.0f), Math::Vector3D(1.0f, 1.0f, 1.0f), 0.0f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            fluid.Step(-1.0f);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            (void)fluid.GetPosition(0);
+        } catch (const std::out_of_range&) {
+            ++thrown;
+        }
+        return thrown == 5 && fluid.GetSettings().smoothingRadius == 0.1f;
+    });
+
+    std::cout << "\n=== End of SphFluid Tests ===\n";
+    return true;
+}
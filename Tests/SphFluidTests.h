@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef SPH_FLUID_TESTS_H
+#define SPH_FLUID_TESTS_H
+
+// Function to run SphFluid tests
+bool RunSphFluidTests();
+
+#endif // SPH_FLUID_TESTS_H
@@ -0,0 +1,144 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <iostream>
+#include <stdexcept>
+
+#include "TaggedMatrix4DTests.h"
+#include "TestUtils.h"
+#include "../Math/TaggedMatrix4D.h"
+#include "../Math/Matrix4D.h"
+#include "../Math/Vector3D.h"
+#include "../Math/Constants.h"
+
+// TaggedMatrix4D tests
+bool RunTaggedMatrix4DTests() {
+    std::cout << "\n=== TaggedMatrix4D Tests ===\n";
+
+    // Classification tests
+    runTest("TaggedMatrix4D Classify", []() {
+        using Math::Matrix4DKind;
+        using Math::TaggedMatrix4D;
+
+        return TaggedMatrix4D::Classify(Math::Matrix4D::Identity()) == Matrix4DKind::Identity &&
+               TaggedMatrix4D::Classify(Math::Matrix4D::CreateTranslation(1.0f, 2.0f, 3.0f)) == Matrix4DKind::Translation &&
+               TaggedMatrix4D::Classify(Math::Matrix4D::CreateScale(2.0f)) == Matrix4DKind::Affine &&
+               TaggedMatrix4D::Classify(Math::Matrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f)) == Matrix4DKind::Projective;
+    });
+
+    runTest("TaggedMatrix4D Factory Kinds", []() {
+        using Math::Matrix4DKind;
+        using Math::TaggedMatrix4D;
+
+        return TaggedMatrix4D::Identity().kind == Matrix4DKind::Identity &&
+               TaggedMatrix4D::CreateTranslation(1.0f, 0.0f, 0.0f).kind == Matrix4DKind::Translation &&
+               TaggedMatrix4D::CreateScale(1.0f, 2.0f, 3.0f).kind == Matrix4DKind::Affine &&
+               TaggedMatrix4D::CreateRotationY(0.5f).kind == Matrix4DKind::Affine &&
+               TaggedMatrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f).kind == Matrix4DKind::Projective &&
+               TaggedMatrix4D::CreateOrthographic(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 10.0f).kind == Matrix4DKind::Projective;
+    });
+
+    // Multiplication tests
+    runTest("TaggedMatrix4D Multiply Propagates Kind", []() {
+        using Math::Matrix4DKind;
+        using Math::TaggedMatrix4D;
+
+        TaggedMatrix4D t1 = TaggedMatrix4D::CreateTranslation(1.0f, 2.0f, 3.0f);
+        TaggedMatrix4D t2 = TaggedMatrix4D::CreateTranslation(-4.0f, 0.5f, 2.0f);
+        TaggedMatrix4D r = TaggedMatrix4D::CreateRotation(Math::Vector3D(1.0f, 1.0f, 0.0f), 0.8f);
+        TaggedMatrix4D p = TaggedMatrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f);
+
+        return (t1 * t2).kind == Matrix4DKind::Translation &&
+               (t1 * r).kind == Matrix4DKind::Affine &&
+               (r * t1).kind == Matrix4DKind::Affine &&
+               (TaggedMatrix4D::Identity() * r).kind == Matrix4DKind::Affine &&
+               (p * r).kind == Matrix4DKind::Projective;
+    });
+
+    runTest("TaggedMatrix4D Multiply Matches Matrix4D", []() {
+        using Math::TaggedMatrix4D;
+
+        const TaggedMatrix4D matrices[] = {
+            TaggedMatrix4D::Identity(),
+            TaggedMatrix4D::CreateTranslation(1.0f, -2.0f, 3.0f),
+            TaggedMatrix4D::CreateScale(2.0f, 0.5f, 3.0f),
+            TaggedMatrix4D::CreateRotation(Math::Vector3D(0.3f, 1.0f, -0.2f), 1.1f),
+            TaggedMatrix4D::CreateTransformation(Math::Vector3D(4.0f, 5.0f, 6.0f),
+                                                 Math::Vector3D(0.0f, 0.0f, 1.0f), 0.4f,
+                                                 Math::Vector3D(1.0f, 2.0f, 1.0f)),
+            TaggedMatrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f)
+        };
+
+        for (const TaggedMatrix4D& a : matrices) {
+            for (const TaggedMatrix4D& b : matrices) {
+                TaggedMatrix4D product = a * b;
+                if (!matrix4DEqual(product.matrix, a.matrix * b.matrix, 1e-4f)) {
+                    return false;
+                }
+                if (product.kind < TaggedMatrix4D::Classify(product.matrix)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    });
+
+    // Inverse tests
+    runTest("TaggedMatrix4D Inverse Matches Matrix4D", []() {
+        using Math::TaggedMatrix4D;
+
+        const TaggedMatrix4D matrices[] = {
+            TaggedMatrix4D::Identity(),
+            TaggedMatrix4D::CreateTranslation(1.0f, -2.0f, 3.0f),
+            TaggedMatrix4D::CreateTransformation(Math::Vector3D(4.0f, 5.0f, 6.0f),
+                                                 Math::Vector3D(1.0f, 0.0f, 1.0f), 0.9f,
+                                                 Math::Vector3D(2.0f, 2.0f, 0.5f)),
+            TaggedMatrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f)
+        };
+
+        for (const TaggedMatrix4D& m : matrices) {
+            TaggedMatrix4D inverse = m.Inverse();
+            if (inverse.kind != m.kind ||
+                !matrix4DEqual(inverse.matrix, m.matrix.Inverse(), 1e-4f) ||
+                !matrix4DEqual((m * inverse).matrix, Math::Matrix4D::Identity(), 1e-4f)) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    runTest("TaggedMatrix4D Singular Affine Inverse Throws", []() {
+        Math::TaggedMatrix4D singular = Math::TaggedMatrix4D::CreateScale(1.0f, 0.0f, 1.0f);
+        try {
+            (void)singular.Inverse();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    });
+
+    // Transform tests
+    runTest("TaggedMatrix4D TransformPoint/Vector", []() {
+        using Math::TaggedMatrix4D;
+
+        const TaggedMatrix4D matrices[] = {
+            TaggedMatrix4D::Identity(),
+            TaggedMatrix4D::CreateTranslation(1.0f, -2.0f, 3.0f),
+            TaggedMatrix4D::CreateRotationX(0.7f) * TaggedMatrix4D::CreateScale(2.0f),
+            TaggedMatrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f)
+        };
+        const Math::Vector3D point(0.5f, -1.5f, -4.0f);
+
+        for (const TaggedMatrix4D& m : matrices) {
+            if (!vector3DEqual(m.TransformPoint(point), m.matrix.TransformPoint(point), 1e-5f) ||
+                !vector3DEqual(m.TransformVector(point), m.matrix.TransformVector(point), 1e-5f)) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    std::cout << "\n=== End of TaggedMatrix4D Tests ===\n";
+    return true;
+}
@@ -0,0 +1,10 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef TAGGEDMATRIX4DTESTS_H
+#define TAGGEDMATRIX4DTESTS_H
+
+bool RunTaggedMatrix4DTests();
+
+#endif //TAGGEDMATRIX4DTESTS_H
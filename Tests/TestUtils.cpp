@@ -3,6 +3,11 @@
 //
 
 #include "TestUtils.h"
+#include "../Math/Vector2D.h"
+#include "../Math/Vector3D.h"
+#include "../Math/Matrix2D.h"
+#include "../Math/Matrix3D.h"
+#include "../Math/Matrix4D.h"
 #include <iomanip> // For std::setw
 
 bool floatEqual(float a, float b, float epsilon) {
@@ -39,10 +44,12 @@ bool matrix4DEqual(const Math::Matrix4D& a, const Math::Matrix4D& b, float epsil
     return a.Equals(b, epsilon);
 }
 
-// Test runner to execute and report test results
-void runTest(const std::string& testName, std::function<bool()> testFunc) {
+// Test runner to report test results
+void beginTest(std::string_view testName) {
     std::cout << "Running test: " << std::left << std::setw(50) << testName << " - ";
-    bool result = testFunc();
+}
+
+void endTest(std::string_view testName, bool result) {
     std::cout << (result ? "PASSED" : "FAILED") << std::endl;
     if (!result) {
         std::cerr << "    Test failure in '" << testName << "'" << std::endl;
@@ -8,13 +8,9 @@
 
 #include <iostream>
 #include <string>
-#include <functional>
+#include <string_view>
 #include "../Math/Constants.h"
-#include "../Math/Vector2D.h"
-#include "../Math/Vector3D.h"
-#include "../Math/Matrix2D.h"
-#include "../Math/Matrix3D.h"
-#include "Math/Matrix4D.h"
+#include "../Math/MathFwd.h"
 
 
 // Utility functions for tests
@@ -24,6 +20,17 @@ bool vector3DEqual(const Math::Vector3D& a, const Math::Vector3D& b, float epsil
 bool matrix2DEqual(const Math::Matrix2D& a, const Math::Matrix2D& b, float epsilon = Math::Constants::EPSILON);
 bool matrix3DEqual(const Math::Matrix3D& a, const Math::Matrix3D& b, float epsilon = Math::Constants::EPSILON);
 bool matrix4DEqual(const Math::Matrix4D& a, const Math::Matrix4D& b, float epsilon = Math::Constants::EPSILON);
-void runTest(const std::string& testName, std::function<bool()> testFunc);
+
+// Test reporting, split out of runTest so the template stays small
+void beginTest(std::string_view testName);
+void endTest(std::string_view testName, bool result);
+
+// Runs a test and reports its result; the test is called directly rather than through
+// std::function, so running a test allocates nothing by itself
+template <typename TestFunc>
+void runTest(std::string_view testName, TestFunc&& testFunc) {
+    beginTest(testName);
+    endTest(testName, testFunc());
+}
 
 #endif // TEST_UTILS_H
\ No newline at end of file
@@ -0,0 +1,183 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TraceTests.h"
+#include "TestUtils.h"
+#include "../Math/Trace.h"
+#include "../Math/Transform2D.h"
+
+namespace {
+
+    // Counts non-overlapping occurrences of a substring
+    std::size_t CountOccurrences(const std::string& text, const std::string& pattern) {
+        std::size_t count = 0;
+        for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size())) {
+            ++count;
+        }
+        return count;
+    }
+
+    std::string ExportTrace() {
+        std::ostringstream stream;
+        Math::Trace::WriteChromeJson(stream);
+        return stream.str();
+    }
+
+} // namespace
+
+bool RunTraceTests() {
+    std::cout << "\n=== Trace Tests ===\n";
+
+    runTest("Trace RingBuffer FIFO Order", []() {
+        Math::Trace::RingBuffer buffer(3);
+        bool pushed = buffer.TryPush({"a", 1, 10}) && buffer.TryPush({"b", 2, 20}) && buffer.TryPush({"c", 3, 30});
+
+        Math::Trace::Event first;
+        Math::Trace::Event second;
+        Math::Trace::Event third;
+        Math::Trace::Event empty;
+        bool popped = buffer.TryPop(first) && buffer.TryPop(second) && buffer.TryPop(third);
+
+        return buffer.GetCapacity() == 4 && pushed && popped && !buffer.TryPop(empty) &&
+               first.startNanoseconds == 1 && second.startNanoseconds == 2 && third.startNanoseconds == 3 &&
+               third.durationNanoseconds == 30;
+    });
+
+    runTest("Trace RingBuffer Drops When Full", []() {
+        Math::Trace::RingBuffer buffer(2);
+        bool accepted = buffer.TryPush({"a", 1, 0}) && buffer.TryPush({"b", 2, 0});
+        bool rejected = !buffer.TryPush({"c", 3, 0}) && !buffer.TryPush({"d", 4, 0});
+
+        // Space freed by the consumer can be reused; the oldest event is never overwritten
+        Math::Trace::Event event;
+        buffer.TryPop(event);
+        bool reused = buffer.TryPush({"e", 5, 0});
+
+        return accepted && rejected && reused && event.startNanoseconds == 1 && buffer.GetDroppedCount() == 2;
+    });
+
+    runTest("Trace RingBuffer Concurrent Producer", []() {
+        constexpr std::uint64_t EventCount = 100000;
+        Math::Trace::RingBuffer buffer(64);
+
+        std::thread producer([&buffer]() {
+            for (std::uint64_t i = 0; i < EventCount; ++i) {
+                while (!buffer.TryPush({"event", i, 0})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        // Every event must arrive exactly once and in order
+        bool ordered = true;
+        std::uint64_t expected = 0;
+        while (expected < EventCount) {
+            Math::Trace::Event event;
+            if (buffer.TryPop(event)) {
+                ordered &= event.startNanoseconds == expected;
+                ++expected;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        return ordered;
+    });
+
+    runTest("Trace ScopedEvent Only Records When Enabled", []() {
+        ExportTrace();
+
+        {
+            Math::Trace::ScopedEvent disabled("TraceTest::Disabled");
+        }
+        Math::Trace::SetEnabled(true);
+        {
+            Math::Trace::ScopedEvent enabled("TraceTest::Enabled");
+        }
+        Math::Trace::SetEnabled(false);
+
+        std::string json = ExportTrace();
+        std::string drained = ExportTrace();
+
+        return CountOccurrences(json, "\"name\":\"TraceTest::Enabled\",\"ph\":\"X\"") == 1 &&
+               CountOccurrences(json, "TraceTest::Disabled") == 0 &&
+               json.find("{\"traceEvents\":[") == 0 &&
+               CountOccurrences(drained, "TraceTest::Enabled") == 0;
+    });
+
+    runTest("Trace Threads Export Separately", []() {
+        ExportTrace();
+        Math::Trace::SetEnabled(true);
+        {
+            Math::Trace::ScopedEvent mainScope("TraceTest::Main");
+        }
+        std::thread worker([]() {
+            Math::Trace::ScopedEvent workerScope("TraceTest::Worker");
+        });
+        worker.join();
+        Math::Trace::SetEnabled(false);
+
+        // The worker has exited, but its buffer is still exported, under another thread id
+        std::string json = ExportTrace();
+        std::size_t mainEvent = json.find("TraceTest::Main");
+        std::size_t workerEvent = json.find("TraceTest::Worker");
+        if (mainEvent == std::string::npos || workerEvent == std::string::npos) {
+            return false;
+        }
+        std::string mainTid = json.substr(json.find("\"tid\":", mainEvent), 8);
+        std::string workerTid = json.substr(json.find("\"tid\":", workerEvent), 8);
+        return mainTid != workerTid;
+    });
+
+    runTest("Trace Reuses Buffers Of Exited Threads", []() {
+        // Drains and removes the buffers of threads that already exited
+        ExportTrace();
+        Math::Trace::SetEnabled(true);
+        for (int i = 0; i < 20; ++i) {
+            std::thread worker([]() {
+                Math::Trace::ScopedEvent workerScope("TraceTest::ShortLived");
+            });
+            worker.join();
+        }
+        Math::Trace::SetEnabled(false);
+
+        // Each thread took over the buffer of the one before, so all events share one thread id
+        std::string json = ExportTrace();
+        std::size_t first = json.find("TraceTest::ShortLived");
+        if (first == std::string::npos) {
+            return false;
+        }
+        std::string tid = json.substr(json.find("\"tid\":", first), 8);
+        return CountOccurrences(json, "TraceTest::ShortLived") == 20 && CountOccurrences(json, tid) == 20 &&
+               Math::Trace::GetDroppedEventCount() == 0;
+    });
+
+    runTest("Trace Library Markers", []() {
+        ExportTrace();
+        Math::Trace::SetEnabled(true);
+        Math::Transform2D transform(Math::Vector2D(1.0f, 2.0f), 0.5f);
+        std::vector<Math::Vector2D> points(16, Math::Vector2D(1.0f, 1.0f));
+        std::vector<Math::Vector2D> output(points.size());
+        transform.TransformPoints(points, output);
+        Math::Trace::SetEnabled(false);
+
+        // Markers only exist in builds with MATHENGINE_ENABLE_TRACING
+        std::size_t markers = CountOccurrences(ExportTrace(), "Transform2D::TransformPoints");
+#if defined(MATHENGINE_ENABLE_TRACING)
+        return markers == 1;
+#else
+        return markers == 0;
+#endif
+    });
+
+    std::cout << "\n=== End of Trace Tests ===\n";
+    return true;
+}
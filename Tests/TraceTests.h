@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef TRACE_TESTS_H
+#define TRACE_TESTS_H
+
+// Function to run scoped tracing tests
+bool RunTraceTests();
+
+#endif // TRACE_TESTS_H
@@ -9,6 +9,10 @@
 #include <iostream>
 #include <functional>
 #include <cmath>
+#include <vector>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
 
 bool RunTransform2DTests() {
     std::cout << "\n=== Running Transform2D Tests ===\n\n";
@@ -430,6 +434,206 @@ bool RunTransform2DTests() {
         return (transform.TransformPoint(point) - expected).Length() < 1e-5f;
     });
 
+    // Test TransformPoints (array of structures)
+    runTest("Transform2D TransformPoints (AoS)", []() {
+        Math::Transform2D parent(Math::Vector2D(5.0f, -1.0f), M_PI / 3.0f, Math::Vector2D(2.0f, 0.5f));
+        Math::Transform2D child(Math::Vector2D(1.0f, 2.0f), M_PI / 2.0f, Math::Vector2D(2.0f, 3.0f));
+        child.SetParent(&parent);
+
+        std::vector<Math::Vector2D> points = {
+            {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {-3.5f, 2.25f}, {10.0f, -7.0f}
+        };
+        std::vector<Math::Vector2D> transformed(points.size());
+        child.TransformPoints(points, transformed);
+
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            if ((transformed[i] - child.TransformPoint(points[i])).Length() > 1e-5f) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Test TransformPoints (structure of arrays, in place)
+    runTest("Transform2D TransformPoints (SoA In-Place)", []() {
+        Math::Transform2D transform(Math::Vector2D(1.0f, 2.0f), M_PI / 4.0f, Math::Vector2D(2.0f, 3.0f));
+
+        std::vector<float> xs = {0.0f, 1.0f, -2.0f, 4.5f};
+        std::vector<float> ys = {0.0f, -1.0f, 3.0f, 0.25f};
+        std::vector<Math::Vector2D> expected;
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            expected.push_back(transform.TransformPoint(Math::Vector2D(xs[i], ys[i])));
+        }
+
+        transform.TransformPoints(xs, ys, xs, ys);
+
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            if ((Math::Vector2D(xs[i], ys[i]) - expected[i]).Length() > 1e-5f) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Test TransformVectors (AoS and SoA)
+    runTest("Transform2D TransformVectors (AoS & SoA)", []() {
+        Math::Transform2D transform(Math::Vector2D(1.0f, 2.0f), M_PI / 2.0f, Math::Vector2D(2.0f, 2.0f));
+
+        std::vector<Math::Vector2D> vectors = {{1.0f, 0.0f}, {0.0f, 1.0f}, {3.0f, -4.0f}};
+        std::vector<Math::Vector2D> transformed(vectors.size());
+        transform.TransformVectors(vectors, transformed);
+
+        std::vector<float> xs = {1.0f, 0.0f, 3.0f};
+        std::vector<float> ys = {0.0f, 1.0f, -4.0f};
+        std::vector<float> outXs(xs.size());
+        std::vector<float> outYs(ys.size());
+        transform.TransformVectors(xs, ys, outXs, outYs);
+
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            Math::Vector2D expected = transform.TransformVector(vectors[i]);
+            if ((transformed[i] - expected).Length() > 1e-5f ||
+                (Math::Vector2D(outXs[i], outYs[i]) - expected).Length() > 1e-5f) {
+                return false;
+            }
+        }
+        return (transformed[0] - Math::Vector2D(0.0f, 2.0f)).Length() < 1e-5f;
+    });
+
+    // Test batch size mismatch
+    runTest("Transform2D TransformPoints Size Mismatch", []() {
+        Math::Transform2D transform;
+        std::vector<Math::Vector2D> points(4);
+        std::vector<Math::Vector2D> transformed(3);
+
+        try {
+            transform.TransformPoints(points, transformed);
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    });
+
+    // Test classification flags maintained by setters
+    runTest("Transform2D Classification Flags", []() {
+        using Math::TransformFlags;
+        Math::Transform2D transform;
+        bool identity = transform.GetFlags() == TransformFlags::None;
+
+        transform.SetPosition(Math::Vector2D(1.0f, 0.0f));
+        bool translation = transform.GetFlags() == TransformFlags::Translation;
+
+        transform.SetScale(2.0f);
+        bool uniform = transform.GetFlags() == (TransformFlags::Translation | TransformFlags::Scale);
+
+        transform.Scale(Math::Vector2D(1.0f, 3.0f));
+        bool nonUniform = Math::HasAnyFlag(transform.GetFlags(), TransformFlags::NonUniformScale);
+
+        transform.RotateDeg(30.0f);
+        bool rotated = Math::HasAnyFlag(transform.GetFlags(), TransformFlags::Rotation);
+
+        transform.SetRotationRad(0.0f);
+        transform.SetScale(1.0f);
+        transform.SetPosition(Math::Vector2D(0.0f, 0.0f));
+        bool backToIdentity = transform.GetFlags() == TransformFlags::None;
+
+        return identity && translation && uniform && nonUniform && rotated && backToIdentity;
+    });
+
+    // Test world flags accumulate along the parent chain
+    runTest("Transform2D World Flags", []() {
+        using Math::TransformFlags;
+        Math::Transform2D parent = Math::Transform2D::RotationDeg(45.0f);
+        Math::Transform2D child = Math::Transform2D::Translation(Math::Vector2D(1.0f, 2.0f));
+        child.SetParent(&parent);
+
+        return child.GetFlags() == TransformFlags::Translation &&
+               child.GetWorldFlags() == (TransformFlags::Translation | TransformFlags::Rotation);
+    });
+
+    // Test fast paths agree with the general matrix path
+    runTest("Transform2D Fast Paths Match Matrix Path", []() {
+        Math::Transform2D translation = Math::Transform2D::Translation(Math::Vector2D(3.0f, -2.0f));
+        Math::Transform2D scaling(Math::Vector2D(1.0f, 1.0f), 0.0f, Math::Vector2D(2.0f, 0.5f));
+        Math::Transform2D general(Math::Vector2D(-1.0f, 4.0f), 0.7f, Math::Vector2D(1.5f, 1.5f));
+
+        const Math::Transform2D transforms[] = {translation, scaling, general, Math::Transform2D::Identity()};
+        const Math::Vector2D point(0.75f, -1.25f);
+
+        for (const Math::Transform2D& a : transforms) {
+            for (const Math::Transform2D& b : transforms) {
+                // Non-uniform scale followed by rotation introduces shear, which TRS cannot represent
+                if (Math::HasAnyFlag(a.GetFlags(), Math::TransformFlags::NonUniformScale) &&
+                    Math::HasAnyFlag(b.GetFlags(), Math::TransformFlags::Rotation)) {
+                    continue;
+                }
+                Math::Matrix3D expected = a.GetLocalMatrix() * b.GetLocalMatrix();
+                if (!matrix3DEqual(a.Compose(b).GetLocalMatrix(), expected, 1e-5f)) {
+                    return false;
+                }
+            }
+
+            Math::Matrix3D local = a.GetLocalMatrix();
+            Math::Vector2D expectedPoint(local.m00 * point.x + local.m01 * point.y + local.m02,
+                                         local.m10 * point.x + local.m11 * point.y + local.m12);
+            if ((a.TransformPoint(point) - expectedPoint).Length() > 1e-5f) {
+                return false;
+            }
+
+            if (!matrix3DEqual(a.Inverse().GetLocalMatrix(), local.Inverse(), 1e-5f)) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Test identity child inherits parent world matrix
+    runTest("Transform2D Identity Child World Matrix", []() {
+        Math::Transform2D parent(Math::Vector2D(2.0f, 1.0f), 0.5f, Math::Vector2D(2.0f, 3.0f));
+        Math::Transform2D child;
+        child.SetParent(&parent);
+
+        return matrix3DEqual(child.GetWorldMatrix(), parent.GetWorldMatrix()) &&
+               child.TransformVector(Math::Vector2D(1.0f, 0.0f)) == parent.TransformVector(Math::Vector2D(1.0f, 0.0f));
+    });
+
+    // Test setters keep the local matrix in sync
+    runTest("Transform2D Setters Update Local Matrix", []() {
+        Math::Transform2D transform;
+        transform.SetRotationRad(0.5f);
+        transform.SetScale(Math::Vector2D(2.0f, 3.0f));
+        transform.Translate(Math::Vector2D(4.0f, -1.0f));
+
+        Math::Transform2D expected(Math::Vector2D(4.0f, -1.0f), 0.5f, Math::Vector2D(2.0f, 3.0f));
+        return matrix3DEqual(transform.GetLocalMatrix(), expected.GetLocalMatrix());
+    });
+
+    // Test concurrent const reads of a shared hierarchy
+    runTest("Transform2D Concurrent World Matrix Reads", []() {
+        Math::Transform2D root(Math::Vector2D(1.0f, 2.0f), 0.3f, Math::Vector2D(2.0f, 2.0f));
+        Math::Transform2D middle(Math::Vector2D(-1.0f, 0.5f), 1.2f, 1.5f);
+        Math::Transform2D leaf(Math::Vector2D(3.0f, 3.0f), -0.4f, Math::Vector2D(1.0f, 0.5f));
+        middle.SetParent(&root);
+        leaf.SetParent(&middle);
+
+        const Math::Matrix3D expected = root.GetLocalMatrix() * middle.GetLocalMatrix() * leaf.GetLocalMatrix();
+        std::atomic<bool> allMatch{true};
+
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&]() {
+                for (int i = 0; i < 1000; ++i) {
+                    if (!matrix3DEqual(leaf.GetWorldMatrix(), expected, 1e-5f)) {
+                        allMatch = false;
+                    }
+                }
+            });
+        }
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+        return allMatch.load();
+    });
+
     std::cout << "\n=== End of Transform2D Tests ===\n";
     return true;
 }
\ No newline at end of file
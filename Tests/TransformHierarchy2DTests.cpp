@@ -0,0 +1,408 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include "TransformHierarchy2DTests.h"
+#include "../Math/TransformHierarchy2D.h"
+#include "../Math/Transform2D.h"
+#include "TestUtils.h"
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+bool RunTransformHierarchy2DTests() {
+    std::cout << "\n=== Running TransformHierarchy2D Tests ===\n\n";
+
+    // Test creation and component access
+    runTest("TransformHierarchy2D Create & Getters", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle handle = hierarchy.Create(Math::Vector2D(1.0f, 2.0f), 0.5f, Math::Vector2D(2.0f, 3.0f));
+
+        return hierarchy.Size() == 1 && hierarchy.Contains(handle) &&
+               hierarchy.GetPosition(handle) == Math::Vector2D(1.0f, 2.0f) &&
+               hierarchy.GetRotationRad(handle) == 0.5f &&
+               hierarchy.GetScale(handle) == Math::Vector2D(2.0f, 3.0f) &&
+               !hierarchy.GetParent(handle).IsValid();
+    });
+
+    // Test world matrices match Transform2D parent chains
+    runTest("TransformHierarchy2D World Matrices Match Transform2D", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle root = hierarchy.Create(Math::Vector2D(1.0f, 2.0f), 0.3f, Math::Vector2D(2.0f, 2.0f));
+        Math::Transform2DHandle child = hierarchy.Create(Math::Vector2D(-1.0f, 0.5f), 1.2f, Math::Vector2D(1.5f, 1.5f), root);
+        Math::Transform2DHandle leaf = hierarchy.Create(Math::Vector2D(3.0f, 3.0f), -0.4f, Math::Vector2D(1.0f, 0.5f), child);
+        hierarchy.UpdateWorldMatrices();
+
+        Math::Transform2D rootTransform(Math::Vector2D(1.0f, 2.0f), 0.3f, Math::Vector2D(2.0f, 2.0f));
+        Math::Transform2D childTransform(Math::Vector2D(-1.0f, 0.5f), 1.2f, Math::Vector2D(1.5f, 1.5f));
+        Math::Transform2D leafTransform(Math::Vector2D(3.0f, 3.0f), -0.4f, Math::Vector2D(1.0f, 0.5f));
+        childTransform.SetParent(&rootTransform);
+        leafTransform.SetParent(&childTransform);
+
+        return matrix3DEqual(hierarchy.GetWorldMatrix(root), rootTransform.GetWorldMatrix(), 1e-5f) &&
+               matrix3DEqual(hierarchy.GetWorldMatrix(child), childTransform.GetWorldMatrix(), 1e-5f) &&
+               matrix3DEqual(hierarchy.GetWorldMatrix(leaf), leafTransform.GetWorldMatrix(), 1e-5f);
+    });
+
+    // Test modifications propagate to descendants on update
+    runTest("TransformHierarchy2D Update Propagates to Children", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle root = hierarchy.Create(Math::Vector2D(0.0f, 0.0f));
+        Math::Transform2DHandle child = hierarchy.Create(Math::Vector2D(1.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), root);
+        hierarchy.UpdateWorldMatrices();
+
+        hierarchy.Translate(root, Math::Vector2D(5.0f, 5.0f));
+        hierarchy.UpdateWorldMatrices();
+
+        const Math::Matrix3D& world = hierarchy.GetWorldMatrix(child);
+        return floatEqual(world.m02, 6.0f) && floatEqual(world.m12, 5.0f);
+    });
+
+    // Test bulk position editing through the hot array
+    runTest("TransformHierarchy2D EditPositions", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle a = hierarchy.Create(Math::Vector2D(1.0f, 0.0f));
+        Math::Transform2DHandle b = hierarchy.Create(Math::Vector2D(2.0f, 0.0f));
+        hierarchy.UpdateWorldMatrices();
+
+        for (Math::Vector2D& position : hierarchy.EditPositions()) {
+            position += Math::Vector2D(0.0f, 10.0f);
+        }
+        hierarchy.UpdateWorldMatrices();
+
+        return hierarchy.GetPosition(a) == Math::Vector2D(1.0f, 10.0f) &&
+               floatEqual(hierarchy.GetWorldMatrix(b).m12, 10.0f);
+    });
+
+    // Test re-parenting to a later transform keeps parents before children
+    runTest("TransformHierarchy2D SetParent Reorders", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle child = hierarchy.Create(Math::Vector2D(1.0f, 0.0f));
+        Math::Transform2DHandle grandChild = hierarchy.Create(Math::Vector2D(0.0f, 1.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), child);
+        Math::Transform2DHandle parent = hierarchy.Create(Math::Vector2D(10.0f, 0.0f));
+
+        hierarchy.SetParent(child, parent);
+        hierarchy.UpdateWorldMatrices();
+
+        const Math::Matrix3D& world = hierarchy.GetWorldMatrix(grandChild);
+        return hierarchy.GetIndex(parent) < hierarchy.GetIndex(child) &&
+               hierarchy.GetIndex(child) < hierarchy.GetIndex(grandChild) &&
+               hierarchy.GetParent(child) == parent &&
+               floatEqual(world.m02, 11.0f) && floatEqual(world.m12, 1.0f);
+    });
+
+    // Test cycles are rejected
+    runTest("TransformHierarchy2D SetParent Rejects Cycles", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle root = hierarchy.Create();
+        Math::Transform2DHandle child = hierarchy.Create(Math::Vector2D(0.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), root);
+
+        try {
+            hierarchy.SetParent(root, child);
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    });
+
+    // Test destroying a parent turns its children into roots and recycles handles
+    runTest("TransformHierarchy2D Destroy", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle root = hierarchy.Create(Math::Vector2D(5.0f, 0.0f));
+        Math::Transform2DHandle child = hierarchy.Create(Math::Vector2D(1.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), root);
+        hierarchy.UpdateWorldMatrices();
+
+        hierarchy.Destroy(root);
+        hierarchy.UpdateWorldMatrices();
+
+        bool childIsRoot = !hierarchy.GetParent(child).IsValid() &&
+                           floatEqual(hierarchy.GetWorldMatrix(child).m02, 1.0f);
+        bool destroyed = !hierarchy.Contains(root) && hierarchy.Size() == 1 && hierarchy.GetIndex(child) == 0;
+
+        // The freed id is recycled by the next creation
+        Math::Transform2DHandle reused = hierarchy.Create();
+        return childIsRoot && destroyed && reused.id == root.id && hierarchy.Size() == 2;
+    });
+
+    // Test rebasing the origin matches rebuilding the scene with shifted roots
+    runTest("TransformHierarchy2D RebaseOrigin", []() {
+        const Math::Vector2D origin(1000.0f, -250.0f);
+        Math::TransformHierarchy2D rebased;
+        Math::TransformHierarchy2D expected;
+        Math::Transform2DHandle handles[4];
+        for (Math::TransformHierarchy2D* hierarchy : {&rebased, &expected}) {
+            const Math::Vector2D shift = hierarchy == &expected ? origin : Math::Vector2D(0.0f, 0.0f);
+            handles[0] = hierarchy->Create(Math::Vector2D(1200.0f, -300.0f) - shift, 0.5f);
+            handles[1] = hierarchy->Create(Math::Vector2D(2.0f, 1.0f), 0.25f, Math::Vector2D(2.0f, 2.0f), handles[0]);
+            handles[2] = hierarchy->Create(Math::Vector2D(-1.0f, 3.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), handles[1]);
+            handles[3] = hierarchy->Create(Math::Vector2D(1010.0f, -240.0f) - shift);
+        }
+        rebased.UpdateWorldMatrices();
+
+        // An edit made before the rebase is still applied by the next update
+        rebased.SetRotationRad(handles[1], 1.0f);
+        expected.SetRotationRad(handles[1], 1.0f);
+        rebased.RebaseOrigin(origin);
+        bool matricesShifted = matrix3DEqual(rebased.GetWorldMatrix(handles[3]), expected.GetLocalMatrix(handles[3]));
+
+        rebased.UpdateWorldMatrices();
+        expected.UpdateWorldMatrices();
+        bool worldMatch = true;
+        for (Math::Transform2DHandle handle : handles) {
+            worldMatch = worldMatch && matrix3DEqual(rebased.GetWorldMatrix(handle), expected.GetWorldMatrix(handle), 1e-3f);
+        }
+        bool childrenKeepLocal = vector2DEqual(rebased.GetPosition(handles[1]), Math::Vector2D(2.0f, 1.0f));
+        return matricesShifted && worldMatch && childrenKeepLocal &&
+               vector2DEqual(rebased.GetPosition(handles[0]), Math::Vector2D(200.0f, -50.0f));
+    });
+
+    // Test a batch of re-parent operations matches applying them one by one
+    runTest("TransformHierarchy2D SetParents Batch", []() {
+        Math::TransformHierarchy2D batched;
+        Math::TransformHierarchy2D sequential;
+        std::vector<Math::Transform2DHandle> handles;
+        for (Math::TransformHierarchy2D* hierarchy : {&batched, &sequential}) {
+            handles.clear();
+            for (int i = 0; i < 6; ++i) {
+                handles.push_back(hierarchy->Create(Math::Vector2D(1.0f + i, 0.5f * i), 0.2f * i));
+            }
+            hierarchy->UpdateWorldMatrices();
+        }
+
+        // Chain 0 -> 5 -> 3 -> 4, and 1 under 0: most links point forward in storage
+        const Math::Transform2DReparent operations[] = {
+            {handles[0], handles[5]}, {handles[5], handles[3]}, {handles[3], handles[4]}, {handles[1], handles[0]},
+        };
+        batched.SetParents(operations);
+        for (const Math::Transform2DReparent& operation : operations) {
+            sequential.SetParent(operation.child, operation.parent);
+        }
+        batched.UpdateWorldMatrices();
+        sequential.UpdateWorldMatrices();
+
+        bool ordered = true;
+        bool matches = true;
+        for (Math::Transform2DHandle handle : handles) {
+            Math::Transform2DHandle parent = batched.GetParent(handle);
+            ordered = ordered && (!parent.IsValid() || batched.GetIndex(parent) < batched.GetIndex(handle));
+            matches = matches && parent == sequential.GetParent(handle) &&
+                      matrix3DEqual(batched.GetWorldMatrix(handle), sequential.GetWorldMatrix(handle));
+        }
+        return ordered && matches && batched.GetParent(handles[1]) == handles[0];
+    });
+
+    // Test re-parenting can keep world transforms in place
+    runTest("TransformHierarchy2D SetParents Preserves World", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle ship = hierarchy.Create(Math::Vector2D(10.0f, 5.0f), 0.7f, Math::Vector2D(2.0f, 2.0f));
+        Math::Transform2DHandle crate = hierarchy.Create(Math::Vector2D(-3.0f, 4.0f), -0.3f, Math::Vector2D(1.0f, 0.5f));
+        Math::Transform2DHandle wheel = hierarchy.Create(Math::Vector2D(1.0f, 0.0f), 0.4f, Math::Vector2D(1.0f, 1.0f), crate);
+        hierarchy.UpdateWorldMatrices();
+        const Math::Matrix3D crateWorld = hierarchy.GetWorldMatrix(crate);
+        const Math::Matrix3D wheelWorld = hierarchy.GetWorldMatrix(wheel);
+
+        // Attach the crate to the ship, then detach it again
+        const Math::Transform2DReparent attach[] = {{crate, ship}};
+        hierarchy.SetParents(attach, true);
+        hierarchy.UpdateWorldMatrices();
+        bool attached = hierarchy.GetParent(crate) == ship &&
+                        matrix3DEqual(hierarchy.GetWorldMatrix(crate), crateWorld, 1e-4f) &&
+                        matrix3DEqual(hierarchy.GetWorldMatrix(wheel), wheelWorld, 1e-4f);
+
+        const Math::Transform2DReparent detach[] = {{crate, Math::Transform2DHandle()}};
+        hierarchy.SetParents(detach, true);
+        hierarchy.UpdateWorldMatrices();
+        bool detached = !hierarchy.GetParent(crate).IsValid() &&
+                        matrix3DEqual(hierarchy.GetWorldMatrix(crate), crateWorld, 1e-4f) &&
+                        vector2DEqual(hierarchy.GetPosition(crate), Math::Vector2D(-3.0f, 4.0f), 1e-4f);
+        return attached && detached;
+    });
+
+    // Test edits made since the last update survive a world-preserving re-parent
+    runTest("TransformHierarchy2D SetParents Keeps Edits", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle ship = hierarchy.Create(Math::Vector2D(10.0f, 5.0f), 0.7f, Math::Vector2D(2.0f, 2.0f));
+        Math::Transform2DHandle holder = hierarchy.Create(Math::Vector2D(1.0f, 1.0f));
+        Math::Transform2DHandle crate = hierarchy.Create(Math::Vector2D(-3.0f, 4.0f), -0.3f, Math::Vector2D(1.0f, 1.0f), holder);
+        hierarchy.UpdateWorldMatrices();
+
+        // Edit the crate, its old parent and its new parent, then re-parent without an update
+        hierarchy.SetPosition(crate, Math::Vector2D(2.0f, 3.0f));
+        hierarchy.Translate(holder, Math::Vector2D(4.0f, 0.0f));
+        hierarchy.SetRotationRad(ship, -0.2f);
+        const Math::Transform2DReparent attach[] = {{crate, ship}};
+        hierarchy.SetParents(attach, true);
+        hierarchy.UpdateWorldMatrices();
+
+        const Math::Matrix3D world = hierarchy.GetWorldMatrix(crate);
+        return hierarchy.GetParent(crate) == ship && floatEqual(world.m02, 7.0f, 1e-4f) &&
+               floatEqual(world.m12, 4.0f, 1e-4f);
+    });
+
+    // Test a failing batch leaves the hierarchy untouched
+    runTest("TransformHierarchy2D SetParents Rejects Cycles", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle a = hierarchy.Create(Math::Vector2D(1.0f, 0.0f));
+        Math::Transform2DHandle b = hierarchy.Create(Math::Vector2D(2.0f, 0.0f));
+        Math::Transform2DHandle c = hierarchy.Create(Math::Vector2D(3.0f, 0.0f));
+        hierarchy.UpdateWorldMatrices();
+
+        // The third link closes the loop a -> b -> c -> a
+        const Math::Transform2DReparent operations[] = {{a, b}, {b, c}, {c, a}};
+        try {
+            hierarchy.SetParents(operations, true);
+        } catch (const std::invalid_argument&) {
+            return !hierarchy.GetParent(a).IsValid() && !hierarchy.GetParent(b).IsValid() &&
+                   vector2DEqual(hierarchy.GetPosition(a), Math::Vector2D(1.0f, 0.0f)) &&
+                   hierarchy.GetIndex(a) == 0 && hierarchy.GetIndex(c) == 2;
+        }
+        return false;
+    });
+
+    // Test subtrees with an update period are only resolved on their frames
+    runTest("TransformHierarchy2D Update Periods", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle near = hierarchy.Create();
+        Math::Transform2DHandle far = hierarchy.Create(Math::Vector2D(100.0f, 0.0f));
+        Math::Transform2DHandle farChild = hierarchy.Create(Math::Vector2D(1.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), far);
+        hierarchy.UpdateWorldMatrices();
+        hierarchy.SetUpdatePeriod(far, 4);
+        bool inherited = hierarchy.GetUpdatePeriod(farChild) == 4 && hierarchy.GetUpdatePeriod(near) == 1;
+
+        // Every transform moves every frame; only the near one is resolved each time
+        std::size_t updates = 0;
+        std::size_t farUpdates = 0;
+        for (std::uint64_t frame = 0; frame < 8; ++frame) {
+            hierarchy.Translate(near, Math::Vector2D(1.0f, 0.0f));
+            hierarchy.Translate(far, Math::Vector2D(1.0f, 0.0f));
+            const float before = hierarchy.GetWorldMatrix(farChild).m02;
+            updates += hierarchy.UpdateWorldMatrices(frame);
+            farUpdates += hierarchy.GetWorldMatrix(farChild).m02 != before ? 1 : 0;
+        }
+        bool periodic = updates == 8 + 2 * 2 && farUpdates == 2;
+
+        // Nothing is lost: a full update applies the deferred moves
+        hierarchy.UpdateWorldMatrices();
+        bool caughtUp = floatEqual(hierarchy.GetWorldMatrix(farChild).m02, 109.0f) &&
+                        floatEqual(hierarchy.GetWorldMatrix(near).m02, 8.0f);
+        return inherited && periodic && caughtUp;
+    });
+
+    // Test the periodic budget defers work to the next frames without dropping it
+    runTest("TransformHierarchy2D Update Budget", []() {
+        Math::TransformHierarchy2D hierarchy;
+        std::vector<Math::Transform2DHandle> roots;
+        for (int i = 0; i < 8; ++i) {
+            roots.push_back(hierarchy.Create());
+            hierarchy.SetUpdatePeriod(roots.back(), 2);
+        }
+        hierarchy.UpdateWorldMatrices();
+        for (Math::Transform2DHandle root : roots) {
+            hierarchy.SetPosition(root, Math::Vector2D(5.0f, 5.0f));
+        }
+
+        // Half of the roots are due on each frame, but only three may run per frame
+        bool withinBudget = true;
+        std::size_t total = 0;
+        for (std::uint64_t frame = 0; frame < 4; ++frame) {
+            const std::size_t updated = hierarchy.UpdateWorldMatrices(frame, 3);
+            withinBudget = withinBudget && updated <= 3;
+            total += updated;
+        }
+        bool allUpdated = total == roots.size();
+        for (Math::Transform2DHandle root : roots) {
+            allUpdated = allUpdated && floatEqual(hierarchy.GetWorldMatrix(root).m02, 5.0f);
+        }
+        return withinBudget && allUpdated;
+    });
+
+    // Test a transform deferred by the budget still runs next frame when it is edited every frame
+    runTest("TransformHierarchy2D Update Budget With Edits", []() {
+        Math::TransformHierarchy2D hierarchy;
+        // Handle ids two apart give the same phase
+        Math::Transform2DHandle first = hierarchy.Create();
+        hierarchy.Create();
+        Math::Transform2DHandle second = hierarchy.Create();
+        hierarchy.SetUpdatePeriod(first, 2);
+        hierarchy.SetUpdatePeriod(second, 2);
+        hierarchy.UpdateWorldMatrices();
+
+        // Both are due on the same frames, but only one may run per frame
+        for (std::uint64_t frame = 0; frame < 100; ++frame) {
+            hierarchy.Translate(first, Math::Vector2D(1.0f, 0.0f));
+            hierarchy.Translate(second, Math::Vector2D(1.0f, 0.0f));
+            hierarchy.UpdateWorldMatrices(frame, 1);
+        }
+        return hierarchy.GetWorldMatrix(first).m02 >= 98.0f && hierarchy.GetWorldMatrix(second).m02 >= 98.0f;
+    });
+
+    // Test re-parented subtrees take the update period of their new parent
+    runTest("TransformHierarchy2D Re-parenting Updates Periods", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle far = hierarchy.Create(Math::Vector2D(500.0f, 0.0f));
+        Math::Transform2DHandle ship = hierarchy.Create();
+        Math::Transform2DHandle crate = hierarchy.Create(Math::Vector2D(1.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), ship);
+        hierarchy.SetUpdatePeriod(far, 8);
+
+        // A subtree moved under the distant root is throttled with it
+        hierarchy.SetParent(ship, far);
+        bool throttled = hierarchy.GetUpdatePeriod(ship) == 8 && hierarchy.GetUpdatePeriod(crate) == 8;
+
+        // Detached again, it is a root with the default period
+        const Math::Transform2DReparent detach[] = {{ship, Math::Transform2DHandle()}};
+        hierarchy.SetParents(detach);
+        bool restored = hierarchy.GetUpdatePeriod(ship) == 1 && hierarchy.GetUpdatePeriod(crate) == 1;
+
+        // In a batch, a child follows its parent's later move
+        const Math::Transform2DReparent batch[] = {{crate, far}, {far, ship}};
+        hierarchy.SetParents(batch);
+        bool batched = hierarchy.GetUpdatePeriod(far) == 1 && hierarchy.GetUpdatePeriod(crate) == 1;
+
+        // The frame-based update resolves the moved crate every frame
+        std::size_t updates = 0;
+        for (std::uint64_t frame = 0; frame < 4; ++frame) {
+            hierarchy.Translate(crate, Math::Vector2D(1.0f, 0.0f));
+            updates += hierarchy.UpdateWorldMatrices(frame);
+        }
+        return throttled && restored && batched && updates >= 4 &&
+               floatEqual(hierarchy.GetWorldMatrix(crate).m02, 505.0f);
+    });
+
+    // Test distance bands assign doubling periods to whole subtrees
+    runTest("TransformHierarchy2D Update Periods By Distance", []() {
+        Math::TransformHierarchy2D hierarchy;
+        Math::Transform2DHandle near = hierarchy.Create(Math::Vector2D(5.0f, 0.0f));
+        Math::Transform2DHandle middle = hierarchy.Create(Math::Vector2D(0.0f, 50.0f));
+        Math::Transform2DHandle far = hierarchy.Create(Math::Vector2D(500.0f, 0.0f));
+        Math::Transform2DHandle child = hierarchy.Create(Math::Vector2D(0.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), far);
+
+        const float bands[] = {20.0f, 100.0f, 200.0f};
+        hierarchy.SetUpdatePeriodsByDistance(Math::Vector2D(0.0f, 0.0f), bands);
+        Math::Transform2DHandle lateChild = hierarchy.Create(Math::Vector2D(0.0f, 0.0f), 0.0f, Math::Vector2D(1.0f, 1.0f), middle);
+
+        bool invalidRejected = false;
+        try {
+            hierarchy.SetUpdatePeriod(near, 0);
+        } catch (const std::invalid_argument&) {
+            invalidRejected = true;
+        }
+        return hierarchy.GetUpdatePeriod(near) == 1 && hierarchy.GetUpdatePeriod(middle) == 2 &&
+               hierarchy.GetUpdatePeriod(far) == 8 && hierarchy.GetUpdatePeriod(child) == 8 &&
+               hierarchy.GetUpdatePeriod(lateChild) == 2 && invalidRejected;
+    });
+
+    // Test invalid handles are rejected
+    runTest("TransformHierarchy2D Invalid Handle Throws", []() {
+        Math::TransformHierarchy2D hierarchy;
+        try {
+            (void)hierarchy.GetPosition(Math::Transform2DHandle());
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    });
+
+    std::cout << "\n=== End of TransformHierarchy2D Tests ===\n";
+    return true;
+}
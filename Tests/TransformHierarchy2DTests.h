@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef TRANSFORM_HIERARCHY2D_TESTS_H
+#define TRANSFORM_HIERARCHY2D_TESTS_H
+
+// Function to run TransformHierarchy2D tests
+bool RunTransformHierarchy2DTests();
+
+#endif // TRANSFORM_HIERARCHY2D_TESTS_H
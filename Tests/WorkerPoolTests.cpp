@@ -0,0 +1,81 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "WorkerPoolTests.h"
+#include "TestUtils.h"
+#include "../Math/WorkerPool.h"
+
+bool RunWorkerPoolTests() {
+    std::cout << "\n=== WorkerPool Tests ===\n";
+
+    // Test every item is processed exactly once, repeatedly on the same threads
+    runTest("WorkerPool ParallelFor Covers Every Item", []() {
+        Math::WorkerPool pool(4);
+        std::vector<std::atomic<int>> visits(1001);
+        for (int repeat = 0; repeat < 20; ++repeat) {
+            for (std::size_t threads = 1; threads <= pool.GetThreadCount(); ++threads) {
+                pool.ParallelFor(visits.size(), threads, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        visits[i].fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+        }
+        for (const std::atomic<int>& count : visits) {
+            if (count.load() != 20 * 4) {
+                return false;
+            }
+        }
+        return pool.GetThreadCount() == 4;
+    });
+
+    // Test small batches stay on the calling thread
+    runTest("WorkerPool ParallelForChunks", []() {
+        Math::WorkerPool pool(4);
+        std::mutex mutex;
+        std::size_t chunks = 0;
+        auto countChunks = [&](std::size_t begin, std::size_t end) {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunks += begin < end ? 1 : 0;
+        };
+
+        pool.ParallelForChunks(100, 64, countChunks);
+        const std::size_t smallChunks = chunks;
+        chunks = 0;
+        pool.ParallelForChunks(200, 64, countChunks);
+        const std::size_t mediumChunks = chunks;
+        chunks = 0;
+        pool.ParallelForChunks(100000, 64, countChunks);
+        return smallChunks == 1 && mediumChunks == 3 && chunks == 4;
+    });
+
+    // Test invalid thread counts are rejected
+    runTest("WorkerPool Invalid Thread Count Throws", []() {
+        bool emptyPool = false;
+        try {
+            Math::WorkerPool pool(0);
+        } catch (const std::invalid_argument&) {
+            emptyPool = true;
+        }
+
+        Math::WorkerPool pool(2);
+        bool tooMany = false;
+        try {
+            pool.ParallelFor(10, 3, [](std::size_t, std::size_t) {});
+        } catch (const std::invalid_argument&) {
+            tooMany = true;
+        }
+        return emptyPool && tooMany;
+    });
+
+    std::cout << "\n=== End of WorkerPool Tests ===\n";
+    return true;
+}
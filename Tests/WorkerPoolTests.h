@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef WORKER_POOL_TESTS_H
+#define WORKER_POOL_TESTS_H
+
+// Function to run WorkerPool tests
+bool RunWorkerPoolTests();
+
+#endif // WORKER_POOL_TESTS_H
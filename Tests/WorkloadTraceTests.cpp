@@ -0,0 +1,220 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "WorkloadTraceTests.h"
+#include "TestUtils.h"
+#include "../Math/WorkloadTrace.h"
+#include "../Math/Matrix4D.h"
+#include "../Math/Transform2D.h"
+
+namespace {
+
+    // Records a small scene: a parent and child edited and queried, plus matrix operations
+    void RecordScene(Math::WorkloadRecorder& recorder) {
+        Math::Transform2D parent(Math::Vector2D(1.0f, 2.0f), 0.5f, Math::Vector2D(2.0f, 2.0f));
+        Math::Transform2D child(Math::Vector2D(3.0f, 0.0f));
+        recorder.RegisterTransform(parent);
+        recorder.RegisterTransform(child);
+        recorder.SetParent(child, &parent);
+
+        for (int frame = 0; frame < 10; ++frame) {
+            recorder.Translate(parent, Math::Vector2D(0.1f, 0.0f));
+            recorder.RotateRad(child, 0.05f);
+            recorder.GetWorldMatrix(child);
+            recorder.TransformPoint(child, Math::Vector2D(1.0f, 1.0f));
+            recorder.InverseTransformPoint(parent, Math::Vector2D(0.5f, -0.5f));
+        }
+        recorder.SetScale(child, Math::Vector2D(0.5f, 0.5f));
+        recorder.SetPosition(parent, Math::Vector2D(-1.0f, 4.0f));
+        recorder.SetRotationRad(parent, 1.0f);
+        recorder.GetWorldMatrix(child);
+
+        Math::Matrix4D view = Math::Matrix4D::CreateTranslation(1.0f, 2.0f, 3.0f);
+        Math::Matrix4D projection = Math::Matrix4D::CreatePerspective(1.0f, 1.5f, 0.1f, 100.0f);
+        recorder.TransformPoint(recorder.Multiply(projection, view), Math::Vector3D(0.0f, 0.0f, -5.0f));
+        recorder.Inverse(view);
+        recorder.Multiply(parent.GetLocalMatrix(), child.GetLocalMatrix());
+
+        recorder.SetParent(child, nullptr);
+        recorder.UnregisterTransform(child);
+        recorder.UnregisterTransform(parent);
+    }
+
+    // Appends a record of an operation on transform ids (single-byte varints) with zeroed floats
+    void AppendRecord(std::vector<std::uint8_t>& data, Math::TraceOp op, std::initializer_list<std::uint8_t> ids,
+                      std::size_t floatCount) {
+        data.push_back(static_cast<std::uint8_t>(op));
+        for (const std::uint8_t id : ids) {
+            data.push_back(id);
+        }
+        for (std::size_t i = 0; i < floatCount * 4; ++i) {
+            data.push_back(0);
+        }
+    }
+
+    template <typename Exception>
+    bool Throws(const std::vector<std::uint8_t>& data) {
+        try {
+            Math::WorkloadTrace trace(data);
+        } catch (const Exception&) {
+            return true;
+        }
+        return false;
+    }
+
+} // namespace
+
+bool RunWorkloadTraceTests() {
+    std::cout << "\n=== Workload Trace Tests ===\n";
+
+    runTest("WorkloadTrace Replay Matches Recording", []() {
+        Math::WorkloadRecorder recorder;
+        RecordScene(recorder);
+
+        Math::WorkloadTrace trace(recorder.GetData());
+        return trace.GetOperationCount() == recorder.GetOperationCount() &&
+               recorder.GetChecksum() != 0.0 &&
+               trace.Replay() == recorder.GetChecksum();
+    });
+
+    runTest("WorkloadTrace Compact Encoding", []() {
+        Math::WorkloadRecorder recorder;
+        Math::Transform2D transform;
+        recorder.RegisterTransform(transform);
+        size_t before = recorder.GetData().size();
+        recorder.Translate(transform, Math::Vector2D(1.0f, 0.0f));
+
+        // Op byte, one-byte id, two floats
+        return recorder.GetData().size() - before == 1 + 1 + 2 * sizeof(float);
+    });
+
+    runTest("WorkloadTrace Save & Load", []() {
+        Math::WorkloadRecorder recorder;
+        RecordScene(recorder);
+
+        const char* path = "workload_trace_test.bin";
+        recorder.Save(path);
+        Math::WorkloadTrace trace = Math::WorkloadTrace::Load(path);
+        std::remove(path);
+
+        return trace.GetOperationCount() == recorder.GetOperationCount() &&
+               trace.Replay() == recorder.GetChecksum();
+    });
+
+    runTest("WorkloadTrace Rejects Invalid Data", []() {
+        Math::WorkloadRecorder recorder;
+        RecordScene(recorder);
+        std::vector<std::uint8_t> data = recorder.GetData();
+
+        std::vector<std::uint8_t> badMagic = data;
+        badMagic[0] = 'X';
+
+        std::vector<std::uint8_t> truncated = data;
+        truncated.pop_back();
+
+        std::vector<std::uint8_t> unknownOp(data.begin(), data.begin() + 8);
+        unknownOp.push_back(static_cast<std::uint8_t>(Math::TraceOp::Count));
+
+        // Query on transform 1 before it was created
+        std::vector<std::uint8_t> unknownTransform(data.begin(), data.begin() + 8);
+        unknownTransform.push_back(static_cast<std::uint8_t>(Math::TraceOp::GetWorldMatrix));
+        unknownTransform.push_back(1);
+
+        // Creation with the largest id instead of the next one; its floats are never read
+        std::vector<std::uint8_t> skippedId(data.begin(), data.begin() + 8);
+        skippedId.push_back(static_cast<std::uint8_t>(Math::TraceOp::CreateTransform));
+        for (const std::uint8_t byte : {0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00}) {
+            skippedId.push_back(byte);
+        }
+
+        // Transform 1 is created, then queried with an id that is 1 plus a bit above 32
+        std::vector<std::uint8_t> wideId(data.begin(), data.begin() + 8);
+        wideId.push_back(static_cast<std::uint8_t>(Math::TraceOp::CreateTransform));
+        wideId.push_back(1);
+        wideId.push_back(0);
+        for (int i = 0; i < 5 * 4; ++i) {
+            wideId.push_back(0);
+        }
+        wideId.push_back(static_cast<std::uint8_t>(Math::TraceOp::GetWorldMatrix));
+        for (const std::uint8_t byte : {0x81, 0x80, 0x80, 0x80, 0x10}) {
+            wideId.push_back(byte);
+        }
+
+        return Throws<std::invalid_argument>(badMagic) &&
+               Throws<std::invalid_argument>(truncated) &&
+               Throws<std::invalid_argument>(unknownOp) &&
+               Throws<std::invalid_argument>(unknownTransform) &&
+               Throws<std::invalid_argument>(skippedId) &&
+               Throws<std::invalid_argument>(wideId);
+    });
+
+    runTest("WorkloadTrace Rejects Parent Cycles", []() {
+        Math::WorkloadRecorder recorder;
+        const std::vector<std::uint8_t> header(recorder.GetData().begin(), recorder.GetData().begin() + 8);
+
+        std::vector<std::uint8_t> selfParent = header;
+        AppendRecord(selfParent, Math::TraceOp::CreateTransform, {1, 0}, 5);
+        AppendRecord(selfParent, Math::TraceOp::SetParent, {1, 1}, 0);
+
+        // 2 under 1, then 1 under 2
+        std::vector<std::uint8_t> twoCycle = header;
+        AppendRecord(twoCycle, Math::TraceOp::CreateTransform, {1, 0}, 5);
+        AppendRecord(twoCycle, Math::TraceOp::CreateTransform, {2, 1}, 5);
+        std::vector<std::uint8_t> valid = twoCycle;
+        AppendRecord(twoCycle, Math::TraceOp::SetParent, {1, 2}, 0);
+
+        // Detaching 2 first makes the same link legal
+        AppendRecord(valid, Math::TraceOp::SetParent, {2, 0}, 0);
+        AppendRecord(valid, Math::TraceOp::SetParent, {1, 2}, 0);
+        AppendRecord(valid, Math::TraceOp::GetWorldMatrix, {1}, 0);
+
+        return Throws<std::invalid_argument>(selfParent) &&
+               Throws<std::invalid_argument>(twoCycle) &&
+               Math::WorkloadTrace(valid).GetOperationCount() == 5;
+    });
+
+    runTest("WorkloadRecorder Rejects Unregistered Transforms", []() {
+        Math::WorkloadRecorder recorder;
+        Math::Transform2D registered;
+        Math::Transform2D unregistered;
+        recorder.RegisterTransform(registered);
+
+        bool threwOnEdit = false;
+        try {
+            recorder.Translate(unregistered, Math::Vector2D(1.0f, 0.0f));
+        } catch (const std::invalid_argument&) {
+            threwOnEdit = true;
+        }
+
+        bool threwOnParent = false;
+        try {
+            recorder.SetParent(registered, &unregistered);
+        } catch (const std::invalid_argument&) {
+            threwOnParent = true;
+        }
+
+        bool threwOnTwice = false;
+        try {
+            recorder.RegisterTransform(registered);
+        } catch (const std::invalid_argument&) {
+            threwOnTwice = true;
+        }
+
+        // Rejected calls are neither applied nor recorded
+        return threwOnEdit && threwOnParent && threwOnTwice &&
+               unregistered.GetPosition() == Math::Vector2D(0.0f, 0.0f) &&
+               registered.GetParent() == nullptr &&
+               recorder.GetOperationCount() == 1;
+    });
+
+    std::cout << "\n=== End of Workload Trace Tests ===\n";
+    return true;
+}
@@ -0,0 +1,11 @@
+﻿//
+// Created on 2026-10-18.
+//
+
+#ifndef WORKLOAD_TRACE_TESTS_H
+#define WORKLOAD_TRACE_TESTS_H
+
+// Function to run workload capture and replay tests
+bool RunWorkloadTraceTests();
+
+#endif // WORKLOAD_TRACE_TESTS_H
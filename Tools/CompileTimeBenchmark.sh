@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+#
+# Created on 2026-10-18.
+#
+# Measures how long it takes to compile a translation unit that includes each public
+# header, and how long each library and test source takes to compile. Run it before and
+# after a header change to see its effect on build times.
+#
+# Usage: Tools/CompileTimeBenchmark.sh [runs]
+#   CXX       Compiler to use (default: c++)
+#   CXXFLAGS  Extra flags (default: -std=c++20 -O2)
+#
+
+set -euo pipefail
+
+RUNS="${1:-5}"
+CXX="${CXX:-c++}"
+CXXFLAGS="${CXXFLAGS:--std=c++20 -O2}"
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# Prints the average wall time in milliseconds of compiling a source file
+time_compile() {
+    local source="$1"
+    local mode="$2"
+    local total=0
+    for ((i = 0; i < RUNS; ++i)); do
+        local start end
+        start=$(date +%s%N)
+        # shellcheck disable=SC2086
+        "$CXX" $CXXFLAGS -I"$ROOT" "$mode" "$source" -o "$WORK/out.o"
+        end=$(date +%s%N)
+        total=$((total + (end - start) / 1000))
+    done
+    echo $((total / RUNS / 1000))
+}
+
+printf "Compiler: %s (%s)\nFlags:    %s\nRuns:     %s\n\n" "$CXX" "$("$CXX" --version | head -n 1)" "$CXXFLAGS" "$RUNS"
+
+printf "%-40s %10s\n" "Header (include only)" "ms"
+for header in "$ROOT"/Math/*.h; do
+    name="Math/$(basename "$header")"
+    echo "#include \"$name\"" > "$WORK/include.cpp"
+    printf "%-40s %10s\n" "$name" "$(time_compile "$WORK/include.cpp" -c)"
+done
+
+echo
+printf "%-40s %10s\n" "Source (full compile)" "ms"
+for source in "$ROOT"/Math/*.cpp "$ROOT"/Tests/*.cpp; do
+    name="${source#"$ROOT"/}"
+    printf "%-40s %10s\n" "$name" "$(time_compile "$source" -c)"
+done
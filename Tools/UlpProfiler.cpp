@@ -0,0 +1,678 @@
+﻿//
+// Created on 2026-10-18.
+//
+// Measures the accuracy of the library's float math against double-precision references.
+//
+// Every profiled function is evaluated over one or more input domains and its result is
+// compared with a reference computed in double from the same float inputs. The error is
+// expressed in units in the last place (ULP) of the float reference: 0.5 means correctly
+// rounded. Vector and matrix results use a norm-wise error, the largest component error
+// in ULPs of the largest reference component, so a tiny component produced by cancellation
+// does not dominate the report.
+//
+// Scalar functions can be swept exhaustively over every float of their domain; the other
+// functions are sampled with a counter-based random generator, so results do not depend on
+// the thread count. Work is split over all hardware threads.
+//
+// Usage: MathEngineUlpProfiler [--samples=count] [--threads=count] [--exhaustive] [--filter=text]
+//
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Math/Constants.h"
+#include "Math/Format.h"
+#include "Math/Matrix2D.h"
+#include "Math/Matrix2DSimd.h"
+#include "Math/Matrix3D.h"
+#include "Math/Matrix4D.h"
+#include "Math/ScalarMath.h"
+#include "Math/Transform2D.h"
+#include "Math/Vector2D.h"
+#include "Math/Vector3D.h"
+
+using namespace Math;
+
+namespace {
+
+    // ULP measurement
+
+    // Spacing of floats around a reference value
+    double UlpOf(double reference) {
+        const float value = std::fabs(static_cast<float>(reference));
+        if (value == 0.0f || !std::isfinite(value)) {
+            return std::ldexp(1.0, -149);
+        }
+        return std::ldexp(1.0, std::max(std::ilogb(value), -126) - 23);
+    }
+
+    /**
+     * @brief Outcome of evaluating one sample.
+     */
+    struct SampleResult {
+        enum class Kind : std::uint8_t {
+            Measured,
+            Skipped,            // Input outside the function's contract (e.g. singular matrix)
+            NonFiniteMismatch   // NaN or infinity where the reference has none, or the reverse
+        };
+
+        Kind kind = Kind::Measured;
+        double ulp = 0.0;
+
+        static SampleResult Skip() {
+            return {Kind::Skipped, 0.0};
+        }
+    };
+
+    // Error of a scalar result
+    SampleResult ScalarError(float result, double reference) {
+        const bool resultFinite = std::isfinite(result);
+        const bool referenceFinite = std::isfinite(static_cast<float>(reference));
+        if (!resultFinite || !referenceFinite) {
+            const bool same = (std::isnan(result) && std::isnan(reference)) || result == static_cast<float>(reference);
+            return same ? SampleResult{} : SampleResult{SampleResult::Kind::NonFiniteMismatch, 0.0};
+        }
+        return {SampleResult::Kind::Measured, std::fabs(result - reference) / UlpOf(reference)};
+    }
+
+    // Norm-wise error of a vector or matrix result
+    template <std::size_t N>
+    SampleResult NormwiseError(const std::array<float, N>& result, const std::array<double, N>& reference) {
+        double largestReference = 0.0;
+        double largestError = 0.0;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!std::isfinite(result[i]) || !std::isfinite(static_cast<float>(reference[i]))) {
+                return {SampleResult::Kind::NonFiniteMismatch, 0.0};
+            }
+            largestReference = std::max(largestReference, std::fabs(reference[i]));
+            largestError = std::max(largestError, std::fabs(result[i] - reference[i]));
+        }
+        return {SampleResult::Kind::Measured, largestError / UlpOf(largestReference)};
+    }
+
+    // Statistics
+
+    // Histogram buckets: exactly 0, then up to 0.5, 1, 2, 4, ... 1024 ULP, then more
+    constexpr std::size_t BucketCount = 14;
+
+    std::size_t BucketOf(double ulp) {
+        if (ulp == 0.0) {
+            return 0;
+        }
+        double limit = 0.5;
+        for (std::size_t bucket = 1; bucket < BucketCount - 1; ++bucket, limit *= 2.0) {
+            if (ulp <= limit) {
+                return bucket;
+            }
+        }
+        return BucketCount - 1;
+    }
+
+    std::string BucketLabel(std::size_t bucket) {
+        if (bucket == 0) {
+            return "0";
+        }
+        if (bucket == BucketCount - 1) {
+            return ">1024";
+        }
+        const double limit = std::ldexp(0.5, static_cast<int>(bucket) - 1);
+        char buffer[16];
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), limit);
+        return "<=" + std::string(buffer, result.ptr);
+    }
+
+    /**
+     * @brief Error statistics of one function over one domain.
+     */
+    struct UlpStats {
+        std::uint64_t measured = 0;
+        std::uint64_t skipped = 0;
+        std::uint64_t nonFiniteMismatches = 0;
+        double maxUlp = 0.0;
+        double sumUlp = 0.0;
+        std::uint64_t worstSample = 0;
+        std::array<std::uint64_t, BucketCount> histogram{};
+
+        void Add(const SampleResult& result, std::uint64_t sample) {
+            switch (result.kind) {
+                case SampleResult::Kind::Skipped:
+                    ++skipped;
+                    return;
+                case SampleResult::Kind::NonFiniteMismatch:
+                    ++nonFiniteMismatches;
+                    return;
+                case SampleResult::Kind::Measured:
+                    break;
+            }
+            ++measured;
+            sumUlp += result.ulp;
+            ++histogram[BucketOf(result.ulp)];
+            if (result.ulp > maxUlp || measured == 1) {
+                maxUlp = result.ulp;
+                worstSample = sample;
+            }
+        }
+
+        void Merge(const UlpStats& other) {
+            if (other.measured > 0 && (measured == 0 || other.maxUlp > maxUlp ||
+                                       (other.maxUlp == maxUlp && other.worstSample < worstSample))) {
+                maxUlp = other.maxUlp;
+                worstSample = other.worstSample;
+            }
+            measured += other.measured;
+            skipped += other.skipped;
+            nonFiniteMismatches += other.nonFiniteMismatches;
+            sumUlp += other.sumUlp;
+            for (std::size_t i = 0; i < BucketCount; ++i) {
+                histogram[i] += other.histogram[i];
+            }
+        }
+    };
+
+    // Cases
+
+    /**
+     * @brief One function evaluated over one input domain.
+     */
+    struct ProfileCase {
+        std::string function;
+        std::string domain;
+        std::uint64_t sampleCount = 0;
+
+        /** Evaluates sample i; must be thread-safe */
+        std::function<SampleResult(std::uint64_t)> evaluate;
+
+        /** Describes the input of sample i */
+        std::function<std::string(std::uint64_t)> describe;
+    };
+
+    // Counter-based generator: sample i always gets the same inputs, whatever thread runs it
+    class SampleRandom {
+    private:
+        std::uint64_t m_State;
+
+    public:
+        explicit SampleRandom(std::uint64_t sample) : m_State(sample * 0x9E3779B97F4A7C15ull + 0x2545F4914F6CDD1Dull) {}
+
+        std::uint64_t Next() {
+            std::uint64_t z = (m_State += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        float Uniform(float low, float high) {
+            const float unit = static_cast<float>(Next() >> 40) / static_cast<float>(1ull << 24);
+            return low + (high - low) * unit;
+        }
+
+        // Log-uniform magnitude with a random sign, covering many binades
+        float Wide(float minMagnitude, float maxMagnitude) {
+            const float magnitude = std::exp(Uniform(std::log(minMagnitude), std::log(maxMagnitude)));
+            return (Next() & 1) != 0 ? -magnitude : magnitude;
+        }
+    };
+
+    template <typename T>
+    std::string Describe(const T& value) {
+        char buffer[MaxFormattedSize<T>];
+        const std::to_chars_result result = ToChars(buffer, buffer + sizeof(buffer), value);
+        return std::string(buffer, result.ptr);
+    }
+
+    // Maps floats to integers that preserve their order, so a float range becomes an integer range
+    std::int64_t OrderedBits(float value) {
+        const std::int32_t bits = std::bit_cast<std::int32_t>(value);
+        return bits < 0 ? -static_cast<std::int64_t>(bits & 0x7FFFFFFF) : bits;
+    }
+
+    float FromOrderedBits(std::int64_t ordered) {
+        const std::uint32_t bits = ordered < 0 ? static_cast<std::uint32_t>(-ordered) | 0x80000000u
+                                               : static_cast<std::uint32_t>(ordered);
+        return std::bit_cast<float>(bits);
+    }
+
+    // Scalar function over [low, high]: every float when exhaustive, otherwise evenly spaced floats
+    ProfileCase ScalarCase(std::string function, std::string domain, float low, float high,
+                           std::uint64_t maxSamples, bool exhaustive,
+                           float (*evaluate)(float), double (*reference)(double)) {
+        const std::int64_t first = OrderedBits(low);
+        const std::uint64_t floatCount = static_cast<std::uint64_t>(OrderedBits(high) - first) + 1;
+        const std::uint64_t stride = exhaustive ? 1 : std::max<std::uint64_t>(1, floatCount / maxSamples);
+
+        auto input = [first, stride](std::uint64_t sample) {
+            return FromOrderedBits(first + static_cast<std::int64_t>(sample * stride));
+        };
+
+        ProfileCase profileCase;
+        profileCase.function = std::move(function);
+        profileCase.domain = std::move(domain) + (stride == 1 ? " (all floats)" : "");
+        profileCase.sampleCount = (floatCount + stride - 1) / stride;
+        profileCase.evaluate = [input, evaluate, reference](std::uint64_t sample) {
+            const float x = input(sample);
+            return ScalarError(evaluate(x), reference(static_cast<double>(x)));
+        };
+        profileCase.describe = [input](std::uint64_t sample) {
+            char buffer[MaxFloatChars];
+            const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), input(sample));
+            return std::string(buffer, result.ptr);
+        };
+        return profileCase;
+    }
+
+    // Case whose inputs are generated by makeInput(random) and evaluated by measure(input)
+    template <typename Input, typename MakeInput, typename Measure>
+    ProfileCase SampledCase(std::string function, std::string domain, std::uint64_t samples,
+                            MakeInput makeInput, Measure measure) {
+        ProfileCase profileCase;
+        profileCase.function = std::move(function);
+        profileCase.domain = std::move(domain);
+        profileCase.sampleCount = samples;
+        profileCase.evaluate = [makeInput, measure](std::uint64_t sample) {
+            SampleRandom random(sample);
+            const Input input = makeInput(random);
+            return measure(input);
+        };
+        profileCase.describe = [makeInput](std::uint64_t sample) {
+            SampleRandom random(sample);
+            return Describe(makeInput(random));
+        };
+        return profileCase;
+    }
+
+    // Double-precision references
+
+    // Gauss-Jordan elimination with partial pivoting; returns false if the matrix is singular
+    template <std::size_t N>
+    bool InvertReference(const std::array<float, N * N>& input, std::array<double, N * N>& inverse) {
+        std::array<double, N * N> a;
+        for (std::size_t i = 0; i < N * N; ++i) {
+            a[i] = input[i];
+            inverse[i] = (i / N == i % N) ? 1.0 : 0.0;
+        }
+
+        for (std::size_t column = 0; column < N; ++column) {
+            std::size_t pivot = column;
+            for (std::size_t row = column + 1; row < N; ++row) {
+                if (std::fabs(a[row * N + column]) > std::fabs(a[pivot * N + column])) {
+                    pivot = row;
+                }
+            }
+            if (a[pivot * N + column] == 0.0) {
+                return false;
+            }
+            for (std::size_t k = 0; k < N; ++k) {
+                std::swap(a[column * N + k], a[pivot * N + k]);
+                std::swap(inverse[column * N + k], inverse[pivot * N + k]);
+            }
+
+            const double scale = 1.0 / a[column * N + column];
+            for (std::size_t k = 0; k < N; ++k) {
+                a[column * N + k] *= scale;
+                inverse[column * N + k] *= scale;
+            }
+            for (std::size_t row = 0; row < N; ++row) {
+                if (row == column) {
+                    continue;
+                }
+                const double factor = a[row * N + column];
+                for (std::size_t k = 0; k < N; ++k) {
+                    a[row * N + k] -= factor * a[column * N + k];
+                    inverse[row * N + k] -= factor * inverse[column * N + k];
+                }
+            }
+        }
+        return true;
+    }
+
+    std::array<float, 4> ToArray(const Matrix2D& matrix) {
+        return {matrix.m00, matrix.m01, matrix.m10, matrix.m11};
+    }
+
+    // Measures a float inverse against the double reference; singular inputs are skipped
+    template <std::size_t N, typename Matrix, typename Invert>
+    SampleResult InverseError(const Matrix& matrix, const std::array<float, N * N>& elements, Invert invert) {
+        std::array<double, N * N> reference;
+        if (!InvertReference<N>(elements, reference)) {
+            return SampleResult::Skip();
+        }
+        try {
+            const Matrix inverse = invert(matrix);
+            if constexpr (N == 2) {
+                return NormwiseError(ToArray(inverse), reference);
+            } else {
+                return NormwiseError(inverse.ToArray(), reference);
+            }
+        } catch (const std::runtime_error&) {
+            // The float path considered the matrix singular
+            return SampleResult::Skip();
+        }
+    }
+
+    // Input generators
+
+    Vector2D UnitRangeVector2D(SampleRandom& random) {
+        return {random.Uniform(-1.0f, 1.0f), random.Uniform(-1.0f, 1.0f)};
+    }
+
+    Vector2D WideVector2D(SampleRandom& random) {
+        return {random.Wide(1e-18f, 1e18f), random.Wide(1e-18f, 1e18f)};
+    }
+
+    Vector3D UnitRangeVector3D(SampleRandom& random) {
+        return {random.Uniform(-1.0f, 1.0f), random.Uniform(-1.0f, 1.0f), random.Uniform(-1.0f, 1.0f)};
+    }
+
+    Vector3D WideVector3D(SampleRandom& random) {
+        return {random.Wide(1e-12f, 1e12f), random.Wide(1e-12f, 1e12f), random.Wide(1e-12f, 1e12f)};
+    }
+
+    Matrix2D RandomMatrix2D(SampleRandom& random) {
+        return {random.Uniform(-1.0f, 1.0f), random.Uniform(-1.0f, 1.0f),
+                random.Uniform(-1.0f, 1.0f), random.Uniform(-1.0f, 1.0f)};
+    }
+
+    // Rotation and non-uniform scale in [0.5, 2]: condition number at most 4
+    Matrix2D RotationScaleMatrix2D(SampleRandom& random) {
+        const float angle = random.Uniform(-Constants::PI, Constants::PI);
+        const float sx = random.Uniform(0.5f, 2.0f);
+        const float sy = random.Uniform(0.5f, 2.0f);
+        return {sx * std::cos(angle), -sy * std::sin(angle), sx * std::sin(angle), sy * std::cos(angle)};
+    }
+
+    Matrix3D RandomMatrix3D(SampleRandom& random) {
+        std::array<float, 9> elements;
+        for (float& element : elements) {
+            element = random.Uniform(-1.0f, 1.0f);
+        }
+        return Matrix3D(elements);
+    }
+
+    Matrix3D AffineMatrix3D(SampleRandom& random) {
+        const Transform2D transform(Vector2D(random.Uniform(-100.0f, 100.0f), random.Uniform(-100.0f, 100.0f)),
+                                    random.Uniform(-Constants::PI, Constants::PI),
+                                    Vector2D(random.Uniform(0.5f, 2.0f), random.Uniform(0.5f, 2.0f)));
+        return transform.GetLocalMatrix();
+    }
+
+    Matrix4D RandomMatrix4D(SampleRandom& random) {
+        std::array<float, 16> elements;
+        for (float& element : elements) {
+            element = random.Uniform(-1.0f, 1.0f);
+        }
+        return Matrix4D(elements);
+    }
+
+    Matrix4D AffineMatrix4D(SampleRandom& random) {
+        const Vector3D axis = Vector3D(random.Uniform(-1.0f, 1.0f), random.Uniform(-1.0f, 1.0f),
+                                       random.Uniform(-1.0f, 1.0f)).GetNormalized();
+        return Matrix4D::CreateTransformation(
+            Vector3D(random.Uniform(-100.0f, 100.0f), random.Uniform(-100.0f, 100.0f), random.Uniform(-100.0f, 100.0f)),
+            axis.Length() > 0.0f ? axis : Vector3D(0.0f, 0.0f, 1.0f),
+            random.Uniform(-Constants::PI, Constants::PI),
+            Vector3D(random.Uniform(0.5f, 2.0f), random.Uniform(0.5f, 2.0f), random.Uniform(0.5f, 2.0f)));
+    }
+
+    // Cases of the library
+
+    std::vector<ProfileCase> BuildCases(std::uint64_t samples, bool exhaustive) {
+        std::vector<ProfileCase> cases;
+
+        // Trigonometry used by Transform2D and the rotation factories
+        cases.push_back(ScalarCase("std::sin(float)", "[-pi, pi]", -Constants::PI, Constants::PI, samples, exhaustive,
+                                   [](float x) { return std::sin(x); }, [](double x) { return std::sin(x); }));
+        cases.push_back(ScalarCase("std::cos(float)", "[-pi, pi]", -Constants::PI, Constants::PI, samples, exhaustive,
+                                   [](float x) { return std::cos(x); }, [](double x) { return std::cos(x); }));
+        cases.push_back(ScalarCase("Deterministic::Sin", "[-pi, pi]", -Constants::PI, Constants::PI, samples, exhaustive,
+                                   Deterministic::Sin, [](double x) { return std::sin(x); }));
+        cases.push_back(ScalarCase("Deterministic::Cos", "[-pi, pi]", -Constants::PI, Constants::PI, samples, exhaustive,
+                                   Deterministic::Cos, [](double x) { return std::cos(x); }));
+        cases.push_back(ScalarCase("Deterministic::Sin", "[-1e4, 1e4]", -1.0e4f, 1.0e4f, samples, exhaustive,
+                                   Deterministic::Sin, [](double x) { return std::sin(x); }));
+        cases.push_back(ScalarCase("Deterministic::Tan", "[-1.5, 1.5]", -1.5f, 1.5f, samples, exhaustive,
+                                   Deterministic::Tan, [](double x) { return std::tan(x); }));
+        cases.push_back(ScalarCase("Deterministic::Acos", "[-1, 1]", -1.0f, 1.0f, samples, exhaustive,
+                                   Deterministic::Acos, [](double x) { return std::acos(x); }));
+
+        // Normalization
+        auto normalize2D = [](const Vector2D& v) {
+            const double length = std::hypot(static_cast<double>(v.x), static_cast<double>(v.y));
+            if (length == 0.0) {
+                return SampleResult::Skip();
+            }
+            const Vector2D result = v.Normalize();
+            return NormwiseError(std::array<float, 2>{result.x, result.y},
+                                 std::array<double, 2>{v.x / length, v.y / length});
+        };
+        cases.push_back(SampledCase<Vector2D>("Vector2D::Normalize", "[-1, 1]^2", samples, UnitRangeVector2D, normalize2D));
+        cases.push_back(SampledCase<Vector2D>("Vector2D::Normalize", "+-[1e-18, 1e18]^2", samples, WideVector2D, normalize2D));
+
+        auto normalize3D = [](const Vector3D& v) {
+            const double x = v.x, y = v.y, z = v.z;
+            const double length = std::sqrt(x * x + y * y + z * z);
+            if (length == 0.0) {
+                return SampleResult::Skip();
+            }
+            const Vector3D result = v.GetNormalized();
+            return NormwiseError(std::array<float, 3>{result.x, result.y, result.z},
+                                 std::array<double, 3>{x / length, y / length, z / length});
+        };
+        cases.push_back(SampledCase<Vector3D>("Vector3D::GetNormalized", "[-1, 1]^3", samples, UnitRangeVector3D, normalize3D));
+        cases.push_back(SampledCase<Vector3D>("Vector3D::GetNormalized", "+-[1e-12, 1e12]^3", samples, WideVector3D, normalize3D));
+
+        // Inverses
+        auto inverse2D = [](const Matrix2D& m) {
+            return InverseError<2>(m, ToArray(m), [](const Matrix2D& matrix) { return matrix.Inverse(); });
+        };
+        auto simdInverse2D = [](const Matrix2D& m) {
+            return InverseError<2>(m, ToArray(m), [](const Matrix2D& matrix) { return Simd::Inverse(matrix); });
+        };
+        cases.push_back(SampledCase<Matrix2D>("Matrix2D::Inverse", "rotation-scale", samples, RotationScaleMatrix2D, inverse2D));
+        cases.push_back(SampledCase<Matrix2D>("Matrix2D::Inverse", "uniform [-1, 1]", samples, RandomMatrix2D, inverse2D));
+        cases.push_back(SampledCase<Matrix2D>("Simd::Inverse(Matrix2D)", "rotation-scale", samples, RotationScaleMatrix2D, simdInverse2D));
+        cases.push_back(SampledCase<Matrix2D>("Simd::Inverse(Matrix2D)", "uniform [-1, 1]", samples, RandomMatrix2D, simdInverse2D));
+
+        auto inverse3D = [](const Matrix3D& m) {
+            return InverseError<3>(m, m.ToArray(), [](const Matrix3D& matrix) { return matrix.Inverse(); });
+        };
+        cases.push_back(SampledCase<Matrix3D>("Matrix3D::Inverse", "2D affine", samples, AffineMatrix3D, inverse3D));
+        cases.push_back(SampledCase<Matrix3D>("Matrix3D::Inverse", "uniform [-1, 1]", samples, RandomMatrix3D, inverse3D));
+
+        auto inverse4D = [](const Matrix4D& m) {
+            return InverseError<4>(m, m.ToArray(), [](const Matrix4D& matrix) { return matrix.Inverse(); });
+        };
+        cases.push_back(SampledCase<Matrix4D>("Matrix4D::Inverse", "3D affine", samples, AffineMatrix4D, inverse4D));
+        cases.push_back(SampledCase<Matrix4D>("Matrix4D::Inverse", "uniform [-1, 1]", samples, RandomMatrix4D, inverse4D));
+
+        // Batch transforms
+        auto simdTransform = [](const Matrix2D& m) {
+            SampleRandom random(std::bit_cast<std::uint32_t>(m.m00));
+            const Vector2D input[4] = {UnitRangeVector2D(random), UnitRangeVector2D(random),
+                                       UnitRangeVector2D(random), UnitRangeVector2D(random)};
+            Vector2D output[4];
+            Simd::TransformVectors(m, input, output);
+
+            SampleResult worst;
+            for (int i = 0; i < 4; ++i) {
+                const double x = input[i].x, y = input[i].y;
+                const SampleResult result = NormwiseError(
+                    std::array<float, 2>{output[i].x, output[i].y},
+                    std::array<double, 2>{m.m00 * x + m.m01 * y, m.m10 * x + m.m11 * y});
+                if (result.kind != SampleResult::Kind::Measured || result.ulp > worst.ulp) {
+                    worst = result;
+                }
+                if (result.kind != SampleResult::Kind::Measured) {
+                    break;
+                }
+            }
+            return worst;
+        };
+        cases.push_back(SampledCase<Matrix2D>("Simd::TransformVectors", "rotation-scale", samples, RotationScaleMatrix2D, simdTransform));
+
+        auto transformPoint4D = [](const Matrix4D& m) {
+            SampleRandom random(std::bit_cast<std::uint32_t>(m.m03));
+            const Vector3D p(random.Uniform(-100.0f, 100.0f), random.Uniform(-100.0f, 100.0f), random.Uniform(-100.0f, 100.0f));
+            const Vector3D result = m.TransformPoint(p);
+            const std::array<float, 16> e = m.ToArray();
+            std::array<double, 3> reference;
+            for (int row = 0; row < 3; ++row) {
+                reference[row] = static_cast<double>(e[row * 4]) * p.x + static_cast<double>(e[row * 4 + 1]) * p.y +
+                                 static_cast<double>(e[row * 4 + 2]) * p.z + e[row * 4 + 3];
+            }
+            return NormwiseError(std::array<float, 3>{result.x, result.y, result.z}, reference);
+        };
+        cases.push_back(SampledCase<Matrix4D>("Matrix4D::TransformPoint", "3D affine", samples, AffineMatrix4D, transformPoint4D));
+
+        return cases;
+    }
+
+    // Running
+
+    struct Options {
+        std::uint64_t samples = 1u << 20;
+        unsigned int threads = 0;
+        bool exhaustive = false;
+        std::string filter;
+    };
+
+    Options ParseOptions(int argc, char** argv) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument.starts_with("--samples=")) {
+                options.samples = std::stoull(std::string(argument.substr(10)));
+            } else if (argument.starts_with("--threads=")) {
+                options.threads = static_cast<unsigned int>(std::stoul(std::string(argument.substr(10))));
+            } else if (argument == "--exhaustive") {
+                options.exhaustive = true;
+            } else if (argument.starts_with("--filter=")) {
+                options.filter = std::string(argument.substr(9));
+            } else {
+                throw std::invalid_argument("Unknown option: " + std::string(argument) +
+                                            " (expected --samples=count, --threads=count, --exhaustive or --filter=text)");
+            }
+        }
+        if (options.samples == 0) {
+            throw std::invalid_argument("--samples must be positive");
+        }
+        return options;
+    }
+
+    // Evaluates all samples of a case, with threads claiming chunks of samples
+    UlpStats RunCase(const ProfileCase& profileCase, unsigned int threadCount) {
+        constexpr std::uint64_t ChunkSize = 1u << 14;
+        std::atomic<std::uint64_t> nextChunk{0};
+        std::vector<UlpStats> threadStats(threadCount);
+
+        auto work = [&](unsigned int threadIndex) {
+            UlpStats& stats = threadStats[threadIndex];
+            while (true) {
+                const std::uint64_t begin = nextChunk.fetch_add(ChunkSize, std::memory_order_relaxed);
+                if (begin >= profileCase.sampleCount) {
+                    return;
+                }
+                const std::uint64_t end = std::min(begin + ChunkSize, profileCase.sampleCount);
+                for (std::uint64_t sample = begin; sample < end; ++sample) {
+                    stats.Add(profileCase.evaluate(sample), sample);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned int i = 1; i < threadCount; ++i) {
+            workers.emplace_back(work, i);
+        }
+        work(0);
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        UlpStats total;
+        for (const UlpStats& stats : threadStats) {
+            total.Merge(stats);
+        }
+        return total;
+    }
+
+    void PrintSummary(const ProfileCase& profileCase, const UlpStats& stats) {
+        std::cout << std::left << std::setw(26) << profileCase.function << std::setw(30) << profileCase.domain
+                  << std::right << std::setw(12) << stats.measured;
+        if (stats.measured == 0) {
+            std::cout << std::setw(12) << "-" << std::setw(12) << "-";
+        } else {
+            std::cout << std::fixed << std::setprecision(3)
+                      << std::setw(12) << stats.maxUlp
+                      << std::setw(12) << stats.sumUlp / static_cast<double>(stats.measured);
+        }
+        std::cout << std::setw(10) << stats.skipped << std::setw(10) << stats.nonFiniteMismatches;
+        if (stats.measured > 0) {
+            std::cout << "   " << profileCase.describe(stats.worstSample);
+        }
+        std::cout << "\n";
+    }
+
+    void PrintHistogram(const ProfileCase& profileCase, const UlpStats& stats) {
+        std::cout << std::left << std::setw(26) << profileCase.function << std::setw(30) << profileCase.domain << std::right;
+        for (std::uint64_t count : stats.histogram) {
+            const double share = stats.measured > 0 ? 100.0 * static_cast<double>(count) / static_cast<double>(stats.measured) : 0.0;
+            std::cout << std::fixed << std::setprecision(count > 0 && share < 0.1 ? 3 : 1) << std::setw(8) << share;
+        }
+        std::cout << "\n";
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        const Options options = ParseOptions(argc, argv);
+        const unsigned int threadCount = options.threads > 0 ? options.threads
+                                                             : std::max(1u, std::thread::hardware_concurrency());
+
+        std::vector<ProfileCase> cases;
+        for (ProfileCase& profileCase : BuildCases(options.samples, options.exhaustive)) {
+            if (options.filter.empty() || profileCase.function.find(options.filter) != std::string::npos) {
+                cases.push_back(std::move(profileCase));
+            }
+        }
+
+        std::cout << "ULP error against double-precision references (" << threadCount << " threads)\n\n"
+                  << std::left << std::setw(26) << "Function" << std::setw(30) << "Domain" << std::right
+                  << std::setw(12) << "Samples" << std::setw(12) << "Max ULP" << std::setw(12) << "Mean ULP"
+                  << std::setw(10) << "Skipped" << std::setw(10) << "NonFinite" << "   Worst input\n";
+
+        std::vector<UlpStats> results;
+        for (const ProfileCase& profileCase : cases) {
+            results.push_back(RunCase(profileCase, threadCount));
+            PrintSummary(profileCase, results.back());
+        }
+
+        std::cout << "\nShare of samples per ULP bucket (%)\n"
+                  << std::left << std::setw(56) << "" << std::right;
+        for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+            std::cout << std::setw(8) << BucketLabel(bucket);
+        }
+        std::cout << "\n";
+        for (std::size_t i = 0; i < cases.size(); ++i) {
+            PrintHistogram(cases[i], results[i]);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -5,7 +5,21 @@
 #include "Tests/Matrix2DTests.h"
 #include "Tests/Matrix3DTests.h"
 #include "Tests/Matrix4DTests.h"
+#include "Tests/TaggedMatrix4DTests.h"
 #include "Tests/Transform2DTests.h"
+#include "Tests/TransformHierarchy2DTests.h"
+#include "Tests/FormatTests.h"
+#include "Tests/WorkloadTraceTests.h"
+#include "Tests/TraceTests.h"
+#include "Tests/AllocationTests.h"
+#include "Tests/ScalarMathTests.h"
+#include "Tests/WorkerPoolTests.h"
+#include "Tests/ParticleSystemTests.h"
+#include "Tests/CrowdSteeringTests.h"
+#include "Tests/FlowFieldTests.h"
+#include "Tests/NavMeshTests.h"
+#include "Tests/ClothSolverTests.h"
+#include "Tests/SphFluidTests.h"
 
 int main() {
     std::cout << "Running all tests...\n";
@@ -15,7 +29,21 @@ int main() {
     RunMatrix2DTests();
     RunMatrix3DTests();
     RunMatrix4DTests();
+    RunTaggedMatrix4DTests();
     RunTransform2DTests();
+    RunTransformHierarchy2DTests();
+    RunFormatTests();
+    RunWorkloadTraceTests();
+    RunTraceTests();
+    RunAllocationTests();
+    RunScalarMathTests();
+    RunWorkerPoolTests();
+    RunParticleSystemTests();
+    RunCrowdSteeringTests();
+    RunFlowFieldTests();
+    RunNavMeshTests();
+    RunClothSolverTests();
+    RunSphFluidTests();
 
     std::cout << "\nAll tests completed.\n";
     return 0;